@@ -11,6 +11,7 @@ help=
 local=
 mingw=
 debug_features=
+benchmarks=
 
 ## Iterate args looking for :
 # --clear : Total remove of build/ directory
@@ -18,6 +19,7 @@ debug_features=
 # --local : Install path set to dist/install
 # --mingw : Enable "MinGW Makefiles" generator and $MSYSTEM_PREFIX system install path
 # --debug-features : Enable CMake targets for unit testing and doc generation, even if build type is Release
+# --benchmarks : Enable CMake targets for microbenchmarks
 for arg in "$@"; do
   if [ "$arg" ]; then
     if [ "$arg" == "--clear" ]; then
@@ -30,6 +32,8 @@ for arg in "$@"; do
       mingw=1
     elif [ "$arg" == "--debug-features" ]; then
       debug_features=1
+    elif [ "$arg" == "--benchmarks" ]; then
+      benchmarks=1
     else
       echo -e "${BRIGHT_RED}Unknown argument \"$arg\".${RESET}"
       exit 1
@@ -57,6 +61,7 @@ if [ "$help" ]; then
   echo "                       prefix path to \$MSYSTEM_PREFIX. Required on MinGW."
   echo "    --debug-features : Enable CMake targets for unit testing and doc generation,"
   echo "                       even if this command use Release build."
+  echo "    --benchmarks     : Enable CMake targets for microbenchmarks."
   echo
 
   exit 0
@@ -90,6 +95,13 @@ else
   log_level="STATUS"
 fi
 
+# Set CMake RPT_BUILD_BENCHMARKS depending on --benchmarks command option
+if [ "$benchmarks" ]; then
+  benchmarks_option="-DRPT_BUILD_BENCHMARKS=1"
+else
+  benchmarks_option="-DRPT_BUILD_BENCHMARKS=0"
+fi
+
 
 # Default value for archiver used by CMake
 if [ ! "$AR" ]; then
@@ -112,7 +124,7 @@ success=
 mkdir -p build && \
 cd build && \
 cmake --log-level=$log_level -DCMAKE_BUILD_TYPE=Release -DCMAKE_SYSTEM_PREFIX_PATH="../dist/install" $install_prefix \
-  -DCMAKE_AR="$ar_exec" -DCMAKE_RANLIB="$ranlib_exec" -G"$generator" $debug_features_option .. && \
+  -DCMAKE_AR="$ar_exec" -DCMAKE_RANLIB="$ranlib_exec" -G"$generator" $debug_features_option $benchmarks_option .. && \
 cmake --build . -- "-j$(nproc)" && \
 cd .. && \
 success=1
@@ -274,6 +274,7 @@ fi
 
 tryAptGet libssl-dev || failure=1
 tryAptGet liblua5.3-dev || failure=1
+tryAptGet libbenchmark-dev || failure=1
 tryHeaderOnlyGet nlohmann json master || failure=1
 tryHeaderOnlyGet ThePhD sol2 main || failure=1
 trySourceGet gabime spdlog v1.x spdlog-1.x || failure=1
@@ -51,6 +51,7 @@ tryPacmanGet spdlog "$target" || failure=1
 tryPacmanGet nlohmann-json "$target" || failure=1
 tryPacmanGet lua "$target" || failure=1
 tryPacmanGet sol2 "$target" || failure=1
+tryPacmanGet benchmark "$target" || failure=1
 
 if [ $failure ]; then # If any error occurred...
   exit 1 # ...the script hasn't complete successfully
@@ -0,0 +1,100 @@
+#include <benchmark/benchmark.h>
+
+#include <csignal>
+#include <thread>
+#include <vector>
+#include <RpT-Network/UnsafeBeastWebsocketBackend.hpp>
+
+
+using namespace RpT::Network;
+
+
+/// Threads connecting clients concurrently, each one connecting clients one after the other
+constexpr std::size_t CLIENT_THREADS_COUNT { 8 };
+/// Clients connected by each client thread for one iteration
+constexpr std::size_t CONNECTIONS_PER_THREAD { 16 };
+
+
+/**
+ * @brief Websocket backend listening on an ephemeral loopback port, with main loop ran by its own thread
+ *
+ * Backend is stopped at destruction with `SIGTERM`, as a running server is.
+ */
+class RunningBackend {
+private:
+    // Errors from clients disconnecting abruptly aren't logged, as they would be for each connection
+    RpT::Utils::LoggingContext logging_;
+    UnsafeBeastWebsocketBackend backend_;
+    std::thread main_loop_;
+
+public:
+    /// Listens with given accept options, using one handshake thread for each acceptor
+    explicit RunningBackend(const AcceptOptions& accept)
+    : logging_ { RpT::Utils::LogLevel::FATAL },
+    backend_ {
+        boost::asio::ip::tcp::endpoint { boost::asio::ip::address_v4::loopback(), 0 }, logging_, 0, {}, {},
+        HandshakeOptions { accept.acceptorsCount, 0 }, accept
+    },
+    main_loop_ { [this]() {
+        while (!backend_.closed())
+            backend_.waitForInput();
+    } } {}
+
+    /// Stops backend from its main loop then waits for main loop to return
+    ~RunningBackend() {
+        std::raise(SIGTERM);
+        main_loop_.join();
+    }
+
+    /// Retrieves endpoint for clients to connect to
+    const boost::asio::ip::tcp::endpoint& endpoint() const {
+        return backend_.localEndpoint();
+    }
+};
+
+
+/// Connects given count of clients then disconnects them as soon as their Websocket handshake is done
+void connectClients(const boost::asio::ip::tcp::endpoint& server_endpoint, const std::size_t clients_count) {
+    boost::asio::io_context client_context;
+
+    for (std::size_t i { 0 }; i < clients_count; i++) {
+        boost::beast::websocket::stream<boost::asio::ip::tcp::socket> client { client_context };
+
+        client.next_layer().connect(server_endpoint);
+        client.handshake("localhost", "/");
+        // Closed with RST so client ports aren't exhausted by TIME_WAIT sockets
+        client.next_layer().set_option(boost::asio::socket_base::linger { true, 0 });
+    }
+}
+
+
+/**
+ * @brief Connects clients to a backend with given count of acceptors and of pending accepts for each acceptor
+ *
+ * Each connection is accepted then handshaked with Websocket by server, so items processed per second is the
+ * connection rate server can sustain.
+ */
+void AcceptConnections(benchmark::State& state) {
+    const RunningBackend server {
+        AcceptOptions { static_cast<std::size_t>(state.range(0)), static_cast<std::size_t>(state.range(1)) }
+    };
+
+    for (auto _ : state) {
+        std::vector<std::thread> client_threads;
+        client_threads.reserve(CLIENT_THREADS_COUNT);
+
+        for (std::size_t i { 0 }; i < CLIENT_THREADS_COUNT; i++)
+            client_threads.emplace_back(connectClients, server.endpoint(), CONNECTIONS_PER_THREAD);
+
+        for (std::thread& client_thread : client_threads)
+            client_thread.join();
+    }
+
+    state.SetItemsProcessed(state.iterations() * CLIENT_THREADS_COUNT * CONNECTIONS_PER_THREAD);
+}
+
+
+BENCHMARK(AcceptConnections)
+    ->ArgNames({ "acceptors", "pending" })
+    ->Args({ 1, 1 })->Args({ 1, 4 })->Args({ 2, 4 })->Args({ 4, 4 })
+    ->UseRealTime()->Unit(benchmark::kMillisecond);
@@ -0,0 +1,93 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdio>
+#include <RpT-Config/Config.hpp>
+#include <RpT-Utils/LoggerView.hpp>
+
+#if RPT_RUNTIME_PLATFORM == RPT_RUNTIME_UNIX
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+
+using namespace RpT::Utils;
+
+
+/**
+ * @brief Redirects standard output to null device during its lifetime, so messages logged by benchmarks aren't mixed
+ * with benchmark results
+ *
+ * @note Has no effect on platforms other than Unix.
+ */
+class SilencedStdout {
+private:
+    int saved_stdout_;
+
+public:
+    SilencedStdout() : saved_stdout_ { -1 } {
+#if RPT_RUNTIME_PLATFORM == RPT_RUNTIME_UNIX
+        std::fflush(stdout); // Benchmark results printed so far must not be discarded
+
+        const int null_device { open("/dev/null", O_WRONLY) };
+        if (null_device == -1)
+            return;
+
+        saved_stdout_ = dup(STDOUT_FILENO);
+        dup2(null_device, STDOUT_FILENO);
+        close(null_device);
+#endif
+    }
+
+    SilencedStdout(const SilencedStdout&) = delete;
+    SilencedStdout& operator=(const SilencedStdout&) = delete;
+
+    ~SilencedStdout() {
+#if RPT_RUNTIME_PLATFORM == RPT_RUNTIME_UNIX
+        if (saved_stdout_ == -1)
+            return;
+
+        std::fflush(stdout); // Logged messages still buffered must be discarded too
+
+        dup2(saved_stdout_, STDOUT_FILENO);
+        close(saved_stdout_);
+#endif
+    }
+};
+
+
+/// Logs a message with level lower than context logging level, as trace messages are for a server in production
+void LogBelowLevel(benchmark::State& state) {
+    LoggingContext context { LogLevel::INFO };
+    LoggerView logger { "Benchmark", context };
+
+    for (auto _ : state)
+        logger.trace("Handling SR command from \"{}\": {}", 42, "REQUEST 1 Chat Hello world!");
+}
+
+/// Logs a message while logging is disabled inside context, as unit tests and most benchmarks do
+void LogDisabledContext(benchmark::State& state) {
+    LoggingContext context { LogLevel::TRACE };
+    context.disable();
+    LoggerView logger { "Benchmark", context };
+
+    for (auto _ : state)
+        logger.info("Handling SR command from \"{}\": {}", 42, "REQUEST 1 Chat Hello world!");
+}
+
+/// Logs a message which is actually formatted and written to console and log file sinks
+void LogEnabled(benchmark::State& state) {
+    LoggingContext context { LogLevel::INFO };
+    LoggerView logger { "Benchmark", context };
+
+    const SilencedStdout silenced_stdout;
+    for (auto _ : state)
+        logger.info("Handling SR command from \"{}\": {}", 42, "REQUEST 1 Chat Hello world!");
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+
+BENCHMARK(LogBelowLevel);
+BENCHMARK(LogDisabledContext);
+// Fixed iterations count, so log file size doesn't depend on logging speed
+BENCHMARK(LogEnabled)->Iterations(100000);
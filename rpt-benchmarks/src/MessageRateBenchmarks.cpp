@@ -0,0 +1,199 @@
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <csignal>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+#include <RpT-Network/LengthPrefixedTcpBackend.hpp>
+#include <RpT-Network/UnsafeBeastWebsocketBackend.hpp>
+
+
+using namespace RpT::Network;
+
+
+/// Clients sending messages concurrently, each one from its own thread
+constexpr std::size_t CLIENTS_COUNT { 4 };
+/// Service Requests sent by each client for one iteration
+constexpr std::size_t MESSAGES_PER_CLIENT { 2000 };
+/// Typical Service Request, as sent by a chat service client
+constexpr std::string_view SERVICE_MESSAGE { "SERVICE REQUEST 1 Chat Hello everyone, how are you doing?" };
+
+
+/**
+ * @brief Backend listening on an ephemeral loopback port, with main loop ran by its own thread and discarding every
+ * input event
+ *
+ * Backend is stopped at destruction with `SIGTERM`, as a running server is.
+ *
+ * @tparam Backend `BeastWebsocketBackendBase` implementation to run
+ */
+template<typename Backend>
+class ServingBackend {
+private:
+    // Clients disconnections aren't logged, as they would be for each iteration
+    RpT::Utils::LoggingContext logging_;
+    Backend backend_;
+    std::thread main_loop_;
+
+public:
+    /// Constructs backend with given arguments following local endpoint and logging context
+    template<typename... BackendArgs>
+    explicit ServingBackend(BackendArgs&&... backend_args)
+    : logging_ { RpT::Utils::LogLevel::FATAL },
+    backend_ {
+        boost::asio::ip::tcp::endpoint { boost::asio::ip::address_v4::loopback(), 0 }, logging_,
+        std::forward<BackendArgs>(backend_args)...
+    },
+    main_loop_ { [this]() {
+        while (!backend_.closed())
+            backend_.waitForInput();
+    } } {}
+
+    /// Stops backend from its main loop then waits for main loop to return
+    ~ServingBackend() {
+        std::raise(SIGTERM);
+        main_loop_.join();
+    }
+
+    /// Retrieves endpoint for clients to connect to
+    const boost::asio::ip::tcp::endpoint& endpoint() const {
+        return backend_.localEndpoint();
+    }
+};
+
+
+/// Formats login, Service Requests then logout messages for given actor, with given framing for each message
+template<typename Framing>
+std::string clientSession(const std::size_t actor_uid, Framing&& framing) {
+    std::string session { framing("LOGIN " + std::to_string(actor_uid) + " Client" + std::to_string(actor_uid)) };
+
+    for (std::size_t i { 0 }; i < MESSAGES_PER_CLIENT; i++)
+        session += framing(SERVICE_MESSAGE);
+
+    session += framing("LOGOUT");
+
+    return session;
+}
+
+/// Frames given message as a Websocket text frame, masked with null key so it is pre-formatted once
+std::string websocketFrame(const std::string_view message) {
+    std::string frame { static_cast<char>(0x81) }; // Final text frame
+
+    if (message.size() < 126) {
+        frame += static_cast<char>(0x80 | message.size());
+    } else {
+        frame += static_cast<char>(0x80 | 126);
+        frame += static_cast<char>(message.size() >> 8);
+        frame += static_cast<char>(message.size());
+    }
+
+    frame.append(4, '\0'); // Null masking key, payload is unchanged
+
+    return frame.append(message);
+}
+
+/// Prefixes given message by its size, as read by `LengthPrefixedStream`
+std::string prefixedMessage(const std::string_view message) {
+    const auto size { static_cast<std::uint32_t>(message.size()) };
+    std::string prefixed {
+        static_cast<char>(size >> 24), static_cast<char>(size >> 16),
+        static_cast<char>(size >> 8), static_cast<char>(size)
+    };
+
+    return prefixed.append(message);
+}
+
+/// Logs in, sends pre-formatted Service Requests then logs out from Websocket client, waiting for interrupt message
+void runWebsocketClient(const boost::asio::ip::tcp::endpoint& server_endpoint, const std::string& session) {
+    boost::asio::io_context client_context;
+    boost::beast::websocket::stream<boost::asio::ip::tcp::socket> client { client_context };
+
+    client.next_layer().connect(server_endpoint);
+    client.handshake("localhost", "/");
+    // Frames are written raw, so client framing cost isn't measured
+    boost::asio::write(client.next_layer(), boost::asio::buffer(session));
+
+    boost::beast::flat_buffer received_message;
+    boost::system::error_code err;
+    // Every message has been handled once logout interrupt is received, then server closes connection
+    while (!err) {
+        client.read(received_message, err);
+        received_message.consume(received_message.size());
+    }
+}
+
+/// Logs in, sends pre-formatted Service Requests then logs out from TCP client, waiting for server to close connection
+void runTcpClient(const boost::asio::ip::tcp::endpoint& server_endpoint, const std::string& session) {
+    boost::asio::io_context client_context;
+    boost::asio::ip::tcp::socket client { client_context };
+
+    client.connect(server_endpoint);
+    boost::asio::write(client, boost::asio::buffer(session));
+
+    std::array<char, 4096> received_data;
+    boost::system::error_code err;
+    // Every message has been handled once logout interrupt is received, then server closes connection
+    while (!err)
+        client.read_some(boost::asio::buffer(received_data), err);
+}
+
+/// Runs each client session concurrently with given client function, then waits for every session to be done
+template<typename Client>
+void runClients(const boost::asio::ip::tcp::endpoint& server_endpoint, const std::vector<std::string>& sessions,
+                Client&& client) {
+
+    std::vector<std::thread> client_threads;
+    client_threads.reserve(sessions.size());
+
+    for (const std::string& session : sessions)
+        client_threads.emplace_back(client, server_endpoint, std::cref(session));
+
+    for (std::thread& client_thread : client_threads)
+        client_thread.join();
+}
+
+
+/**
+ * @brief Sends Service Requests from Websocket clients to a backend running clients IO operations inside main loop
+ *
+ * As backend uses a single thread, items processed per second is messages received per second for one core.
+ */
+void UnsafeWebsocketMessages(benchmark::State& state) {
+    const ServingBackend<UnsafeBeastWebsocketBackend> server;
+
+    std::vector<std::string> sessions;
+    for (std::size_t i { 0 }; i < CLIENTS_COUNT; i++)
+        sessions.push_back(clientSession(i, websocketFrame));
+
+    for (auto _ : state)
+        runClients(server.endpoint(), sessions, runWebsocketClient);
+
+    state.SetItemsProcessed(state.iterations() * CLIENTS_COUNT * MESSAGES_PER_CLIENT);
+}
+
+/**
+ * @brief Sends Service Requests from length-prefixed TCP clients to a backend running clients IO operations inside
+ * main loop
+ *
+ * As backend uses a single thread, items processed per second is messages received per second for one core.
+ */
+void LengthPrefixedTcpMessages(benchmark::State& state) {
+    const ServingBackend<LengthPrefixedTcpBackend> server;
+
+    std::vector<std::string> sessions;
+    for (std::size_t i { 0 }; i < CLIENTS_COUNT; i++)
+        sessions.push_back(clientSession(i, prefixedMessage));
+
+    for (auto _ : state)
+        runClients(server.endpoint(), sessions, runTcpClient);
+
+    state.SetItemsProcessed(state.iterations() * CLIENTS_COUNT * MESSAGES_PER_CLIENT);
+}
+
+
+BENCHMARK(UnsafeWebsocketMessages)->UseRealTime()->Unit(benchmark::kMillisecond);
+BENCHMARK(LengthPrefixedTcpMessages)->UseRealTime()->Unit(benchmark::kMillisecond);
@@ -0,0 +1,220 @@
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <unordered_map>
+#include <RpT-Network/NetworkBackend.hpp>
+
+
+using namespace RpT::Network;
+
+
+/**
+ * @brief `NetworkBackend` implementation dropping every flushed message, so only RPTL protocol and queuing
+ * operations are measured
+ */
+class DroppingNetworkBackend : public NetworkBackend {
+private:
+    std::size_t flushed_messages_count_;
+    std::uint64_t newcomer_token_;
+
+protected:
+    /// Counts then drops flushed messages
+    void syncClient(const std::uint64_t,
+                    std::queue<std::shared_ptr<std::string>> flushed_messages_queue) override {
+
+        flushed_messages_count_ += flushed_messages_queue.size();
+    }
+
+    /// Never called as benchmarks don't wait for input
+    void waitForEvent() override {
+        pushInputEvent(RpT::Core::NoneEvent { 0 });
+    }
+
+public:
+    /// Registers given count of clients, client token `i` owning actor `i` named `Player_i`, then adds an unregistered
+    /// newcomer client using token `clients_count`
+    explicit DroppingNetworkBackend(const std::uint64_t clients_count)
+    : flushed_messages_count_ { 0 }, newcomer_token_ { clients_count } {
+        for (std::uint64_t client_token { 0 }; client_token < clients_count; client_token++) {
+            addClient(client_token);
+            handleMessage(client_token,
+                          "LOGIN " + std::to_string(client_token) + " Player_" + std::to_string(client_token));
+
+            synchronize(); // Drops registration messages so queues don't grow with logged in players count
+        }
+
+        addClient(newcomer_token_);
+    }
+
+    /// Retrieves token for unregistered newcomer client
+    std::uint64_t newcomer() const {
+        return newcomer_token_;
+    }
+
+    /// Trivial access to synchronize() for benchmarking purpose
+    void sync() {
+        synchronize();
+    }
+
+    /// Trivial access to handleMessage() for benchmarking purpose, triggered event is discarded
+    RpT::Core::AnyInputEvent clientMessage(const std::uint64_t client_token, const std::string_view rptl_message) {
+        return handleMessage(client_token, rptl_message);
+    }
+
+    /// Trivial access to formatRegistrationMessage() for benchmarking purpose
+    const std::string& registrationMessage() {
+        return formatRegistrationMessage();
+    }
+
+    /// Removes dead newcomer client then adds it again, reusing its slot with a new token, so it can perform another
+    /// handshake
+    void reconnectNewcomer() {
+        pollDeadClients(); // Not listened by benchmarks, keeps dead clients list from growing
+        removeClient(newcomer_token_);
+
+        newcomer_token_ = nextClientToken();
+        addClient(newcomer_token_);
+    }
+
+    /// Retrieves count of messages flushed to any client since construction
+    std::size_t flushedMessagesCount() const {
+        return flushed_messages_count_;
+    }
+};
+
+
+/// Backends are expensive to build with many logged in clients, so one backend is built per clients count
+DroppingNetworkBackend& backendWith(const std::uint64_t clients_count) {
+    static std::unordered_map<std::uint64_t, std::unique_ptr<DroppingNetworkBackend>> backends;
+
+    std::unique_ptr<DroppingNetworkBackend>& backend { backends[clients_count] };
+    if (!backend)
+        backend = std::make_unique<DroppingNetworkBackend>(clients_count);
+
+    return *backend;
+}
+
+
+/// Broadcasts a Service Event to every registered client then flushes their queues, as main loop does
+void BroadcastThenSynchronize(benchmark::State& state) {
+    const auto clients_count { static_cast<std::uint64_t>(state.range(0)) };
+    DroppingNetworkBackend& backend { backendWith(clients_count) };
+
+    for (auto _ : state) {
+        backend.outputEvent("EVENT Chat MESSAGE_FROM 0 Hello world!");
+        backend.sync();
+    }
+
+    benchmark::DoNotOptimize(backend.flushedMessagesCount());
+    // One message delivered to each client per iteration
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+/// Synchronizes clients without any queued message, as main loop does for each input event without output
+void SynchronizeIdle(benchmark::State& state) {
+    const auto clients_count { static_cast<std::uint64_t>(state.range(0)) };
+    DroppingNetworkBackend& backend { backendWith(clients_count) };
+
+    for (auto _ : state)
+        backend.sync();
+
+    benchmark::DoNotOptimize(backend.flushedMessagesCount());
+}
+
+
+/// Logs in given count of actors back-to-back into a new backend, as a join storm after server restart would do
+void LoginActors(benchmark::State& state) {
+    const auto clients_count { static_cast<std::uint64_t>(state.range(0)) };
+
+    for (auto _ : state) {
+        const DroppingNetworkBackend backend { clients_count };
+
+        benchmark::DoNotOptimize(backend.flushedMessagesCount());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+/// Logs out every actor of a new backend back-to-back, as a disconnection storm after a network failure would do
+void LogoutActors(benchmark::State& state) {
+    const auto clients_count { static_cast<std::uint64_t>(state.range(0)) };
+
+    for (auto _ : state) {
+        state.PauseTiming(); // Only logouts are measured
+        auto backend { std::make_unique<DroppingNetworkBackend>(clients_count) };
+        state.ResumeTiming();
+
+        for (std::uint64_t client_token { 0 }; client_token < clients_count; client_token++)
+            benchmark::DoNotOptimize(backend->clientMessage(client_token, "LOGOUT"));
+
+        backend->sync();
+
+        state.PauseTiming(); // Backend destruction isn't measured either
+        backend.reset();
+        state.ResumeTiming();
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+/// Handles handshake with an unavailable actor name, which is checked against every registered actor
+void RejectDuplicateLogin(benchmark::State& state) {
+    const auto clients_count { static_cast<std::uint64_t>(state.range(0)) };
+    DroppingNetworkBackend& backend { backendWith(clients_count) };
+
+    // Name used by the first registered actor, with an available UID
+    const std::string rptl_message { "LOGIN " + std::to_string(clients_count) + " Player_0" };
+
+    for (auto _ : state) {
+        try {
+            backend.clientMessage(backend.newcomer(), rptl_message);
+            state.SkipWithError("Duplicate actor name accepted");
+        } catch (const InternalError&) {} // Expected as name is unavailable
+    }
+}
+
+/// Logs in then out an actor inside a lobby with given count of actors, so it is synced with registration snapshot
+void JoinThenLeave(benchmark::State& state) {
+    const auto clients_count { static_cast<std::uint64_t>(state.range(0)) };
+    DroppingNetworkBackend& backend { backendWith(clients_count) };
+
+    const std::string rptl_handshake { "LOGIN " + std::to_string(clients_count) + " Newcomer" };
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(backend.clientMessage(backend.newcomer(), rptl_handshake));
+        benchmark::DoNotOptimize(backend.clientMessage(backend.newcomer(), "LOGOUT"));
+        backend.sync();
+        backend.reconnectNewcomer();
+    }
+}
+
+/// Handles a Service Request command sent by a registered client, as received from a chat flood
+void HandleServiceRequest(benchmark::State& state) {
+    DroppingNetworkBackend& backend { backendWith(1) };
+    const std::string_view rptl_message { "SERVICE REQUEST 42 Chat Hello world, this is a chat message!" };
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(backend.clientMessage(0, rptl_message));
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+/// Formats registration snapshot sent to each newly logged in client, listing every registered actor
+void FormatRegistrationMessage(benchmark::State& state) {
+    DroppingNetworkBackend& backend { backendWith(static_cast<std::uint64_t>(state.range(0))) };
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(backend.registrationMessage());
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+
+BENCHMARK(BroadcastThenSynchronize)->Arg(100)->Arg(1000)->Arg(10000);
+BENCHMARK(SynchronizeIdle)->Arg(100)->Arg(1000)->Arg(10000);
+BENCHMARK(HandleServiceRequest);
+BENCHMARK(RejectDuplicateLogin)->Arg(100)->Arg(1000)->Arg(10000);
+BENCHMARK(JoinThenLeave)->Arg(100)->Arg(1000)->Arg(10000);
+BENCHMARK(FormatRegistrationMessage)->Arg(100)->Arg(1000)->Arg(10000);
+BENCHMARK(LoginActors)->Arg(1000)->Arg(10000)->Unit(benchmark::kMillisecond);
+BENCHMARK(LogoutActors)->Arg(1000)->Arg(10000)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,223 @@
+#include <benchmark/benchmark.h>
+
+#include <csignal>
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <RpT-Network/LengthPrefixedTcpBackend.hpp>
+#include <RpT-Network/UnixLengthPrefixedBackend.hpp>
+#include <RpT-Network/UnixWebsocketBackend.hpp>
+#include <RpT-Network/UnsafeBeastWebsocketBackend.hpp>
+
+
+using namespace RpT::Network;
+
+
+/// Typical Service Request, as sent by a chat service client
+constexpr std::string_view SERVICE_MESSAGE { "SERVICE REQUEST 1 Chat Hello everyone, how are you doing?" };
+
+
+/**
+ * @brief Backend with main loop ran by its own thread, replying to each Service Request with the request itself
+ *
+ * Backend is stopped at destruction with `SIGTERM`, as a running server is.
+ *
+ * @tparam Backend `BeastWebsocketBackendBase` implementation to run
+ */
+template<typename Backend>
+class EchoingBackend {
+private:
+    RpT::Utils::LoggingContext logging_;
+    Backend backend_;
+    std::thread main_loop_;
+
+public:
+    /// Constructs backend listening on given local endpoint, with default options
+    template<typename Endpoint>
+    explicit EchoingBackend(const Endpoint& local_endpoint)
+    : logging_ { RpT::Utils::LogLevel::FATAL }, backend_ { local_endpoint, logging_ },
+    main_loop_ { [this]() {
+        while (!backend_.closed()) {
+            const RpT::Core::AnyInputEvent input_event { backend_.waitForInput() };
+
+            // Reply is flushed to client by next waitForInput() call, as Executor does
+            if (const auto* service_request { boost::get<RpT::Core::ServiceRequestEvent>(&input_event) })
+                backend_.replyTo(service_request->actor(), std::string { service_request->serviceRequest() });
+        }
+    } } {}
+
+    /// Stops backend from its main loop then waits for main loop to return
+    ~EchoingBackend() {
+        std::raise(SIGTERM);
+        main_loop_.join();
+    }
+
+    /// Retrieves endpoint for clients to connect to
+    const auto& endpoint() const {
+        return backend_.localEndpoint();
+    }
+};
+
+
+/**
+ * @brief Websocket client sending and receiving one message at a time
+ *
+ * @tparam Socket Either a TCP or a Unix domain socket
+ */
+template<typename Socket>
+class WebsocketClient {
+private:
+    boost::beast::websocket::stream<Socket> stream_;
+    boost::beast::flat_buffer received_message_;
+
+public:
+    /// Connects and performs Websocket handshake with server listening on given endpoint
+    WebsocketClient(boost::asio::io_context& client_context, const typename Socket::endpoint_type& server_endpoint)
+    : stream_ { client_context } {
+        stream_.next_layer().connect(server_endpoint);
+
+        if constexpr (std::is_same_v<Socket, boost::asio::ip::tcp::socket>)
+            stream_.next_layer().set_option(boost::asio::ip::tcp::no_delay { true });
+
+        stream_.handshake("localhost", "/");
+        stream_.text(true);
+    }
+
+    /// Sends given message inside one Websocket frame
+    void send(const std::string_view message) {
+        stream_.write(boost::asio::buffer(message));
+    }
+
+    /// Waits for next message from server
+    std::string receive() {
+        received_message_.consume(received_message_.size());
+        stream_.read(received_message_);
+
+        return boost::beast::buffers_to_string(received_message_.data());
+    }
+};
+
+/**
+ * @brief Length-prefixed messages client sending and receiving one message at a time
+ *
+ * @tparam Socket Either a TCP or a Unix domain socket
+ */
+template<typename Socket>
+class PrefixedClient {
+private:
+    Socket socket_;
+
+public:
+    /// Connects to server listening on given endpoint
+    PrefixedClient(boost::asio::io_context& client_context, const typename Socket::endpoint_type& server_endpoint)
+    : socket_ { client_context } {
+        socket_.connect(server_endpoint);
+
+        if constexpr (std::is_same_v<Socket, boost::asio::ip::tcp::socket>)
+            socket_.set_option(boost::asio::ip::tcp::no_delay { true });
+    }
+
+    /// Sends given message prefixed by its size within one write
+    void send(const std::string_view message) {
+        const auto size { static_cast<std::uint32_t>(message.size()) };
+        std::string prefixed_message {
+            static_cast<char>(size >> 24), static_cast<char>(size >> 16),
+            static_cast<char>(size >> 8), static_cast<char>(size)
+        };
+
+        boost::asio::write(socket_, boost::asio::buffer(prefixed_message.append(message)));
+    }
+
+    /// Waits for next message from server
+    std::string receive() {
+        std::array<unsigned char, 4> prefix;
+        boost::asio::read(socket_, boost::asio::buffer(prefix));
+
+        std::string message(static_cast<std::size_t>(prefix[0]) << 24 | prefix[1] << 16 | prefix[2] << 8 | prefix[3],
+                            '\0');
+        boost::asio::read(socket_, boost::asio::buffer(message));
+
+        return message;
+    }
+};
+
+
+/// Receives messages from given client until a Service message is received
+template<typename Client>
+void receiveServiceMessage(Client& client) {
+    while (client.receive().rfind("SERVICE ", 0) != 0);
+}
+
+/**
+ * @brief Logs in with one client to an echoing backend listening on given endpoint, then measures time from each
+ * Service Request being sent to its reply being received
+ *
+ * Only one client is connected, so it is the latency for an idle server.
+ *
+ * @tparam Backend `BeastWebsocketBackendBase` implementation to reply to client
+ * @tparam Client Client type for backend framing
+ */
+template<typename Backend, typename Client, typename Endpoint>
+void runRoundTrips(benchmark::State& state, const Endpoint& local_endpoint) {
+    const EchoingBackend<Backend> server { local_endpoint };
+
+    boost::asio::io_context client_context;
+    Client client { client_context, server.endpoint() };
+
+    // Registration and login broadcast are received before first reply
+    client.send("LOGIN 0 Client");
+    client.send(SERVICE_MESSAGE);
+    receiveServiceMessage(client);
+
+    for (auto _ : state) {
+        client.send(SERVICE_MESSAGE);
+        receiveServiceMessage(client);
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+/// Loopback endpoint with ephemeral port
+boost::asio::ip::tcp::endpoint loopbackEndpoint() {
+    return { boost::asio::ip::address_v4::loopback(), 0 };
+}
+
+/// Socket file inside temporary directory, replaced if left by a previous run
+boost::asio::local::stream_protocol::endpoint unixSocketEndpoint() {
+    return boost::asio::local::stream_protocol::endpoint {
+        (std::filesystem::temp_directory_path() / "rpt-round-trip-benchmarks.sock").string()
+    };
+}
+
+
+/// Websocket messages over loopback TCP, reference for Unix domain socket backends latency
+void UnsafeWebsocketRoundTrip(benchmark::State& state) {
+    runRoundTrips<UnsafeBeastWebsocketBackend, WebsocketClient<boost::asio::ip::tcp::socket>>(
+            state, loopbackEndpoint());
+}
+
+/// Websocket messages over Unix domain socket, as forwarded by a TLS terminating sidecar
+void UnixWebsocketRoundTrip(benchmark::State& state) {
+    runRoundTrips<UnixWebsocketBackend, WebsocketClient<boost::asio::local::stream_protocol::socket>>(
+            state, unixSocketEndpoint());
+}
+
+/// Length-prefixed messages over loopback TCP
+void LengthPrefixedTcpRoundTrip(benchmark::State& state) {
+    runRoundTrips<LengthPrefixedTcpBackend, PrefixedClient<boost::asio::ip::tcp::socket>>(
+            state, loopbackEndpoint());
+}
+
+/// Length-prefixed messages over Unix domain socket, as forwarded by a sidecar terminating TLS and Websocket
+void UnixLengthPrefixedRoundTrip(benchmark::State& state) {
+    runRoundTrips<UnixLengthPrefixedBackend, PrefixedClient<boost::asio::local::stream_protocol::socket>>(
+            state, unixSocketEndpoint());
+}
+
+
+BENCHMARK(UnsafeWebsocketRoundTrip)->UseRealTime()->Unit(benchmark::kMicrosecond);
+BENCHMARK(UnixWebsocketRoundTrip)->UseRealTime()->Unit(benchmark::kMicrosecond);
+BENCHMARK(LengthPrefixedTcpRoundTrip)->UseRealTime()->Unit(benchmark::kMicrosecond);
+BENCHMARK(UnixLengthPrefixedRoundTrip)->UseRealTime()->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,152 @@
+#include <benchmark/benchmark.h>
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+#include <RpT-Core/ServiceEventRequestProtocol.hpp>
+
+
+using namespace RpT::Core;
+
+
+/**
+ * @brief Service named `Service<i>` accepting any command without emitting event, events are emitted only on
+ * benchmark demand
+ */
+class DummyService : public Service {
+private:
+    std::string name_;
+
+public:
+    DummyService(ServiceContext& run_context, const std::size_t i)
+    : Service { run_context }, name_ { "Service" + std::to_string(i) } {}
+
+    std::string_view name() const override {
+        return name_;
+    }
+
+    /// Accepts any command
+    RpT::Utils::HandlingResult handleRequestCommand(const std::uint64_t, const std::string_view) override {
+        return {};
+    }
+
+    /// Trivial access to emitEvent() for benchmarking purpose
+    void emit(std::string event_command) {
+        emitEvent(std::move(event_command));
+    }
+};
+
+
+/**
+ * @brief SER Protocol running given count of `DummyService`, with logging disabled by context
+ */
+class DummyServicesProtocol {
+private:
+    RpT::Utils::LoggingContext logging_;
+    ServiceContext context_;
+    std::vector<std::unique_ptr<DummyService>> services_;
+    std::unique_ptr<ServiceEventRequestProtocol> ser_protocol_;
+
+public:
+    explicit DummyServicesProtocol(const std::size_t services_count) {
+        logging_.disable();
+
+        std::vector<std::reference_wrapper<Service>> running_services;
+        for (std::size_t i { 0 }; i < services_count; i++) {
+            services_.push_back(std::make_unique<DummyService>(context_, i));
+            running_services.emplace_back(*services_.back());
+        }
+
+        ser_protocol_ = std::make_unique<ServiceEventRequestProtocol>(running_services, logging_);
+    }
+
+    /// Retrieves service `Service<i>`
+    DummyService& service(const std::size_t i) {
+        return *services_.at(i);
+    }
+
+    /// Retrieves SER Protocol running every service
+    ServiceEventRequestProtocol& protocol() {
+        return *ser_protocol_;
+    }
+};
+
+
+/// Handles a SR command intended to the last registered service, among given count of services
+void HandleServiceRequest(benchmark::State& state) {
+    const auto services_count { static_cast<std::size_t>(state.range(0)) };
+    DummyServicesProtocol ser { services_count };
+
+    const std::string sr_command {
+        "REQUEST 42 Service" + std::to_string(services_count - 1) + " Hello world, this is a chat message!"
+    };
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(ser.protocol().handleServiceRequest(0, sr_command));
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+/// Handles an already decoded SR intended to the last registered service, among given count of services
+void HandleDecodedServiceRequest(benchmark::State& state) {
+    const auto services_count { static_cast<std::size_t>(state.range(0)) };
+    DummyServicesProtocol ser { services_count };
+
+    const std::string service_name { "Service" + std::to_string(services_count - 1) };
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(
+                ser.protocol().handleServiceRequest(0, 42, service_name, "Hello world, this is a chat message!"));
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+/// Polls Service Event while no service emitted any, as main loop does after each handled input event
+void PollServiceEventIdle(benchmark::State& state) {
+    DummyServicesProtocol ser { static_cast<std::size_t>(state.range(0)) };
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(ser.protocol().pollServiceEvent());
+}
+
+/// Polls Service Events emitted by the last registered service only, among given count of idle services
+void PollServiceEventSingleEmitter(benchmark::State& state) {
+    const auto services_count { static_cast<std::size_t>(state.range(0)) };
+    DummyServicesProtocol ser { services_count };
+    DummyService& emitter { ser.service(services_count - 1) };
+
+    for (auto _ : state) {
+        emitter.emit("MESSAGE_FROM 0 Hello world!");
+
+        benchmark::DoNotOptimize(ser.protocol().pollServiceEvent());
+        benchmark::DoNotOptimize(ser.protocol().pollServiceEvent()); // Until no more event, as main loop does
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+/// Polls one Service Event emitted by each of given count of services, in emission order
+void PollServiceEventAllEmitters(benchmark::State& state) {
+    const auto services_count { static_cast<std::size_t>(state.range(0)) };
+    DummyServicesProtocol ser { services_count };
+
+    for (auto _ : state) {
+        state.PauseTiming(); // Only polling is measured
+        for (std::size_t i { 0 }; i < services_count; i++)
+            ser.service(i).emit("MESSAGE_FROM 0 Hello world!");
+        state.ResumeTiming();
+
+        while (ser.protocol().pollServiceEvent().has_value()) {}
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+
+BENCHMARK(HandleServiceRequest)->Arg(1)->Arg(10)->Arg(100)->Arg(1000);
+BENCHMARK(HandleDecodedServiceRequest)->Arg(1)->Arg(10)->Arg(100)->Arg(1000);
+BENCHMARK(PollServiceEventIdle)->Arg(1)->Arg(10)->Arg(100)->Arg(1000);
+BENCHMARK(PollServiceEventSingleEmitter)->Arg(1)->Arg(10)->Arg(100)->Arg(1000);
+BENCHMARK(PollServiceEventAllEmitters)->Arg(1)->Arg(10)->Arg(100)->Arg(1000);
@@ -0,0 +1,77 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <string_view>
+#include <RpT-Utils/TextProtocolParser.hpp>
+
+
+using namespace RpT::Utils;
+
+
+/// Typical SR command, as parsed by SER Protocol for each Service Request received from a client
+constexpr std::string_view SR_COMMAND { "REQUEST 42 Chat Hello world, this is a chat message!" };
+
+
+/**
+ * @brief Parser expecting a given count of words, giving access to parsed and unparsed words for benchmarking purpose
+ */
+class WordsParser : public TextProtocolParser {
+public:
+    WordsParser(const std::string_view protocol_command, const unsigned int expected_words)
+    : TextProtocolParser { protocol_command, expected_words } {}
+
+    /// Trivial access to getParsedWord() for benchmarking purpose
+    std::string_view word(const std::size_t i) const {
+        return getParsedWord(i);
+    }
+
+    /// Trivial access to unparsedWords() for benchmarking purpose
+    std::string_view remaining() const {
+        return unparsedWords();
+    }
+};
+
+
+/// Parses prefix, RUID and service name of a SR command, as SER Protocol does
+void ParseServiceRequest(benchmark::State& state) {
+    for (auto _ : state) {
+        const WordsParser parser { SR_COMMAND, 3 };
+
+        benchmark::DoNotOptimize(parser.word(2));
+        benchmark::DoNotOptimize(parser.remaining());
+    }
+
+    state.SetBytesProcessed(state.iterations() * SR_COMMAND.size());
+}
+
+/// Parses given count of words from a command made of 64 words, remaining ones staying unparsed
+void ParseWords(benchmark::State& state) {
+    const auto expected_words { static_cast<unsigned int>(state.range(0)) };
+
+    std::string command;
+    for (int i { 0 }; i < 64; i++)
+        command += "word_" + std::to_string(i) + ' ';
+
+    for (auto _ : state) {
+        const WordsParser parser { command, expected_words };
+
+        benchmark::DoNotOptimize(parser.remaining());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+/// Parses a command which doesn't contain enough words, as a malformed client message would
+void RejectMissingWords(benchmark::State& state) {
+    for (auto _ : state) {
+        try {
+            const WordsParser parser { "REQUEST 42", 3 };
+            state.SkipWithError("Missing word accepted");
+        } catch (const NotEnoughWords&) {} // Expected as service name is missing
+    }
+}
+
+
+BENCHMARK(ParseServiceRequest);
+BENCHMARK(ParseWords)->Arg(1)->Arg(4)->Arg(16)->Arg(64);
+BENCHMARK(RejectMissingWords);
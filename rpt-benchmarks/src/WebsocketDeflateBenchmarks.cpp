@@ -0,0 +1,114 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <vector>
+#include <boost/beast/zlib/deflate_stream.hpp>
+
+
+/// Compression level used by Beast permessage-deflate extension by default
+constexpr int BEAST_COMPRESSION_LEVEL { 8 };
+/// Trailing bytes removed by permessage-deflate from each compressed message
+constexpr std::size_t DEFLATE_TRAILER_SIZE { 4 };
+
+
+/**
+ * @brief Generates RPTL traffic received by a client during a chat-heavy session, always the same for each call
+ *
+ * Traffic begins with a registration snapshot for 100 actors, then actors logging in and out, and chat Service
+ * Events.
+ */
+std::vector<std::string> recordedTraffic() {
+    constexpr std::size_t ACTORS_COUNT { 100 };
+    constexpr std::size_t CHAT_MESSAGES_COUNT { 1000 };
+
+    const std::vector<std::string> chat_messages {
+        "Hello everyone!", "Is anybody there?", "Let's go to the tavern", "I need a healer",
+        "Who wants to join my party for the dungeon tonight?", "gg", "brb", "The dragon is at the north gate!",
+        "Does anyone know where the blacksmith is?", "lol"
+    };
+
+    std::vector<std::string> traffic;
+
+    std::string registration_message { "REGISTRATION" };
+    for (std::size_t actor { 0 }; actor < ACTORS_COUNT; actor++)
+        registration_message += ' ' + std::to_string(actor) + " Player_" + std::to_string(actor);
+
+    traffic.push_back(std::move(registration_message));
+
+    for (std::size_t i { 0 }; i < CHAT_MESSAGES_COUNT; i++) {
+        const std::string author { std::to_string((i * 37) % ACTORS_COUNT) };
+
+        if (i % 100 == 0) // Sometimes, an actor is leaving then joining again
+            traffic.push_back("LOGGED_OUT " + author);
+        else if (i % 100 == 1)
+            traffic.push_back("LOGGED_IN " + author + " Player_" + author);
+
+        traffic.push_back("SERVICE EVENT Chat MESSAGE_FROM " + author + ' ' + chat_messages[(i * 7) % 10]);
+    }
+
+    return traffic;
+}
+
+
+/**
+ * @brief Compresses recorded traffic message by message, as permessage-deflate does with context takeover
+ *
+ * Arguments are window bits, memory level and minimum size for a message to be compressed. Counters report sent
+ * bytes ratio compared with uncompressed traffic.
+ */
+void DeflateRecordedTraffic(benchmark::State& state) {
+    const auto window_bits { static_cast<int>(state.range(0)) };
+    const auto mem_level { static_cast<int>(state.range(1)) };
+    const auto min_message_size { static_cast<std::size_t>(state.range(2)) };
+
+    const std::vector<std::string> traffic { recordedTraffic() };
+    std::vector<std::uint8_t> output_buffer;
+
+    std::size_t raw_bytes { 0 };
+    std::size_t sent_bytes { 0 };
+
+    for (auto _ : state) {
+        // Each iteration is a new client connection, with its own compression context
+        boost::beast::zlib::deflate_stream deflater;
+        deflater.reset(BEAST_COMPRESSION_LEVEL, window_bits, mem_level, boost::beast::zlib::Strategy::normal);
+
+        for (const std::string& message : traffic) {
+            raw_bytes += message.size();
+
+            if (message.size() < min_message_size) { // Below threshold, message is sent as is
+                sent_bytes += message.size();
+                continue;
+            }
+
+            // Deflated data might be a little bit larger than input
+            output_buffer.resize(message.size() + 64);
+
+            boost::beast::zlib::z_params deflate_params;
+            deflate_params.next_in = message.data();
+            deflate_params.avail_in = message.size();
+            deflate_params.next_out = output_buffer.data();
+            deflate_params.avail_out = output_buffer.size();
+
+            boost::beast::error_code err;
+            deflater.write(deflate_params, boost::beast::zlib::Flush::sync, err);
+            if (err)
+                state.SkipWithError(err.message().c_str());
+
+            sent_bytes += output_buffer.size() - deflate_params.avail_out - DEFLATE_TRAILER_SIZE;
+        }
+
+        benchmark::DoNotOptimize(output_buffer.data());
+    }
+
+    state.SetBytesProcessed(static_cast<std::int64_t>(raw_bytes));
+    state.counters["sent_ratio"] = static_cast<double>(sent_bytes) / static_cast<double>(raw_bytes);
+    state.counters["saved_bytes_per_msg"] = static_cast<double>(raw_bytes - sent_bytes)
+            / static_cast<double>(traffic.size() * state.iterations());
+}
+
+
+BENCHMARK(DeflateRecordedTraffic)
+    ->ArgNames({ "window_bits", "mem_level", "min_size" })
+    ->ArgsProduct({ { 9, 12, 15 }, { 1, 4, 8 }, { 0 } })
+    ->Args({ 15, 4, 64 })
+    ->Args({ 15, 4, 128 });
@@ -23,13 +23,22 @@ namespace RpT::Core {
  *
  * Run main loop for RpT.
  *
+ * Each main loop iteration handles a batch of every input event ready, up to a configured count, so IO interface
+ * flushes outputs and waits for inputs once for the whole batch. Service Events emitted while an input event is
+ * handled are still output before next input event is handled.
+ *
  * @author ThisALV, https://github.com/ThisALV
  */
 class Executor {
+public:
+    /// Default maximum count of input events handled by one main loop iteration
+    static constexpr std::size_t DEFAULT_MAX_BATCHED_INPUTS { 64 };
+
 private:
     Utils::LoggingContext& logger_context_;
     Utils::LoggerView logger_;
     InputOutputInterface& io_interface_;
+    const std::size_t max_batched_inputs_;
 
 public:
     /**
@@ -38,9 +47,14 @@ public:
      * @param game_resources_path A list of paths the game loader will search for resources on
      * @param game_name Name of game to play during this executor run, can be modified by players later
      * @param io_interface Backend for input and output based main loop events handling
+     * @param max_batched_inputs Maximum count of input events handled by one main loop iteration, 1 to flush outputs
+     * after each input event
+     *
+     * @throws std::invalid_argument if `max_batched_inputs` is 0
      */
     Executor(std::vector<boost::filesystem::path> game_resources_path, std::string game_name,
-             InputOutputInterface& io_interface, Utils::LoggingContext& logger_context);
+             InputOutputInterface& io_interface, Utils::LoggingContext& logger_context,
+             std::size_t max_batched_inputs = DEFAULT_MAX_BATCHED_INPUTS);
 
     // Entity class semantic :
 
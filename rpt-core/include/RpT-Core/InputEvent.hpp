@@ -61,12 +61,81 @@ public:
 
 };
 
-/// Event emitted when service request is received
+/**
+ * @brief Thrown by `ServiceRequestEvent` accessors if service request wasn't received in the accessed form
+ *
+ * @author ThisALV, https://github.com/ThisALV
+ */
+class UnavailableRequestForm : public std::logic_error {
+public:
+    /**
+     * @brief Constructs error with basic error message
+     *
+     * @param actor_uid UID for actor who sent service request
+     * @param decoded Was request decoded by IO interface
+     */
+    UnavailableRequestForm(const std::uint64_t actor_uid, const bool decoded)
+    : std::logic_error {
+        "Service request from actor " + std::to_string(actor_uid) + (decoded ? " was" : " wasn't") + " decoded"
+    } {}
+};
+
+/**
+ * @brief Event emitted when service request is received
+ *
+ * Request is either received as a SR command to be parsed by `ServiceEventRequestProtocol`, or already decoded by
+ * IO interface from a binary message, with its RUID, intended service name and command data. Decoded request owns
+ * its service name and command data inside a single buffer.
+ *
+ * Event constructed by `borrowing()` doesn't own any buffer, it refers to buffers owned by IO interface instead, so
+ * no allocation is required to move a request along input path. Such event, and its copies, are valid only as long
+ * as borrowed buffers are.
+ */
 class ServiceRequestEvent : public InputEvent {
 private:
+    // SR command, or service name immediately followed by command data if request was decoded, empty if borrowed
     std::string service_request_;
+    // Initialized only if request was decoded
+    std::optional<std::uint64_t> ruid_;
+    // Service name size at decoded request beginning
+    std::size_t service_name_size_;
+    // Does event refer to borrowed buffers instead of its own
+    bool borrowed_;
+    // SR command, or service name if request was decoded, if event is borrowed
+    std::string_view borrowed_request_;
+    // Command data if request was decoded and event is borrowed
+    std::string_view borrowed_command_data_;
+
+    /// Throws if request wasn't received in given form
+    void checkForm(bool decoded) const;
+
+    /// Constructs event without any request buffer, for `borrowing()` to set borrowed buffers
+    ServiceRequestEvent(std::uint64_t actor, std::optional<std::uint64_t> ruid);
 
 public:
+    /**
+     * @brief Constructs input event with given service request, without copying it
+     *
+     * @param actor Actor UID
+     * @param service_request Received SER request, must outlive event and its copies
+     *
+     * @returns Event borrowing given request
+     */
+    static ServiceRequestEvent borrowing(std::uint64_t actor, std::string_view service_request);
+
+    /**
+     * @brief Constructs input event with request already decoded by IO interface, without copying its fields
+     *
+     * @param actor Actor UID
+     * @param ruid Request UID
+     * @param service_name Intended service name, must outlive event and its copies
+     * @param command_data Command handled by intended service, must outlive event and its copies
+     *
+     * @returns Event borrowing given request fields
+     */
+    static ServiceRequestEvent borrowing(std::uint64_t actor, std::uint64_t ruid, std::string_view service_name,
+                                         std::string_view command_data);
+
     /**
      * @brief Constructs input event with given service request.
      *
@@ -77,12 +146,67 @@ public:
      */
     ServiceRequestEvent(std::uint64_t actor, std::string service_request);
 
+    /**
+     * @brief Constructs input event with request already decoded by IO interface, so SR command isn't formatted nor
+     * parsed
+     *
+     * @param actor Actor UID
+     * @param ruid Request UID
+     * @param service_name Intended service name
+     * @param command_data Command handled by intended service
+     */
+    ServiceRequestEvent(std::uint64_t actor, std::uint64_t ruid, std::string_view service_name,
+                        std::string_view command_data);
+
+    /**
+     * @brief Checks if request was decoded by IO interface instead of being received as SR command
+     *
+     * @returns `true` if request fields are available, `false` if SR command is available
+     */
+    bool decoded() const;
+
+    /**
+     * @brief Checks if event refers to buffers it doesn't own
+     *
+     * @returns `true` if event was constructed by `borrowing()`, or copied from such an event
+     */
+    bool borrowed() const;
+
     /**
      * @brief Get received service request using SR command format
      *
-     * @returns SR command
+     * @returns SR command, valid as long as event lives
+     *
+     * @throws UnavailableRequestForm if request was decoded
+     */
+    std::string_view serviceRequest() const;
+
+    /**
+     * @brief Get decoded request UID
+     *
+     * @returns RUID
+     *
+     * @throws UnavailableRequestForm if request wasn't decoded
+     */
+    std::uint64_t ruid() const;
+
+    /**
+     * @brief Get decoded request intended service name
+     *
+     * @returns Service name, valid as long as event lives
+     *
+     * @throws UnavailableRequestForm if request wasn't decoded
+     */
+    std::string_view serviceName() const;
+
+    /**
+     * @brief Get decoded request command data
+     *
+     * @returns Command handled by intended service, valid as long as event lives
+     *
+     * @throws UnavailableRequestForm if request wasn't decoded
      */
-    const std::string& serviceRequest() const;
+    std::string_view commandData() const;
 };
 
 /// Event emitted when a timer is timed out
@@ -0,0 +1,143 @@
+#ifndef RPTOGETHER_SERVER_INPUTEVENTQUEUE_HPP
+#define RPTOGETHER_SERVER_INPUTEVENTQUEUE_HPP
+
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <type_traits>
+#include <vector>
+#include <RpT-Core/InputOutputInterface.hpp>
+
+/**
+ * @file InputEventQueue.hpp
+ */
+
+
+namespace RpT::Core {
+
+
+/// Type of input event stored by an `InputEventRecord`, one for each `AnyInputEvent` alternative
+enum struct InputEventType : std::uint8_t {
+    None, ServiceRequest, Timer, Joined, Left
+};
+
+/**
+ * @brief Flat representation for a queued input event, payload strings are stored inside a recycled slab
+ *
+ * @author ThisALV, https://github.com/ThisALV
+ */
+struct InputEventRecord {
+    /// Value for `payloadSlab` if event doesn't have any payload
+    static constexpr std::uint32_t NO_SLAB { UINT32_MAX };
+
+    /// Type of input event
+    InputEventType type;
+    /// For Service Request, `true` if it was decoded by IO interface
+    bool decoded;
+    /// For Left event, `true` if actor crashed, then payload is error message
+    bool crashed;
+    /// Actor UID
+    std::uint64_t actor;
+    /// For decoded Service Request, its RUID
+    std::uint64_t ruid;
+    /// Index of slab containing SR command, service name followed by command data, player name or error message
+    std::uint32_t payloadSlab;
+    /// For decoded Service Request, service name size at payload beginning
+    std::uint32_t serviceNameSize;
+};
+
+// Records are relocated by plain copies when ring grows
+static_assert(std::is_trivially_copyable_v<InputEventRecord>);
+
+
+/**
+ * @brief FIFO queue for input events which doesn't allocate once it has grown to the count of simultaneously queued
+ * events
+ *
+ * Events are stored as `InputEventRecord`s inside a ring buffer. Their payload is copied into a slab, a string which
+ * is recycled once event has been handled, so its capacity is reused by next events.
+ *
+ * Polled events are adapted back to `AnyInputEvent` so they can still be visited. Service Requests are polled as
+ * events borrowing their slab, so they must not be used after `releasePolled()` is called. Other events, which aren't
+ * triggered at every main loop iteration, are polled as events owning their payload.
+ *
+ * @author ThisALV, https://github.com/ThisALV
+ */
+class InputEventQueue {
+private:
+    // Ring buffer, size is always a power of 2 so positions are wrapped using a mask
+    std::vector<InputEventRecord> records_;
+    std::size_t head_;
+    std::size_t size_;
+    // Deque so slabs are never relocated when a new one is appended, borrowed payloads remain valid
+    std::deque<std::string> slabs_;
+    // Slabs which can be reused by next pushed events
+    std::vector<std::uint32_t> free_slabs_;
+    // Slabs for polled events, which might still be borrowed until releasePolled() is called
+    std::vector<std::uint32_t> polled_slabs_;
+
+    /// Copies given payload into a free slab, or into a new slab if none is free, and retrieves its index
+    std::uint32_t storePayload(std::string_view first_part, std::string_view second_part = {});
+
+public:
+    /**
+     * @brief Constructs empty queue without any allocated record or slab
+     */
+    InputEventQueue();
+
+    // Entity class semantic :
+
+    InputEventQueue(const InputEventQueue&) = delete;
+    InputEventQueue& operator=(const InputEventQueue&) = delete;
+
+    /**
+     * @brief Copies given event at queue back
+     *
+     * Payload is copied, so given event might borrow buffers which will no longer be valid once it is pushed.
+     *
+     * @param input_event Event to push
+     */
+    void push(const AnyInputEvent& input_event);
+
+    /**
+     * @brief Removes event at queue front and retrieves it
+     *
+     * @returns Polled event, Service Request borrows its payload until `releasePolled()` is called
+     *
+     * @throws std::out_of_range if queue is empty
+     */
+    AnyInputEvent poll();
+
+    /**
+     * @brief Recycles payloads for every event polled since previous call, so events borrowing them must no longer be
+     * used
+     */
+    void releasePolled();
+
+    /**
+     * @brief Checks if any event is queued
+     *
+     * @returns `true` if no event is queued, `false` otherwise
+     */
+    bool empty() const;
+
+    /**
+     * @brief Gets count of queued events
+     *
+     * @returns Count of events pushed but not polled yet
+     */
+    std::size_t size() const;
+
+    /**
+     * @brief Gets count of slabs allocated so far, either used or free
+     *
+     * @returns Count of slabs, which is the maximum count of payloads simultaneously stored
+     */
+    std::size_t slabsCount() const;
+};
+
+
+}
+
+
+#endif //RPTOGETHER_SERVER_INPUTEVENTQUEUE_HPP
@@ -1,8 +1,11 @@
 #ifndef RPTOGETHER_SERVER_INPUTOUTPUTINTERFACE_HPP
 #define RPTOGETHER_SERVER_INPUTOUTPUTINTERFACE_HPP
 
+#include <vector>
 #include <boost/variant.hpp>
 #include <RpT-Core/InputEvent.hpp>
+#include <RpT-Core/LatencyTracer.hpp>
+#include <RpT-Core/MainLoopMetrics.hpp>
 #include <RpT-Utils/HandlingResult.hpp>
 
 /**
@@ -36,11 +39,22 @@ using AnyInputEvent = boost::variant<NoneEvent, ServiceRequestEvent, TimerEvent,
  * IO interface instance can be closed so input events are no longer received and server stop.
  * Pipeline with actor can also be individually closed if broken using `closePipelineWith()` method.
  *
+ * Requests latency along input→reply pipeline can be traced by a `LatencyTracer` attached to interface. Then, stages
+ * between request reception and response being sent are recorded by interface, and handling stages are recorded by
+ * main loop.
+ *
+ * Likewise, `MainLoopMetrics` attached to interface are recorded by main loop, so interface can expose them alongside
+ * its own metrics.
+ *
  * @note Interface is NOT automatically closed at destruction.
  *
  * @author ThisALV, https://github.com/ThisALV
  */
 class InputOutputInterface {
+private:
+    LatencyTracer* latency_tracer_;
+    MainLoopMetrics* main_loop_metrics_;
+
 protected:
     bool closed_;
 
@@ -65,10 +79,29 @@ public:
     /**
      * @brief Blocks until any kind of input event occurs, then retrieves it
      *
+     * Retrieved event might borrow buffers owned by interface, it must not be used after next call to
+     * `waitForInput()` or `waitForInputs()`.
+     *
      * @returns An instance of `InputEvent` subclass. Type depends on input type.
      */
     virtual AnyInputEvent waitForInput() = 0;
 
+    /**
+     * @brief Blocks until any kind of input event occurs, then retrieves every ready input event, up to given count
+     *
+     * Allows main loop to handle a batch of input events before outputs are flushed, so output flushes and waits are
+     * amortized across events when many of them are ready.
+     *
+     * As for `waitForInput()`, retrieved events must not be used after next call. Default implementation retrieves a
+     * single event using `waitForInput()`.
+     *
+     * @param input_events Cleared then filled with retrieved events in the order they occurred, at least one
+     * @param max_count Maximum count of events to retrieve
+     *
+     * @throws std::invalid_argument if `max_count` is 0
+     */
+    virtual void waitForInputs(std::vector<AnyInputEvent>& input_events, std::size_t max_count);
+
     /**
      * @brief Output response to actor for a given service request
      *
@@ -109,6 +142,38 @@ public:
      * @returns `true` if `close()` has been called
      */
     bool closed() const;
+
+    /**
+     * @brief Attaches tracer which will record latencies for requests going through interface
+     *
+     * @note Must be called before first `waitForInput()` call, as interface might read tracer from other threads.
+     *
+     * @param latency_tracer Tracer to record latencies with, must outlive interface
+     */
+    void traceLatencyWith(LatencyTracer& latency_tracer);
+
+    /**
+     * @brief Gets tracer attached to interface, if any
+     *
+     * @returns Pointer to attached tracer, `nullptr` if latency isn't traced
+     */
+    LatencyTracer* latencyTracer() const;
+
+    /**
+     * @brief Attaches metrics which will be recorded by main loop running with interface
+     *
+     * @note Must be called before main loop starts.
+     *
+     * @param main_loop_metrics Metrics to record main loop activity with, must outlive interface
+     */
+    void recordMetricsWith(MainLoopMetrics& main_loop_metrics);
+
+    /**
+     * @brief Gets main loop metrics attached to interface, if any
+     *
+     * @returns Pointer to attached metrics, `nullptr` if main loop activity isn't recorded
+     */
+    MainLoopMetrics* mainLoopMetrics() const;
 };
 
 
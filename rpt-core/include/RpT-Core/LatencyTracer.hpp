@@ -0,0 +1,301 @@
+#ifndef RPTOGETHER_SERVER_LATENCYTRACER_HPP
+#define RPTOGETHER_SERVER_LATENCYTRACER_HPP
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#include <RpT-Core/InputEvent.hpp>
+#include <RpT-Utils/LatencyHistogram.hpp>
+
+/**
+ * @file LatencyTracer.hpp
+ */
+
+
+namespace RpT::Core {
+
+
+/**
+ * @brief Stages crossed by a Service Request, from its reception by IO interface to its response being sent, in
+ * pipeline order
+ */
+enum class PipelineStage : std::size_t {
+    /// Message carrying request was read from client connection
+    Received,
+    /// Input event triggered by request was pushed into IO interface events queue
+    Queued,
+    /// Input event was dequeued to be handled by main loop
+    Dequeued,
+    /// Request handling by SER Protocol began
+    HandlingBegin,
+    /// Request handling by SER Protocol ended
+    HandlingEnd,
+    /// Service Request Response was queued for client
+    Replied,
+    /// Client messages queue carrying response was flushed to be sent
+    Synchronized,
+    /// Message carrying response was written to client connection
+    Sent
+};
+
+/// Count of `PipelineStage` values
+constexpr std::size_t PIPELINE_STAGES_COUNT { 8 };
+
+
+/**
+ * @brief Follows Service Requests along input→reply pipeline, recording latencies between each of its stages into
+ * per-stage histograms
+ *
+ * Each traced request is identified by its client token and its RUID. A trace begins when a request message is
+ * received by IO interface, then each following stage records time elapsed since previous recorded stage into this
+ * stage histogram. Time elapsed from reception to response being sent is also recorded once trace is complete.
+ * Stages skipped by a request, or recorded out of pipeline order, are ignored.
+ *
+ * Main loop handles one input event at a time, so stages recorded by main loop refer to the request being currently
+ * handled, which is selected when input event is dequeued. If several input events are dequeued at once, as a batch,
+ * they're selected one after another as main loop handles them. Response message is then followed through client
+ * messages queue, even if merged into another message before being sent.
+ *
+ * Latencies are recorded in nanoseconds, and they can be dumped as JSON into the file given at construction.
+ *
+ * @note Not thread-safe, every method must be called by the thread running main loop.
+ *
+ * @author ThisALV, https://github.com/ThisALV
+ */
+class LatencyTracer {
+public:
+    /// Monotonic clock used for each stage timestamp
+    using Clock = std::chrono::steady_clock;
+
+    /// Identifies a traced request
+    struct TraceKey {
+        /// Token for client which sent request
+        std::uint64_t clientToken;
+        /// Request UID
+        std::uint64_t ruid;
+    };
+
+private:
+    /// Request going through pipeline
+    struct Trace {
+        std::uint64_t ruid;
+        PipelineStage lastStage;
+        Clock::time_point lastTimestamp;
+        Clock::time_point receivedAt;
+        // Message carrying response once replied, so its write completion can be matched
+        const std::string* response;
+    };
+
+    /// Retrieves name for given stage, as used inside JSON dump
+    static constexpr std::string_view stageName(const PipelineStage stage) {
+        constexpr std::array<std::string_view, PIPELINE_STAGES_COUNT> stages_names {
+            "received", "queued", "dequeued", "handling_begin", "handling_end", "replied", "synchronized", "sent"
+        };
+
+        return stages_names[static_cast<std::size_t>(stage)];
+    }
+
+    std::string dump_path_;
+    // Requests in flight for each client, only a few of them are expected at the same time for one client
+    std::unordered_map<std::uint64_t, std::vector<Trace>> client_traces_;
+    // Request being handled by main loop, if it is traced
+    std::optional<TraceKey> current_trace_;
+    // Requests dequeued inside a batch and not handled yet, in handling order, uninitialized for untraced events
+    std::deque<std::optional<TraceKey>> batched_traces_;
+    // For each stage, nanoseconds since previous recorded stage, empty for the first stage
+    std::array<Utils::LatencyHistogram, PIPELINE_STAGES_COUNT> stage_latencies_;
+    // Nanoseconds from request reception to response being sent
+    Utils::LatencyHistogram end_to_end_latency_;
+    std::uint64_t in_flight_;
+    std::uint64_t completed_;
+    std::uint64_t discarded_;
+
+    /**
+     * @brief Retrieves trace for given request
+     *
+     * @returns Pointer to trace, or `nullptr` if request isn't traced
+     */
+    Trace* find(std::uint64_t client_token, std::uint64_t ruid);
+
+    /**
+     * @brief Records given stage for given trace, if it comes after last recorded stage
+     *
+     * @param trace Request trace
+     * @param stage Stage request just reached
+     * @param timestamp When request reached stage
+     */
+    void advance(Trace& trace, PipelineStage stage, Clock::time_point timestamp);
+
+public:
+    /**
+     * @brief Retrieves RUID for given Service Request, parsing SR command if request wasn't decoded by IO interface
+     *
+     * @param service_request Service Request input event
+     *
+     * @returns RUID if SR command is valid enough for it to be parsed, uninitialized otherwise
+     */
+    static std::optional<std::uint64_t> requestUid(const ServiceRequestEvent& service_request);
+
+    /**
+     * @brief Constructs tracer without any traced request nor recorded latency
+     *
+     * @param dump_path File JSON dump is written to by `dump()`
+     */
+    explicit LatencyTracer(std::string dump_path);
+
+    // Entity class semantic :
+
+    LatencyTracer(const LatencyTracer&) = delete;
+    LatencyTracer& operator=(const LatencyTracer&) = delete;
+
+    bool operator==(const LatencyTracer&) const = delete;
+
+    /**
+     * @brief Begins trace for given request, restarting it if client reused RUID of a request still in flight
+     *
+     * @param client_token Token for client which sent request
+     * @param ruid Request UID
+     * @param read_at When message carrying request was read from client connection
+     */
+    void received(std::uint64_t client_token, std::uint64_t ruid, Clock::time_point read_at);
+
+    /**
+     * @brief Records given stage for given request, if it is traced
+     *
+     * @param client_token Token for client which sent request
+     * @param ruid Request UID
+     * @param stage Stage request just reached
+     * @param timestamp When request reached stage, current time by default
+     */
+    void record(std::uint64_t client_token, std::uint64_t ruid, PipelineStage stage,
+                Clock::time_point timestamp = Clock::now());
+
+    /**
+     * @brief Records `PipelineStage::Dequeued` stage for given request, which is then the request currently handled
+     * by main loop
+     *
+     * @param request Dequeued request, uninitialized if dequeued input event isn't a traced request
+     */
+    void dequeued(const std::optional<TraceKey>& request);
+
+    /**
+     * @brief Records `PipelineStage::Dequeued` stage for given request, which will be handled by main loop after
+     * every request previously dequeued inside the same batch
+     *
+     * @param request Dequeued request, uninitialized if dequeued input event isn't a traced request
+     */
+    void dequeuedInBatch(const std::optional<TraceKey>& request);
+
+    /**
+     * @brief Selects next request dequeued inside batch as request currently handled by main loop, must be called once
+     * for each input event of the batch before it is handled
+     *
+     * Does nothing if there isn't any batched request, so request selected by `dequeued()` stays current.
+     */
+    void nextInBatch();
+
+    /**
+     * @brief Records given stage for request currently handled by main loop, if any
+     *
+     * @param stage Stage request just reached
+     */
+    void recordCurrent(PipelineStage stage);
+
+    /**
+     * @brief Records `PipelineStage::Replied` stage for request currently handled by main loop, if it was sent by
+     * given client
+     *
+     * @param client_token Client response was queued for
+     * @param response Message carrying response inside client messages queue
+     */
+    void replied(std::uint64_t client_token, const std::string* response);
+
+    /**
+     * @brief Records `PipelineStage::Synchronized` stage for every request which response was queued for given client
+     *
+     * @param client_token Client which messages queue has been flushed
+     * @param merged_message Message every flushed message was merged into, `nullptr` if they're sent as they are
+     */
+    void synchronized(std::uint64_t client_token, const std::string* merged_message = nullptr);
+
+    /**
+     * @brief Records `PipelineStage::Sent` stage for every request which response is carried by given message, then
+     * completes their trace
+     *
+     * @param client_token Client message was written to
+     * @param message Message written to client connection
+     * @param written_at When write operation completed
+     */
+    void sent(std::uint64_t client_token, const std::string* message, Clock::time_point written_at);
+
+    /**
+     * @brief Stops tracing every request sent by given client, as their response will never be sent
+     *
+     * @param client_token Disconnected client
+     */
+    void discard(std::uint64_t client_token);
+
+    /**
+     * @brief Retrieves count of traced requests which response hasn't been sent yet
+     *
+     * @returns Requests in flight
+     */
+    std::uint64_t inFlight() const;
+
+    /**
+     * @brief Retrieves count of traced requests which response has been sent
+     *
+     * @returns Completed traces
+     */
+    std::uint64_t completed() const;
+
+    /**
+     * @brief Retrieves latencies recorded for given stage
+     *
+     * @param stage Stage to get latencies for
+     *
+     * @returns Nanoseconds since previous recorded stage, for each request which reached given stage
+     */
+    const Utils::LatencyHistogram& stageLatency(PipelineStage stage) const;
+
+    /**
+     * @brief Retrieves latencies from request reception to response being sent
+     *
+     * @returns Nanoseconds for each completed trace
+     */
+    const Utils::LatencyHistogram& endToEndLatency() const;
+
+    /**
+     * @brief Formats traces count, then count, mean, p50, p90, p99 and max latencies in nanoseconds for each stage
+     * and from end to end, as JSON
+     *
+     * @returns JSON object for every recorded latency
+     */
+    std::string toJson() const;
+
+    /**
+     * @brief Writes JSON formatted by `toJson()` into file given at construction, replacing previous dump
+     *
+     * @throws std::runtime_error if file cannot be written
+     */
+    void dump() const;
+
+    /**
+     * @brief Gets file JSON dump is written to
+     *
+     * @returns Path given at construction
+     */
+    const std::string& dumpPath() const;
+};
+
+
+}
+
+
+#endif //RPTOGETHER_SERVER_LATENCYTRACER_HPP
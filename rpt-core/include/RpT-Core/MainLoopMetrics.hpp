@@ -0,0 +1,130 @@
+#ifndef RPTOGETHER_SERVER_MAINLOOPMETRICS_HPP
+#define RPTOGETHER_SERVER_MAINLOOPMETRICS_HPP
+
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <string>
+#include <string_view>
+#include <RpT-Utils/LatencyHistogram.hpp>
+#include <RpT-Utils/PrometheusWriter.hpp>
+
+/**
+ * @file MainLoopMetrics.hpp
+ */
+
+
+namespace RpT::Core {
+
+
+/**
+ * @brief Counts Service Requests handled by each service, Service Events polled and main loop iterations time, so
+ * they can be exposed as Prometheus metrics
+ *
+ * Only plain counters are updated, so recording doesn't cost more than a few increments for each input event.
+ *
+ * @note Not thread-safe, every method must be called by the thread running main loop.
+ *
+ * @author ThisALV, https://github.com/ThisALV
+ */
+class MainLoopMetrics {
+public:
+    /// Service Requests handled by a service
+    struct ServiceRequestsCounters {
+        /// Replied with `OK` response
+        std::uint64_t succeeded { 0 };
+        /// Replied with `KO` response, including requests which handling threw
+        std::uint64_t failed { 0 };
+    };
+
+private:
+    // Sorted by service name, so exposed metrics are always in the same order, transparent comparator avoids copies
+    std::map<std::string, ServiceRequestsCounters, std::less<>> service_requests_;
+    std::uint64_t rejected_requests_;
+    std::uint64_t polled_events_;
+    // Nanoseconds from input events batch retrieved to every Service Event polled
+    Utils::LatencyHistogram iteration_latency_;
+
+public:
+    /**
+     * @brief Constructs metrics without any counted request, event or iteration
+     */
+    MainLoopMetrics();
+
+    // Entity class semantic :
+
+    MainLoopMetrics(const MainLoopMetrics&) = delete;
+    MainLoopMetrics& operator=(const MainLoopMetrics&) = delete;
+
+    /**
+     * @brief Counts Service Request handled by given service
+     *
+     * @param service_name Service which handled request
+     * @param succeeded Was request replied with `OK` response
+     */
+    void serviceRequestHandled(std::string_view service_name, bool succeeded);
+
+    /**
+     * @brief Counts Service Request which couldn't be handled by any service, as SR command was ill-formed or as
+     * intended service wasn't found
+     */
+    void serviceRequestRejected();
+
+    /**
+     * @brief Counts given number of Service Events polled from SER Protocol
+     *
+     * @param events_count Polled events
+     */
+    void serviceEventsPolled(std::uint64_t events_count);
+
+    /**
+     * @brief Records time main loop spent on one batch of input events and on the Service Events they caused
+     *
+     * @param nanoseconds Iteration time, without waiting for input events
+     */
+    void iterationDone(std::uint64_t nanoseconds);
+
+    /**
+     * @brief Retrieves Service Requests counted for given service
+     *
+     * @param service_name Service to retrieve counters for
+     *
+     * @returns Counters for given service, both 0 if it didn't handle any request
+     */
+    ServiceRequestsCounters serviceRequests(std::string_view service_name) const;
+
+    /**
+     * @brief Retrieves count of Service Requests not handled by any service
+     *
+     * @returns Rejected requests
+     */
+    std::uint64_t rejectedRequests() const;
+
+    /**
+     * @brief Retrieves count of Service Events polled from SER Protocol
+     *
+     * @returns Polled events
+     */
+    std::uint64_t polledEvents() const;
+
+    /**
+     * @brief Retrieves main loop iterations time
+     *
+     * @returns Nanoseconds for each iteration
+     */
+    const Utils::LatencyHistogram& iterationLatency() const;
+
+    /**
+     * @brief Writes `rpt_service_requests_total`, `rpt_service_requests_rejected_total`,
+     * `rpt_service_events_polled_total` and `rpt_main_loop_iteration_seconds` families
+     *
+     * @param metrics Writer to format families with
+     */
+    void writeTo(Utils::PrometheusWriter& metrics) const;
+};
+
+
+}
+
+
+#endif //RPTOGETHER_SERVER_MAINLOOPMETRICS_HPP
@@ -1,12 +1,11 @@
 #ifndef RPTOGETHER_SERVER_SERVICE_HPP
 #define RPTOGETHER_SERVER_SERVICE_HPP
 
-#include <optional>
-#include <queue>
 #include <stdexcept>
 #include <string>
 #include <string_view>
-#include <utility>
+#include <vector>
+#include <boost/range/iterator_range.hpp>
 #include <RpT-Utils/HandlingResult.hpp>
 
 /**
@@ -17,51 +16,163 @@
 namespace RpT::Core {
 
 
+class Service;
+
+
+/**
+ * @brief Thrown if trying to poll event when events log is empty
+ *
+ * @see ServiceContext
+ *
+ * @author ThisALV, https://github.com/ThisALV
+ */
+class EmptyEventsQueue : public std::logic_error {
+public:
+    /**
+     * @brief Constructs error with basic message
+     */
+    EmptyEventsQueue() : std::logic_error { "No more events emitted by services" } {}
+};
+
+
 /**
  * @brief Provides a context for services to run, same instance expected for constructs all Service instances
  * registered in same SER Protocol.
  *
- * Instance is used for providing events ID.
+ * Instance is used for providing events and services ID, and owns the log of events emitted by services, in emission
+ * order. Log is an append-only contiguous buffer read from its front, so polling an event doesn't depend on services
+ * count, and buffer is reset once every event has been polled so its capacity is reused. Pending events can also be
+ * read at once as a contiguous range with `pendingEvents()`.
+ *
+ * Each event refers to its emitter by service ID, so it never depends on emitter lifetime. As events are removed from
+ * log when polled, a single SER Protocol can poll them, it must mark context as attached for its whole lifetime.
  *
  * @author ThisALV, https://github.com/ThisALV
  */
 class ServiceContext {
+public:
+    /// Entry for an event emitted by a service
+    struct EmittedEvent {
+        /// Event ID, growing from low to high in emission order
+        std::size_t id;
+        /// ID of service which emitted event
+        std::size_t service;
+        /// Words coming after `EVENT` prefix and service name in SE command
+        std::string command;
+    };
+
+    /// Contiguous read-only range over events log
+    using EventsRange = boost::iterator_range<std::vector<EmittedEvent>::const_iterator>;
+
 private:
     std::size_t events_count_;
+    std::size_t services_count_;
+    // Is a SER Protocol polling events from this context
+    bool attached_;
+    // Emitted events, polled ones are before first_pending_ and will be erased by next reset or compaction
+    std::vector<EmittedEvent> events_log_;
+    std::size_t first_pending_;
 
 public:
     /**
-     * @brief Initialize events count at 0
+     * @brief Initialize events and services count at 0, with empty events log and without attached SER Protocol
      */
     ServiceContext();
 
+    // Entity class semantic :
+
+    ServiceContext(const ServiceContext&) = delete;
+    ServiceContext& operator=(const ServiceContext&) = delete;
+
     /**
      * @brief Increments events count and retrieve its previous value
      *
-     * @note Called by `Service::emitEvent()` for retrieving triggered event ID, shouldn't be called by user.
+     * @note Called by `pushEvent()` for retrieving triggered event ID, shouldn't be called by user.
      *
      * @return Previous value for events count
      */
     std::size_t newEventPushed();
-};
 
+    /**
+     * @brief Increments services count and retrieve its previous value
+     *
+     * @note Called by `Service` constructor for retrieving its ID, shouldn't be called by user.
+     *
+     * @return Previous value for services count, which is ID for new service
+     */
+    std::size_t newServiceConstructed();
+
+    /**
+     * @brief Gets count of services constructed so far with this context
+     *
+     * @returns Count of services, every service ID is lower than that count
+     */
+    std::size_t servicesCount() const;
+
+    /**
+     * @brief Checks if a SER Protocol is polling events from this context
+     *
+     * @returns `true` if `attach()` was called without matching `detach()` call, `false` otherwise
+     */
+    bool attached() const;
+
+    /**
+     * @brief Marks context as polled by a SER Protocol
+     *
+     * @note Called by `ServiceEventRequestProtocol` constructor, shouldn't be called by user.
+     */
+    void attach();
+
+    /**
+     * @brief Marks context as no longer polled by any SER Protocol
+     *
+     * @note Called by `ServiceEventRequestProtocol` destructor, shouldn't be called by user.
+     */
+    void detach();
+
+    /**
+     * @brief Appends event emitted by given service at events log back
+     *
+     * @note Called by `Service::emitEvent()`, shouldn't be called by user.
+     *
+     * @param emitter Service emitting event
+     * @param event_command Event command (words coming after `EVENT` prefix and service name in SE command)
+     */
+    void pushEvent(const Service& emitter, std::string event_command);
+
+    /**
+     * @brief Checks if any emitted event hasn't been polled yet
+     *
+     * @returns `true` if every emitted event has been polled, `false` otherwise
+     */
+    bool empty() const;
+
+    /**
+     * @brief Gets count of emitted events which haven't been polled yet
+     *
+     * @returns Count of events inside log
+     */
+    std::size_t pendingCount() const;
+
+    /**
+     * @brief Gets every emitted event which hasn't been polled yet, without polling them
+     *
+     * @note Range is invalidated by next `pushEvent()` or `pollEvent()` call.
+     *
+     * @returns Contiguous range of `pendingCount()` events, from oldest to newest
+     */
+    EventsRange pendingEvents() const;
 
-/**
- * @brief Thrown if trying to poll event when queue is empty
- *
- * @see Service
- *
- * @author ThisALV, https://github.com/ThisALV
- */
-class EmptyEventsQueue : public std::logic_error {
-public:
     /**
-     * @brief Constructs error with basic message including queue service name
+     * @brief Removes oldest emitted event from log and retrieves it
+     *
+     * @note Called by `ServiceEventRequestProtocol` instance to dispatch across actors, shouldn't be called by user.
+     *
+     * @returns Oldest event which hasn't been polled yet
      *
-     * @param service Name of service the queue belongs to
+     * @throws EmptyEventsQueue if log is empty so event cannot be polled
      */
-    explicit EmptyEventsQueue(const std::string_view service) :
-            std::logic_error { "No more events for \"" + std::string { service } + '"' } {}
+    EmittedEvent pollEvent();
 };
 
 
@@ -71,58 +182,52 @@ public:
  * Service requirement is being able to handle SR commands, implementations must define `handleRequestCommand()`
  * virtual method.
  *
- * Implementations will access protected method `emitEvent()` so they can trigger events later polled by any SER
- * Protocol instance.
+ * Implementations will access protected method `emitEvent()` so they can trigger events later polled by the SER
+ * Protocol instance attached to their run context.
  *
- * Each service possesses its own events queue, and each event contains a event ID provided by `ServiceContext`, which
- * allows knowing what event was triggered first (as ID is growing from low to high) and an event command,
- * corresponding to words after `EVENT` prefix and service name inside Service Event command.
+ * Emitted events are appended to the events log owned by `ServiceContext`, shared by every service running inside
+ * this context, so they are polled in the order they were emitted whichever service emitted them. Each event
+ * contains an event command, corresponding to words after `EVENT` prefix and service name inside Service Event
+ * command.
  *
  * @author ThisALV, https://github.com/ThisALV
  */
 class Service {
 private:
     ServiceContext& run_context_;
-    std::queue<std::pair<std::size_t, std::string>> events_queue_;
+    std::size_t id_;
 
 protected:
     /**
-     * @brief Emits event command into service
+     * @brief Emits event command into service run context events log
      *
      * @param event_command Event command to emit (words coming after `EVENT` prefix and service name in SE command)
      */
     void emitEvent(std::string event_command);
 
 public:
-    /// Returned by `checkEvent()` when service events queue is empty
-    static constexpr std::optional<std::size_t> EMPTY_QUEUE {};
-
     /**
-     * @brief Constructs service with empty events queue and given run context
+     * @brief Constructs service with given run context, which gives it an ID
      *
      * @param run_context Context, should be same instance for services registered in same SER Protocol
      */
     explicit Service(ServiceContext& run_context);
 
     /**
-     * @brief Get next event ID so check for newest event between services can be performed
+     * @brief Get context service is running inside, owning events it emits
      *
-     * @note Called by `ServiceEventRequestProtocol` instance to perform described check, shouldn't be called by user.
+     * @note Called by `ServiceEventRequestProtocol` instance to poll emitted events, shouldn't be called by user.
      *
-     * @returns ID for next queued event, or uninitialized if queue is empty
+     * @returns Context given at construction
      */
-    std::optional<std::size_t> checkEvent() const;
+    ServiceContext& runContext() const;
 
     /**
-     * @brief Get next event command
-     *
-     * @note Called by `ServiceEventRequestProtocol` instance to dispatch across actors, shouldn't be called by user.
-     *
-     * @returns Command for next queued event
+     * @brief Get ID identifying service inside its run context, used to refer to emitter inside events log
      *
-     * @throws EmptyEventsQueue if queue is empty so event cannot be polled
+     * @returns ID given by run context at construction, growing from 0 in construction order
      */
-    std::string pollEvent();
+    std::size_t id() const;
 
     /**
      * @brief Get service name for registration
@@ -1,15 +1,15 @@
 #ifndef RPTOGETHER_SERVER_SERVICEEVENTREQUESTPROTOCOL_HPP
 #define RPTOGETHER_SERVER_SERVICEEVENTREQUESTPROTOCOL_HPP
 
-#include <deque>
 #include <functional>
 #include <initializer_list>
 #include <optional>
-#include <queue>
 #include <stdexcept>
 #include <string>
 #include <string_view>
 #include <unordered_map>
+#include <vector>
+#include <RpT-Core/MainLoopMetrics.hpp>
 #include <RpT-Core/Service.hpp>
 #include <RpT-Utils/HandlingResult.hpp>
 #include <RpT-Utils/LoggerView.hpp>
@@ -42,6 +42,44 @@ public:
         std::logic_error { "Service with name \"" + std::string { name } + "\" is already registered" } {}
 };
 
+/**
+ * @brief Thrown by `ServiceEventRequestProtocol` constructor if services aren't all running inside the same
+ * `ServiceContext`
+ *
+ * @see ServiceEventRequestProtocol
+ *
+ * @author ThisALV, https://github.com/ThisALV
+ */
+class ServicesContextMismatch : public std::logic_error {
+public:
+    /**
+     * @brief Constructs exception with error message including service running inside another context
+     *
+     * @param name Name for service which context differs from previous services context
+     */
+    explicit ServicesContextMismatch(const std::string_view name) :
+        std::logic_error { "Service with name \"" + std::string { name } + "\" runs inside another context" } {}
+};
+
+/**
+ * @brief Thrown by `ServiceEventRequestProtocol` constructor if services context is already polled by another SER
+ * Protocol instance
+ *
+ * @see ServiceEventRequestProtocol
+ *
+ * @author ThisALV, https://github.com/ThisALV
+ */
+class ServicesContextAlreadyAttached : public std::logic_error {
+public:
+    /**
+     * @brief Constructs exception with error message including a service running inside attached context
+     *
+     * @param name Name for a service running inside already attached context
+     */
+    explicit ServicesContextAlreadyAttached(const std::string_view name) :
+        std::logic_error { "Context for service with name \"" + std::string { name } + "\" is already attached" } {}
+};
+
 /**
  * @brief Base class for errors about ill-formed Service Request command.
  *
@@ -115,7 +153,10 @@ public:
  * RUID format is unsigned integer of 64 bits.
  *
  * Service Events (SR) commands are sent to actors by services in the same order they were emitted by them. SE
- * commands are used by services to notify state changes which could be caused by an actor request or not.
+ * commands are used by services to notify state changes which could be caused by an actor request or not. They're
+ * polled from events log owned by services `ServiceContext`, so every service must run inside the same context.
+ * As polled events are removed from log, only one SER Protocol instance at a time can be attached to a context. Events
+ * emitted by services which aren't registered are discarded when polled.
  *
  * SER Protocol:
  *
@@ -160,45 +201,56 @@ private:
         std::string_view commandData() const;
     };
 
-    /// Data structure holding cached Service Event emitter inside queue
-    struct CachedServiceEventEmitter {
-        std::size_t emittedEventId;
-        Service* queuedEmitter; // Holds pointer as only constant access to top element is allowed inside priority_queue
-
-        /// Priority emitter holds event with the highest priority (lowest emitted event ID)
-        bool operator>(const CachedServiceEventEmitter& rhs) const;
-        /// Required for `std::less`
-        bool operator<(const CachedServiceEventEmitter& rhs) const;
-    };
-
     Utils::LoggerView logger_;
     std::unordered_map<std::string_view, std::reference_wrapper<Service>> running_services_;
-    std::priority_queue<CachedServiceEventEmitter, std::deque<CachedServiceEventEmitter>> latest_se_emitters_cache_;
+    // Context every running service emits events into, uninitialized if there isn't any running service
+    ServiceContext* services_context_;
+    // Registered services indexed by their ID inside context, nullptr for services which aren't registered
+    std::vector<Service*> services_by_id_;
+    // Counts requests handled by each service, if main loop activity is recorded
+    MainLoopMetrics* main_loop_metrics_;
 
+public:
     /**
-     * @brief Poll ref to Service that we know is holding Service Event with the highest priority (the lowest
-     * event ID)
+     * @brief Initialize SER Protocol with given services to run
+     *
+     * Each service will be named from its `Service::name()` returned value.
      *
-     * @note Emitters cache must NOT be empty when called.
+     * @throws ServiceNameAlreadyRegistered if a service name appears twice into services list
+     * @throws ServicesContextMismatch if services aren't all running inside the same context
+     * @throws ServicesContextAlreadyAttached if services context is already attached to another SER Protocol instance
      *
-     * @returns Reference to Service holding the next event that must be polled by SER Protocol instance
+     * @param services References to services
+     * @param Context for SER Protocol logging
      */
-    Service& latestEventEmitter();
+    ServiceEventRequestProtocol(const std::initializer_list<std::reference_wrapper<Service>>& services,
+                                Utils::LoggingContext& logging_context);
 
-public:
     /**
-     * @brief Initialize SER Protocol with given services to run
+     * @brief Initialize SER Protocol with given services to run, for services count only known at runtime
      *
      * Each service will be named from its `Service::name()` returned value.
      *
      * @throws ServiceNameAlreadyRegistered if a service name appears twice into services list
+     * @throws ServicesContextMismatch if services aren't all running inside the same context
+     * @throws ServicesContextAlreadyAttached if services context is already attached to another SER Protocol instance
      *
      * @param services References to services
      * @param Context for SER Protocol logging
      */
-    ServiceEventRequestProtocol(const std::initializer_list<std::reference_wrapper<Service>>& services,
+    ServiceEventRequestProtocol(const std::vector<std::reference_wrapper<Service>>& services,
                                 Utils::LoggingContext& logging_context);
 
+    /**
+     * @brief Detaches services context, so another SER Protocol instance can poll its events
+     */
+    ~ServiceEventRequestProtocol();
+
+    // Entity class semantic :
+
+    ServiceEventRequestProtocol(const ServiceEventRequestProtocol&) = delete;
+    ServiceEventRequestProtocol& operator=(const ServiceEventRequestProtocol&) = delete;
+
     /**
      * @brief Get if given service is already registered
      *
@@ -208,6 +260,13 @@ public:
      */
     bool isRegistered(std::string_view service) const;
 
+    /**
+     * @brief Counts each Service Request handled by a service into given metrics, with its response result
+     *
+     * @param main_loop_metrics Metrics to count requests into, must outlive SER Protocol instance
+     */
+    void recordMetricsWith(MainLoopMetrics& main_loop_metrics);
+
     /**
      * @brief Try to treat the given Service Request command
      *
@@ -223,7 +282,25 @@ public:
     std::string handleServiceRequest(std::uint64_t actor, std::string_view service_request);
 
     /**
-     * @brief Poll next Service Event command in services queue, do nothing if queue is empty
+     * @brief Try to treat the given Service Request already decoded by IO interface, so no SR command is parsed
+     *
+     * @param actor UID for actor who's trying to execute that request
+     * @param ruid Request UID
+     * @param intended_service_name Service which must handle request
+     * @param command_data Command to be handled by intended service
+     *
+     * @returns Service Request Response (SRR) which has to sent to SR actor
+     *
+     * @throws ServiceNotFound if intended service isn't registered
+     */
+    std::string handleServiceRequest(std::uint64_t actor, std::uint64_t ruid, std::string_view intended_service_name,
+                                     std::string_view command_data);
+
+    /**
+     * @brief Poll next Service Event command in services events log, do nothing if log is empty
+     *
+     * Idle services aren't checked, so polling doesn't depend on running services count. Events emitted by services
+     * which aren't registered, sharing the same context, are discarded.
      *
      * @returns Optional value, initialized to next SE command if it exists, uninitialized otherwise
      */
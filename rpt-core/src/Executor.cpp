@@ -1,5 +1,8 @@
 #include <RpT-Core/Executor.hpp>
 
+#include <algorithm>
+#include <chrono>
+#include <stdexcept>
 #include <type_traits>
 #include <RpT-Core/ServiceEventRequestProtocol.hpp>
 
@@ -13,12 +16,17 @@ namespace { // Input handler only visible for Executor::run() implementation
  * @brief Provides call operators set, one call operator per InputEvent type
  *
  * Has an access to Executor IO interface, running SER Protocol and Executor's logger
+ *
+ * Actors which pipeline was closed while handling current batch are remembered, as their next requests inside the
+ * same batch were retrieved before they were unregistered and cannot be replied.
  */
 class InputHandler {
 private:
     InputOutputInterface& io_interface_;
     ServiceEventRequestProtocol& ser_protocol_;
     Utils::LoggerView& logger_;
+    // Actors which pipeline was closed since current batch began, only a few of them expected
+    std::vector<std::uint64_t> broken_pipelines_;
 
 public:
     /**
@@ -35,6 +43,12 @@ public:
                  ser_protocol_ { ser_protocol },
                  logger_ { caller_logger } {}
 
+    /// Must be called before each batch of input events is handled, as every closed pipeline has been handled by IO
+    /// interface since
+    void newBatch() {
+        broken_pipelines_.clear();
+    }
+
     void operator()(const NoneEvent&) {
         logger_.debug("Null event, skipping...");
     }
@@ -43,18 +57,40 @@ public:
         logger_.debug("Service Request command received from player \"{}\".", event.actor());
 
         const std::uint64_t actor_uid { event.actor() };
+        if (std::find(broken_pipelines_.cbegin(), broken_pipelines_.cend(), actor_uid) != broken_pipelines_.cend()) {
+            logger_.debug("Pipeline with actor {} closed, skipping...", actor_uid);
+
+            return;
+        }
+
+        // Request handling stages are recorded only if IO interface latency is traced
+        LatencyTracer* const latency_tracer { io_interface_.latencyTracer() };
         try { // Tries to parse SR command
-            // Give SR command to parse and execute by SER Protocol
+            if (latency_tracer)
+                latency_tracer->recordCurrent(PipelineStage::HandlingBegin);
+
+            // Give SR command to parse and execute by SER Protocol, or request directly if IO interface decoded it
             const std::string sr_command_response {
-                    ser_protocol_.handleServiceRequest(event.actor(), event.serviceRequest())
+                    event.decoded()
+                    ? ser_protocol_.handleServiceRequest(actor_uid, event.ruid(), event.serviceName(),
+                                                         event.commandData())
+                    : ser_protocol_.handleServiceRequest(actor_uid, event.serviceRequest())
             };
 
+            if (latency_tracer)
+                latency_tracer->recordCurrent(PipelineStage::HandlingEnd);
+
             // Replies to actor with command handling result
             io_interface_.replyTo(actor_uid, sr_command_response);
         } catch (const BadServiceRequest& err) { // If command cannot be parsed, SRR cannot be sent, pipeline broken
             // It is no longer possible to sync SR with actor as RUID might be wrong, closing pipeline with thrown
             // exception message
             io_interface_.closePipelineWith(actor_uid, Utils::HandlingResult { err.what() });
+            broken_pipelines_.push_back(actor_uid);
+
+            MainLoopMetrics* const main_loop_metrics { io_interface_.mainLoopMetrics() };
+            if (main_loop_metrics)
+                main_loop_metrics->serviceRequestRejected();
 
             logger_.error("SER Protocol broken for actor {}: {}. Closing pipeline...", actor_uid, err.what());
         }
@@ -77,12 +113,18 @@ public:
 }
 
 Executor::Executor(std::vector<boost::filesystem::path> game_resources_path, std::string game_name,
-                   InputOutputInterface& io_interface, Utils::LoggingContext& logger_context) :
+                   InputOutputInterface& io_interface, Utils::LoggingContext& logger_context,
+                   const std::size_t max_batched_inputs) :
     logger_context_ { logger_context },
     logger_ { "Executor", logger_context_ },
-    io_interface_ { io_interface } {
+    io_interface_ { io_interface },
+    max_batched_inputs_ { max_batched_inputs } {
+
+    if (max_batched_inputs_ == 0)
+        throw std::invalid_argument { "At least one input event must be handled for each batch" };
 
     logger_.debug("Game name: {}", game_name);
+    logger_.debug("Input events batched by {} at most.", max_batched_inputs_);
 
     for (const boost::filesystem::path& resource_path : game_resources_path)
         logger_.debug("Game resources path: {}", resource_path.string());
@@ -169,32 +211,64 @@ bool Executor::run() {
 
     // Protocol initialization with created services
     ServiceEventRequestProtocol ser_protocol {{ chat_svc }, logger_context_ };
+
+    // Main loop activity is recorded only if IO interface exposes metrics
+    MainLoopMetrics* const main_loop_metrics { io_interface_.mainLoopMetrics() };
+    if (main_loop_metrics)
+        ser_protocol.recordMetricsWith(*main_loop_metrics);
+
+    // Handling stages are recorded for each request of a batch only if IO interface latency is traced
+    LatencyTracer* const latency_tracer { io_interface_.latencyTracer() };
+
     // Functions set for input events handling
     InputHandler input_handler { io_interface_, ser_protocol, logger_ };
 
+    // Reused for each batch, so it is allocated only once
+    std::vector<AnyInputEvent> input_events;
+    input_events.reserve(max_batched_inputs_);
+
     logger_.info("Starts main loop.");
 
     try { // Any errors occurring during main loop execution will
         while (!io_interface_.closed()) { // Main loop must run as long as inputs and outputs with players can occur
-            // Blocking until receiving external event to handle (timer, data packet, etc.)
-            const AnyInputEvent input_event { io_interface_.waitForInput() };
+            // Blocking until receiving external events to handle (timer, data packet, etc.), then takes every ready
+            // one so outputs are flushed once for the whole batch
+            io_interface_.waitForInputs(input_events, max_batched_inputs_);
+            // Iteration time doesn't include time spent waiting for input events
+            const auto iteration_begin { std::chrono::steady_clock::now() };
 
-            boost::apply_visitor(input_handler, input_event);
+            logger_.debug("Handling {} input events...", input_events.size());
 
-            // After input event has been handled, events emitted by services should also be handled in the order they
-            // appeared
+            input_handler.newBatch();
+            std::uint64_t polled_events_count { 0 };
+            for (const AnyInputEvent& input_event : input_events) {
+                if (latency_tracer) // Event requests stages must be recorded for
+                    latency_tracer->nextInBatch();
 
-            logger_.debug("Polling service events...");
+                boost::apply_visitor(input_handler, input_event);
 
-            std::optional<std::string> next_svc_event { ser_protocol.pollServiceEvent() }; // Read first event
-            while (next_svc_event) { // Then while next event actually exists, handles it
-                logger_.debug("Output event: {}", *next_svc_event);
-                io_interface_.outputEvent(*next_svc_event); // Sent across actors
+                // After input event has been handled, events emitted by services should also be handled in the order
+                // they appeared, before next input event so actors receive responses and events in the same order
 
-                next_svc_event = ser_protocol.pollServiceEvent(); // Read next event
+                logger_.debug("Polling service events...");
+
+                std::optional<std::string> next_svc_event { ser_protocol.pollServiceEvent() }; // Read first event
+                while (next_svc_event) { // Then while next event actually exists, handles it
+                    logger_.debug("Output event: {}", *next_svc_event);
+                    io_interface_.outputEvent(*next_svc_event); // Sent across actors
+                    polled_events_count++;
+
+                    next_svc_event = ser_protocol.pollServiceEvent(); // Read next event
+                }
+
+                logger_.debug("Events polled.");
             }
 
-            logger_.debug("Events polled.");
+            if (main_loop_metrics) {
+                main_loop_metrics->serviceEventsPolled(polled_events_count);
+                main_loop_metrics->iterationDone(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                        std::chrono::steady_clock::now() - iteration_begin).count());
+            }
         }
 
         logger_.info("Stopped.");
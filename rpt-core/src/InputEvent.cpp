@@ -23,11 +23,82 @@ NoneEvent::NoneEvent(std::uint64_t actor) : InputEvent { actor } {}
  * ServiceRequest
  */
 
+ServiceRequestEvent::ServiceRequestEvent(const std::uint64_t actor, const std::optional<std::uint64_t> ruid) :
+    InputEvent { actor }, ruid_ { ruid }, service_name_size_ { 0 }, borrowed_ { true } {}
+
+ServiceRequestEvent ServiceRequestEvent::borrowing(const std::uint64_t actor, const std::string_view service_request) {
+    ServiceRequestEvent event { actor, std::optional<std::uint64_t> {} };
+    event.borrowed_request_ = service_request;
+
+    return event;
+}
+
+ServiceRequestEvent ServiceRequestEvent::borrowing(const std::uint64_t actor, const std::uint64_t ruid,
+                                                   const std::string_view service_name,
+                                                   const std::string_view command_data) {
+
+    ServiceRequestEvent event { actor, ruid };
+    event.borrowed_request_ = service_name;
+    event.borrowed_command_data_ = command_data;
+
+    return event;
+}
+
 ServiceRequestEvent::ServiceRequestEvent(std::uint64_t actor, std::string service_request) :
-    InputEvent { actor }, service_request_ { std::move(service_request) } {}
+    InputEvent { actor }, service_request_ { std::move(service_request) }, service_name_size_ { 0 },
+    borrowed_ { false } {}
+
+ServiceRequestEvent::ServiceRequestEvent(const std::uint64_t actor, const std::uint64_t ruid,
+                                         const std::string_view service_name, const std::string_view command_data) :
+    InputEvent { actor }, ruid_ { ruid }, service_name_size_ { service_name.size() }, borrowed_ { false } {
+
+    // Exactly one allocation for both fields
+    service_request_.reserve(service_name.size() + command_data.size());
+    service_request_ += service_name;
+    service_request_ += command_data;
+}
+
+void ServiceRequestEvent::checkForm(const bool decoded) const {
+    if (ruid_.has_value() != decoded)
+        throw UnavailableRequestForm { actor(), ruid_.has_value() };
+}
+
+bool ServiceRequestEvent::decoded() const {
+    return ruid_.has_value();
+}
+
+bool ServiceRequestEvent::borrowed() const {
+    return borrowed_;
+}
+
+std::string_view ServiceRequestEvent::serviceRequest() const {
+    checkForm(false);
+
+    return borrowed_ ? borrowed_request_ : std::string_view { service_request_ };
+}
+
+std::uint64_t ServiceRequestEvent::ruid() const {
+    checkForm(true);
+
+    return *ruid_;
+}
+
+std::string_view ServiceRequestEvent::serviceName() const {
+    checkForm(true);
+
+    if (borrowed_)
+        return borrowed_request_;
+
+    return std::string_view { service_request_ }.substr(0, service_name_size_);
+}
+
+std::string_view ServiceRequestEvent::commandData() const {
+    checkForm(true);
+
+    if (borrowed_)
+        return borrowed_command_data_;
 
-const std::string& ServiceRequestEvent::serviceRequest() const {
-    return service_request_;
+    return std::string_view { service_request_ }.substr(service_name_size_);
 }
 
 /*
@@ -0,0 +1,146 @@
+#include <RpT-Core/InputEventQueue.hpp>
+
+#include <cassert>
+#include <stdexcept>
+
+
+namespace RpT::Core {
+
+
+namespace {
+
+
+/// Initial ring buffer size, allocated when first event is pushed
+constexpr std::size_t INITIAL_RECORDS_CAPACITY { 16 };
+
+
+}
+
+
+InputEventQueue::InputEventQueue() : head_ { 0 }, size_ { 0 } {}
+
+std::uint32_t InputEventQueue::storePayload(const std::string_view first_part, const std::string_view second_part) {
+    std::uint32_t slab;
+    if (free_slabs_.empty()) { // Queue hasn't reached its steady state yet, a new slab is required
+        slab = static_cast<std::uint32_t>(slabs_.size());
+        slabs_.emplace_back();
+    } else {
+        slab = free_slabs_.back();
+        free_slabs_.pop_back();
+    }
+
+    // Capacity is kept by assignments, so payload isn't reallocated unless it is larger than previous ones
+    std::string& payload { slabs_[slab] };
+    payload.assign(first_part);
+    payload.append(second_part);
+
+    return slab;
+}
+
+void InputEventQueue::push(const AnyInputEvent& input_event) {
+    if (size_ == records_.size()) { // Ring is full, records are moved to a twice larger one, from head to tail
+        std::vector<InputEventRecord> grown_records(
+                records_.empty() ? INITIAL_RECORDS_CAPACITY : records_.size() * 2);
+
+        for (std::size_t i { 0 }; i < size_; i++)
+            grown_records[i] = records_[(head_ + i) & (records_.size() - 1)];
+
+        records_.swap(grown_records);
+        head_ = 0;
+    }
+
+    InputEventRecord& record { records_[(head_ + size_) & (records_.size() - 1)] };
+    record = InputEventRecord {
+        InputEventType::None, false, false, 0, 0, InputEventRecord::NO_SLAB, 0
+    };
+
+    if (const auto* service_request { boost::get<ServiceRequestEvent>(&input_event) }) {
+        record.type = InputEventType::ServiceRequest;
+        record.actor = service_request->actor();
+        record.decoded = service_request->decoded();
+
+        if (record.decoded) { // Service name and command data are stored contiguously, as decoded event does
+            record.ruid = service_request->ruid();
+            record.serviceNameSize = static_cast<std::uint32_t>(service_request->serviceName().size());
+            record.payloadSlab = storePayload(service_request->serviceName(), service_request->commandData());
+        } else {
+            record.payloadSlab = storePayload(service_request->serviceRequest());
+        }
+    } else if (const auto* timer { boost::get<TimerEvent>(&input_event) }) {
+        record.type = InputEventType::Timer;
+        record.actor = timer->actor();
+    } else if (const auto* joined { boost::get<JoinedEvent>(&input_event) }) {
+        record.type = InputEventType::Joined;
+        record.actor = joined->actor();
+        record.payloadSlab = storePayload(joined->playerName());
+    } else if (const auto* left { boost::get<LeftEvent>(&input_event) }) {
+        const Utils::HandlingResult disconnection_reason { left->disconnectionReason() };
+
+        record.type = InputEventType::Left;
+        record.actor = left->actor();
+        record.crashed = !disconnection_reason;
+
+        if (record.crashed)
+            record.payloadSlab = storePayload(disconnection_reason.errorMessage());
+    } else { // Only remaining alternative
+        record.actor = boost::get<NoneEvent>(input_event).actor();
+    }
+
+    size_++;
+}
+
+AnyInputEvent InputEventQueue::poll() {
+    if (size_ == 0)
+        throw std::out_of_range { "No input event queued" };
+
+    const InputEventRecord record { records_[head_] };
+    head_ = (head_ + 1) & (records_.size() - 1);
+    size_--;
+
+    if (record.payloadSlab != InputEventRecord::NO_SLAB) // Payload might be borrowed until releasePolled() call
+        polled_slabs_.push_back(record.payloadSlab);
+
+    switch (record.type) {
+    case InputEventType::ServiceRequest: {
+        const std::string_view payload { slabs_[record.payloadSlab] };
+
+        if (record.decoded) {
+            return ServiceRequestEvent::borrowing(record.actor, record.ruid,
+                                                  payload.substr(0, record.serviceNameSize),
+                                                  payload.substr(record.serviceNameSize));
+        }
+
+        return ServiceRequestEvent::borrowing(record.actor, payload);
+    }
+    case InputEventType::Timer:
+        return TimerEvent { record.actor };
+    case InputEventType::Joined:
+        return JoinedEvent { record.actor, slabs_[record.payloadSlab] };
+    case InputEventType::Left:
+        return record.crashed ? LeftEvent { record.actor, slabs_[record.payloadSlab] } : LeftEvent { record.actor };
+    default:
+        assert(record.type == InputEventType::None);
+
+        return NoneEvent { record.actor };
+    }
+}
+
+void InputEventQueue::releasePolled() {
+    free_slabs_.insert(free_slabs_.end(), polled_slabs_.begin(), polled_slabs_.end());
+    polled_slabs_.clear();
+}
+
+bool InputEventQueue::empty() const {
+    return size_ == 0;
+}
+
+std::size_t InputEventQueue::size() const {
+    return size_;
+}
+
+std::size_t InputEventQueue::slabsCount() const {
+    return slabs_.size();
+}
+
+
+}
@@ -1,9 +1,20 @@
 #include <RpT-Core/InputOutputInterface.hpp>
 
+#include <stdexcept>
+
 
 namespace RpT::Core {
 
-InputOutputInterface::InputOutputInterface() : closed_ { false } {}
+InputOutputInterface::InputOutputInterface()
+: latency_tracer_ { nullptr }, main_loop_metrics_ { nullptr }, closed_ { false } {}
+
+void InputOutputInterface::waitForInputs(std::vector<AnyInputEvent>& input_events, const std::size_t max_count) {
+    if (max_count == 0)
+        throw std::invalid_argument { "At least one input event must be retrieved" };
+
+    input_events.clear();
+    input_events.push_back(waitForInput());
+}
 
 void InputOutputInterface::close() {
     closed_ = true;
@@ -13,4 +24,20 @@ bool InputOutputInterface::closed() const {
     return closed_;
 }
 
+void InputOutputInterface::traceLatencyWith(LatencyTracer& latency_tracer) {
+    latency_tracer_ = &latency_tracer;
+}
+
+LatencyTracer* InputOutputInterface::latencyTracer() const {
+    return latency_tracer_;
+}
+
+void InputOutputInterface::recordMetricsWith(MainLoopMetrics& main_loop_metrics) {
+    main_loop_metrics_ = &main_loop_metrics;
+}
+
+MainLoopMetrics* InputOutputInterface::mainLoopMetrics() const {
+    return main_loop_metrics_;
+}
+
 }
\ No newline at end of file
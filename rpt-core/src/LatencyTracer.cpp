@@ -0,0 +1,273 @@
+#include <RpT-Core/LatencyTracer.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <RpT-Utils/TextProtocolParser.hpp>
+
+
+namespace RpT::Core {
+
+
+namespace {
+
+
+/// Parses SR command prefix and RUID only, remaining words are left to SER Protocol
+class RequestUidParser : public Utils::TextProtocolParser {
+public:
+    explicit RequestUidParser(const std::string_view sr_command) : Utils::TextProtocolParser { sr_command, 2 } {}
+
+    /// Retrieves unparsed RUID
+    std::string_view ruid() const {
+        return getParsedWord(1);
+    }
+};
+
+
+/// Retrieves nanoseconds elapsed from given begin to given end, 0 if end is before begin
+std::uint64_t nanosecondsBetween(const LatencyTracer::Clock::time_point begin,
+                                 const LatencyTracer::Clock::time_point end) {
+
+    if (end < begin) // Timestamps taken by other threads might be a little late
+        return 0;
+
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count();
+}
+
+/// Writes latency percentiles, count and mean recorded by given histogram as JSON object
+void writeLatencies(std::ostringstream& json, const Utils::LatencyHistogram& latencies) {
+    json << "{ \"count\": " << latencies.count()
+         << ", \"mean\": " << std::llround(latencies.mean()) // Sub-nanosecond precision is meaningless
+         << ", \"p50\": " << latencies.percentile(50)
+         << ", \"p90\": " << latencies.percentile(90)
+         << ", \"p99\": " << latencies.percentile(99)
+         << ", \"max\": " << latencies.max() << " }";
+}
+
+
+}
+
+
+std::optional<std::uint64_t> LatencyTracer::requestUid(const ServiceRequestEvent& service_request) {
+    if (service_request.decoded())
+        return service_request.ruid();
+
+    try {
+        const RequestUidParser sr_command_parser { service_request.serviceRequest() };
+        const std::string ruid_copy { sr_command_parser.ruid() }; // Required for conversion to unsigned integer
+
+        std::size_t parsed_chars;
+        const std::uint64_t ruid { std::stoull(ruid_copy, &parsed_chars) };
+
+        if (parsed_chars != ruid_copy.size()) // Rejected by SER Protocol, it will not be replied to
+            return {};
+
+        return ruid;
+    } catch (const std::logic_error&) { // Missing RUID, or RUID which isn't an unsigned integer of 64 bits
+        return {};
+    }
+}
+
+LatencyTracer::LatencyTracer(std::string dump_path)
+: dump_path_ { std::move(dump_path) }, in_flight_ { 0 }, completed_ { 0 }, discarded_ { 0 } {}
+
+LatencyTracer::Trace* LatencyTracer::find(const std::uint64_t client_token, const std::uint64_t ruid) {
+    const auto client_traces { client_traces_.find(client_token) };
+    if (client_traces == client_traces_.end())
+        return nullptr;
+
+    std::vector<Trace>& traces { client_traces->second };
+    const auto trace { std::find_if(traces.begin(), traces.end(), [ruid](const Trace& in_flight_trace) {
+        return in_flight_trace.ruid == ruid;
+    }) };
+
+    return trace == traces.end() ? nullptr : &*trace;
+}
+
+void LatencyTracer::advance(Trace& trace, const PipelineStage stage, const Clock::time_point timestamp) {
+    if (stage <= trace.lastStage) // Each stage is recorded once, in pipeline order
+        return;
+
+    stage_latencies_[static_cast<std::size_t>(stage)].record(nanosecondsBetween(trace.lastTimestamp, timestamp));
+
+    trace.lastStage = stage;
+    trace.lastTimestamp = timestamp;
+}
+
+void LatencyTracer::received(const std::uint64_t client_token, const std::uint64_t ruid,
+                             const Clock::time_point read_at) {
+
+    const Trace new_trace { ruid, PipelineStage::Received, read_at, read_at, nullptr };
+
+    Trace* reused_trace { find(client_token, ruid) };
+    if (reused_trace) {
+        *reused_trace = new_trace;
+    } else {
+        client_traces_[client_token].push_back(new_trace);
+        in_flight_++;
+    }
+}
+
+void LatencyTracer::record(const std::uint64_t client_token, const std::uint64_t ruid, const PipelineStage stage,
+                           const Clock::time_point timestamp) {
+
+    Trace* trace { find(client_token, ruid) };
+    if (trace)
+        advance(*trace, stage, timestamp);
+}
+
+void LatencyTracer::dequeued(const std::optional<TraceKey>& request) {
+    current_trace_ = request; // Any previously handled request is done with main loop
+
+    if (request.has_value())
+        record(request->clientToken, request->ruid, PipelineStage::Dequeued);
+}
+
+void LatencyTracer::dequeuedInBatch(const std::optional<TraceKey>& request) {
+    batched_traces_.push_back(request); // Selected once every previously batched request has been handled
+
+    if (request.has_value())
+        record(request->clientToken, request->ruid, PipelineStage::Dequeued);
+}
+
+void LatencyTracer::nextInBatch() {
+    if (batched_traces_.empty())
+        return;
+
+    current_trace_ = batched_traces_.front(); // Previous request inside batch is done with main loop
+    batched_traces_.pop_front();
+}
+
+void LatencyTracer::recordCurrent(const PipelineStage stage) {
+    if (current_trace_.has_value())
+        record(current_trace_->clientToken, current_trace_->ruid, stage);
+}
+
+void LatencyTracer::replied(const std::uint64_t client_token, const std::string* response) {
+    if (!current_trace_.has_value() || current_trace_->clientToken != client_token)
+        return;
+
+    Trace* trace { find(client_token, current_trace_->ruid) };
+    if (!trace)
+        return;
+
+    advance(*trace, PipelineStage::Replied, Clock::now());
+    trace->response = response;
+}
+
+void LatencyTracer::synchronized(const std::uint64_t client_token, const std::string* merged_message) {
+    const auto client_traces { client_traces_.find(client_token) };
+    if (client_traces == client_traces_.end())
+        return;
+
+    const Clock::time_point now { Clock::now() };
+    for (Trace& trace : client_traces->second) {
+        if (trace.lastStage != PipelineStage::Replied) // Response isn't inside flushed queue
+            continue;
+
+        advance(trace, PipelineStage::Synchronized, now);
+
+        if (merged_message)
+            trace.response = merged_message;
+    }
+}
+
+void LatencyTracer::sent(const std::uint64_t client_token, const std::string* message,
+                         const Clock::time_point written_at) {
+
+    const auto client_traces { client_traces_.find(client_token) };
+    if (client_traces == client_traces_.end())
+        return;
+
+    std::vector<Trace>& traces { client_traces->second };
+
+    std::size_t i { 0 };
+    while (i < traces.size()) {
+        Trace& trace { traces[i] };
+
+        if (trace.lastStage == PipelineStage::Synchronized && trace.response == message) {
+            advance(trace, PipelineStage::Sent, written_at);
+            end_to_end_latency_.record(nanosecondsBetween(trace.receivedAt, written_at));
+
+            // Removes completed trace by moving last trace at its position, order doesn't matter
+            trace = traces.back();
+            traces.pop_back();
+
+            in_flight_--;
+            completed_++;
+        } else { // Response not carried by this message, checks next trace
+            i++;
+        }
+    }
+}
+
+void LatencyTracer::discard(const std::uint64_t client_token) {
+    const auto client_traces { client_traces_.find(client_token) };
+    if (client_traces == client_traces_.end())
+        return;
+
+    const std::size_t discarded_traces { client_traces->second.size() };
+    in_flight_ -= discarded_traces;
+    discarded_ += discarded_traces;
+
+    client_traces_.erase(client_traces);
+
+    if (current_trace_.has_value() && current_trace_->clientToken == client_token)
+        current_trace_.reset();
+}
+
+std::uint64_t LatencyTracer::inFlight() const {
+    return in_flight_;
+}
+
+std::uint64_t LatencyTracer::completed() const {
+    return completed_;
+}
+
+const Utils::LatencyHistogram& LatencyTracer::stageLatency(const PipelineStage stage) const {
+    return stage_latencies_[static_cast<std::size_t>(stage)];
+}
+
+const Utils::LatencyHistogram& LatencyTracer::endToEndLatency() const {
+    return end_to_end_latency_;
+}
+
+std::string LatencyTracer::toJson() const {
+    std::ostringstream json;
+    json << "{\n";
+
+    json << "  \"unit\": \"ns\",\n";
+    json << "  \"traces\": { \"in_flight\": " << in_flight_ << ", \"completed\": " << completed_
+         << ", \"discarded\": " << discarded_ << " },\n";
+
+    // Received stage is where traces begin, there isn't any previous stage to measure latency from
+    json << "  \"stages\": {";
+    for (std::size_t i { 1 }; i < PIPELINE_STAGES_COUNT; i++) {
+        json << (i == 1 ? "\n" : ",\n");
+        json << "    \"" << stageName(static_cast<PipelineStage>(i)) << "\": ";
+        writeLatencies(json, stage_latencies_[i]);
+    }
+    json << "\n  },\n";
+
+    json << "  \"end_to_end\": ";
+    writeLatencies(json, end_to_end_latency_);
+    json << "\n}\n";
+
+    return json.str();
+}
+
+void LatencyTracer::dump() const {
+    std::ofstream dump_file { dump_path_ };
+
+    if (!(dump_file << toJson()))
+        throw std::runtime_error { "Unable to write latency trace to " + dump_path_ };
+}
+
+const std::string& LatencyTracer::dumpPath() const {
+    return dump_path_;
+}
+
+
+}
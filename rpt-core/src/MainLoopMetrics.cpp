@@ -0,0 +1,75 @@
+#include <RpT-Core/MainLoopMetrics.hpp>
+
+
+namespace RpT::Core {
+
+
+MainLoopMetrics::MainLoopMetrics() : rejected_requests_ { 0 }, polled_events_ { 0 } {}
+
+void MainLoopMetrics::serviceRequestHandled(const std::string_view service_name, const bool succeeded) {
+    auto service_counters { service_requests_.find(service_name) };
+    if (service_counters == service_requests_.end()) // Name is copied only for first request handled by service
+        service_counters = service_requests_.emplace(std::string { service_name }, ServiceRequestsCounters {}).first;
+
+    if (succeeded)
+        service_counters->second.succeeded++;
+    else
+        service_counters->second.failed++;
+}
+
+void MainLoopMetrics::serviceRequestRejected() {
+    rejected_requests_++;
+}
+
+void MainLoopMetrics::serviceEventsPolled(const std::uint64_t events_count) {
+    polled_events_ += events_count;
+}
+
+void MainLoopMetrics::iterationDone(const std::uint64_t nanoseconds) {
+    iteration_latency_.record(nanoseconds);
+}
+
+MainLoopMetrics::ServiceRequestsCounters MainLoopMetrics::serviceRequests(const std::string_view service_name) const {
+    const auto service_counters { service_requests_.find(service_name) };
+
+    return service_counters == service_requests_.end() ? ServiceRequestsCounters {} : service_counters->second;
+}
+
+std::uint64_t MainLoopMetrics::rejectedRequests() const {
+    return rejected_requests_;
+}
+
+std::uint64_t MainLoopMetrics::polledEvents() const {
+    return polled_events_;
+}
+
+const Utils::LatencyHistogram& MainLoopMetrics::iterationLatency() const {
+    return iteration_latency_;
+}
+
+void MainLoopMetrics::writeTo(Utils::PrometheusWriter& metrics) const {
+    metrics.family("rpt_service_requests_total", Utils::MetricType::Counter,
+                   "Service Requests handled by each service, by response result.");
+
+    for (const auto& [service_name, counters] : service_requests_) {
+        metrics.sample("rpt_service_requests_total", counters.succeeded,
+                       { { "service", service_name }, { "result", "ok" } });
+        metrics.sample("rpt_service_requests_total", counters.failed,
+                       { { "service", service_name }, { "result", "ko" } });
+    }
+
+    metrics.family("rpt_service_requests_rejected_total", Utils::MetricType::Counter,
+                   "Service Requests ill-formed or intended to an unknown service.");
+    metrics.sample("rpt_service_requests_rejected_total", rejected_requests_);
+
+    metrics.family("rpt_service_events_polled_total", Utils::MetricType::Counter,
+                   "Service Events polled by main loop.");
+    metrics.sample("rpt_service_events_polled_total", polled_events_);
+
+    metrics.summary("rpt_main_loop_iteration_seconds",
+                    "Time spent by main loop on one batch of input events and on Service Events they caused.",
+                    iteration_latency_);
+}
+
+
+}
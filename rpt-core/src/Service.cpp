@@ -8,34 +8,86 @@
 namespace RpT::Core {
 
 
-ServiceContext::ServiceContext() : events_count_ { 0 } {}
+ServiceContext::ServiceContext() :
+        events_count_ { 0 }, services_count_ { 0 }, attached_ { false }, first_pending_ { 0 } {}
 
 std::size_t ServiceContext::newEventPushed() {
     return events_count_++;
 }
 
-Service::Service(ServiceContext& run_context) : run_context_ { run_context } {}
+std::size_t ServiceContext::newServiceConstructed() {
+    return services_count_++;
+}
 
-void Service::emitEvent(std::string event_command) {
-    const std::size_t event_id { run_context_.newEventPushed() }; // Event counter is growing, ID is given so trigger order is kept
+std::size_t ServiceContext::servicesCount() const {
+    return services_count_;
+}
+
+bool ServiceContext::attached() const {
+    return attached_;
+}
+
+void ServiceContext::attach() {
+    attached_ = true;
+}
+
+void ServiceContext::detach() {
+    attached_ = false;
+}
+
+void ServiceContext::pushEvent(const Service& emitter, std::string event_command) {
+    // Polled events are erased once they're the majority, so log doesn't grow if it is never completely polled
+    if (first_pending_ > 0 && first_pending_ * 2 >= events_log_.size()) {
+        events_log_.erase(events_log_.begin(), events_log_.begin() + first_pending_);
+        first_pending_ = 0;
+    }
+
+    const std::size_t event_id { newEventPushed() }; // Event counter is growing, ID is given so trigger order is kept
+
+    events_log_.push_back({ event_id, emitter.id(), std::move(event_command) });
+}
+
+bool ServiceContext::empty() const {
+    return first_pending_ == events_log_.size();
+}
 
-    events_queue_.push({ event_id, std::move(event_command) }); // Event command moved in queue with appropriate ID
+std::size_t ServiceContext::pendingCount() const {
+    return events_log_.size() - first_pending_;
 }
 
-std::optional<std::size_t> Service::checkEvent() const {
-    return events_queue_.empty() ? EMPTY_QUEUE : events_queue_.front().first;
+ServiceContext::EventsRange ServiceContext::pendingEvents() const {
+    return { events_log_.cbegin() + first_pending_, events_log_.cend() };
+}
+
+ServiceContext::EmittedEvent ServiceContext::pollEvent() {
+    if (empty()) // There must be at least one event to poll, checked with empty() call
+        throw EmptyEventsQueue {};
+
+    // Command is moved from log, and will be returned by copy-elision later
+    EmittedEvent next_event { std::move(events_log_[first_pending_]) };
+    first_pending_++;
+
+    if (empty()) { // Every event polled, log is reset and keeps its capacity for next emitted events
+        events_log_.clear();
+        first_pending_ = 0;
+    }
+
+    return next_event;
 }
 
-std::string Service::pollEvent() {
-    if (events_queue_.empty()) // There must be at least one event to poll, checked with checkEvent() call
-        throw EmptyEventsQueue { name() };
+Service::Service(ServiceContext& run_context) :
+        run_context_ { run_context }, id_ { run_context.newServiceConstructed() } {}
+
+void Service::emitEvent(std::string event_command) {
+    run_context_.pushEvent(*this, std::move(event_command)); // Event command moved in log after previous events
+}
 
-    // Command is moved from queue to local, and will be returned by copy-elision later
-    std::string event_command { std::move(events_queue_.front().second) };
-    // Event with moved command can now be destroyed
-    events_queue_.pop();
+ServiceContext& Service::runContext() const {
+    return run_context_;
+}
 
-    return event_command;
+std::size_t Service::id() const {
+    return id_;
 }
 
 
@@ -38,37 +38,17 @@ std::string_view ServiceEventRequestProtocol::ServiceRequestCommandParser::comma
 }
 
 
-bool ServiceEventRequestProtocol::CachedServiceEventEmitter::operator>(
-        const ServiceEventRequestProtocol::CachedServiceEventEmitter& rhs) const {
-
-    assert(emittedEventId != rhs.emittedEventId); // All emitted SE must have an unique ID
-
-    return emittedEventId < rhs.emittedEventId;
-}
-
-bool ServiceEventRequestProtocol::CachedServiceEventEmitter::operator<(
-        const ServiceEventRequestProtocol::CachedServiceEventEmitter& rhs) const {
-
-    return !(*this > rhs);
-}
-
-
-Service& ServiceEventRequestProtocol::latestEventEmitter() {
-    assert(!latest_se_emitters_cache_.empty()); // Cache queue must contains at least one event emitter
-
-    // Retrieves ref for Service which has emitted the next event to poll
-    Service& latest_event_emitter { *latest_se_emitters_cache_.top().queuedEmitter };
-    // Removes emitter from cache, its event will be polled
-    latest_se_emitters_cache_.pop();
+ServiceEventRequestProtocol::ServiceEventRequestProtocol(
+        const std::initializer_list<std::reference_wrapper<Service>>& services,
+        Utils::LoggingContext& logging_context) :
 
-    return latest_event_emitter;
-}
+        ServiceEventRequestProtocol { std::vector<std::reference_wrapper<Service>> { services }, logging_context } {}
 
 ServiceEventRequestProtocol::ServiceEventRequestProtocol(
-        const std::initializer_list<std::reference_wrapper<Service>>& services,
+        const std::vector<std::reference_wrapper<Service>>& services,
         Utils::LoggingContext& logging_context) :
 
-        logger_ { "SER-Protocol", logging_context } {
+        logger_ { "SER-Protocol", logging_context }, services_context_ { nullptr }, main_loop_metrics_ { nullptr } {
 
     // Each given service reference must be registered as running service
     for (const auto service_ref : services) {
@@ -77,12 +57,35 @@ ServiceEventRequestProtocol::ServiceEventRequestProtocol(
         if (isRegistered(service_name)) // Service name must be unique among running services
             throw ServiceNameAlreadyRegistered { service_name };
 
+        ServiceContext& service_context { service_ref.get().runContext() };
+        if (!services_context_) // First service context is the one every event will be polled from
+            services_context_ = &service_context;
+        else if (services_context_ != &service_context) // Events emitted inside another context would be missed
+            throw ServicesContextMismatch { service_name };
+
         const auto service_registration_result { running_services_.insert({ service_name, service_ref }) };
         // Must be sure that service has been successfully registered, this is why insertion result is saved
         assert(service_registration_result.second);
 
         logger_.debug("Registered service {}.", service_name);
     }
+
+    if (services_context_) { // Only if there is any running service
+        // Polled events are removed from log, so they would be missed by any other SER Protocol polling same context
+        if (services_context_->attached())
+            throw ServicesContextAlreadyAttached { services.front().get().name() };
+
+        services_by_id_.resize(services_context_->servicesCount(), nullptr);
+        for (const auto service_ref : services)
+            services_by_id_[service_ref.get().id()] = &service_ref.get();
+
+        services_context_->attach();
+    }
+}
+
+ServiceEventRequestProtocol::~ServiceEventRequestProtocol() {
+    if (services_context_)
+        services_context_->detach();
 }
 
 
@@ -90,6 +93,10 @@ bool ServiceEventRequestProtocol::isRegistered(const std::string_view service) c
     return running_services_.count(service) == 1; // Returns if service name is present among running services
 }
 
+void ServiceEventRequestProtocol::recordMetricsWith(MainLoopMetrics& main_loop_metrics) {
+    main_loop_metrics_ = &main_loop_metrics;
+}
+
 std::string ServiceEventRequestProtocol::handleServiceRequest(const std::uint64_t actor,
                                                               const std::string_view service_request) {
 
@@ -114,13 +121,21 @@ std::string ServiceEventRequestProtocol::handleServiceRequest(const std::uint64_
 
     assert(!intended_service_name.empty()); // Service name must be initialized if try statement passed successfully
 
+    return handleServiceRequest(actor, request_uid, intended_service_name, command_data);
+}
+
+std::string ServiceEventRequestProtocol::handleServiceRequest(const std::uint64_t actor,
+                                                              const std::uint64_t request_uid,
+                                                              const std::string_view intended_service_name,
+                                                              const std::string_view command_data) {
+
     // Checks for intended service registration
     if (!isRegistered(intended_service_name))
         throw ServiceNotFound { intended_service_name };
 
     Service& intended_service { running_services_.at(intended_service_name).get() };
 
-    logger_.trace("SR command successfully parsed, handled by service: {}", intended_service_name);
+    logger_.trace("SR {} from \"{}\" handled by service: {}", request_uid, actor, intended_service_name);
 
     // SRR beginning is always `RESPONSE <RUID>`
     const std::string sr_response_prefix {
@@ -132,6 +147,9 @@ std::string ServiceEventRequestProtocol::handleServiceRequest(const std::uint64_
         // Handles SR command and saves result
         const Utils::HandlingResult command_result { intended_service.handleRequestCommand(actor, command_data) };
 
+        if (main_loop_metrics_)
+            main_loop_metrics_->serviceRequestHandled(intended_service_name, static_cast<bool>(command_result));
+
         if (command_result) // If command was successfully handled, must retrieves OK Service Request Response
             return sr_response_prefix + "OK";
         else // Else, command failed and KO response must be retrieved
@@ -139,50 +157,45 @@ std::string ServiceEventRequestProtocol::handleServiceRequest(const std::uint64_
     } catch (const std::exception& err) { // If exception is thrown by intended service
         logger_.error("Service \"{}\" failed to handle command: {}" , intended_service_name, err.what());
 
+        if (main_loop_metrics_)
+            main_loop_metrics_->serviceRequestHandled(intended_service_name, false);
+
         // Retrieves error Service Request Response with given caught message `RESPONSE <RUID> KO <ERR_MSG>`
-        return sr_response_prefix + std::to_string(request_uid) + " KO " + err.what();
+        return sr_response_prefix + "KO " + err.what();
     }
 }
 
 std::optional<std::string> ServiceEventRequestProtocol::pollServiceEvent() {
     std::optional<std::string> next_event; // Event to poll is first uninitialized
 
-    Service* latest_event_emitter { nullptr }; // Will be set any event has been emitted by a service
+    // While any event was emitted, oldest one is the next to poll
+    while (!next_event && services_context_ && !services_context_->empty()) {
+        const ServiceContext::EmittedEvent emitted_event { services_context_->pollEvent() };
 
-    // There might be events emitter cached if we know they are holding Service Event with the next higher priority
-    // (lower unsigned integer)
-    if (!latest_se_emitters_cache_.empty()) {
-        latest_event_emitter = &latestEventEmitter(); // Saves address for next event emitter
-    } else { // If not any Service is cached as next event emitter...
-        // ...checks next event ID for each service and caches service into next events emiiters queue
+        // Services constructed after this instance aren't registered either
+        const Service* emitter {
+            emitted_event.service < services_by_id_.size() ? services_by_id_[emitted_event.service] : nullptr
+        };
 
-        for (auto [service_name, registered_service] : running_services_) {
-            const std::optional<std::size_t> next_event_id { registered_service.get().checkEvent() };
+        if (!emitter) { // Only events from running services are dispatched across actors
+            logger_.trace("Discarded event {} from unregistered service {}", emitted_event.id, emitted_event.service);
 
-            if (next_event_id.has_value()) { // If Service emitted event...
-                // ...then cache emitter into queue with corresponding event emitter priority
-                latest_se_emitters_cache_.push({ *next_event_id, &registered_service.get() });
-
-                logger_.trace("Service {} last event ID: {}. Cached as emitter.", service_name, *next_event_id);
-            } else { // If Service didn't emit anything
-                logger_.trace("Service {} hasn't any event.", service_name);
-            }
+            continue;
         }
 
-        // All next known events are cached, next from cached will be retrieved (if any event has been emitted)
-        if (!latest_se_emitters_cache_.empty())
-            latest_event_emitter = &latestEventEmitter();
-    }
+        const std::string_view service_name { emitter->name() };
 
-    if (latest_event_emitter) { // If there is any emitted event, format it and move it into polled event
-        const std::string service_name_copy { latest_event_emitter->name() }; // Required for concatenation
+        // Formats `EVENT <SERVICE_NAME> <command>` with a single allocation
+        next_event.emplace();
+        next_event->reserve(EVENT_PREFIX.size() + service_name.size() + emitted_event.command.size() + 2);
+        next_event->append(EVENT_PREFIX).append(1, ' ').append(service_name).append(1, ' ');
+        next_event->append(emitted_event.command);
 
-        next_event = std::string { EVENT_PREFIX } + ' ' + service_name_copy + ' ' + latest_event_emitter->pollEvent();
+        logger_.trace("Polled event {} from service {}: {}", emitted_event.id, service_name, *next_event);
+    }
 
-        logger_.trace("Polled event from service {}: {}", latest_event_emitter->name(), *next_event);
-    } else {
+    if (!next_event)
         logger_.trace("No event to retrieve.");
-    }
 
     return next_event;
 }
@@ -0,0 +1,761 @@
+#ifndef RPTOGETHER_SERVER_LOADGENERATOR_INL
+#define RPTOGETHER_SERVER_LOADGENERATOR_INL
+
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <csignal>
+#include <memory>
+#include <queue>
+#include <random>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+#include <boost/asio/signal_set.hpp>
+#include <boost/asio/ssl.hpp>
+#include <boost/beast.hpp>
+#include <boost/beast/ssl.hpp>
+#include <RpT-Loadgen/LoadReport.hpp>
+#include <RpT-Loadgen/RequestMix.hpp>
+#include <RpT-Utils/LoggerView.hpp>
+
+/**
+ * @file LoadGenerator.inl
+ */
+
+
+namespace RpT::Loadgen {
+
+
+/// Websocket stream over plain TCP, for servers running `unsafe-ws` backend
+using WebsocketStream = boost::beast::websocket::stream<boost::beast::tcp_stream>;
+/// Websocket stream over TLS, for servers running `wss` backend
+using SecureWebsocketStream = boost::beast::websocket::stream<boost::beast::ssl_stream<boost::beast::tcp_stream>>;
+
+
+/**
+ * @brief Options for a load generation run
+ */
+struct LoadOptions {
+    /// Server host name or address, also used for TLS server name indication and certificate verification
+    std::string host { "localhost" };
+    /// Server port
+    std::uint16_t port { 35555 };
+    /// Clients connected to server, each one with its own connection
+    std::size_t clientsCount { 100 };
+    /// Actor UID for first client, next clients use following UIDs
+    std::uint64_t firstUid { 1 };
+    /// Maximum count of clients connecting at the same time, so server handshakes aren't overwhelmed
+    std::size_t maxConnecting { 100 };
+    /// Time for clients to send Service Requests once every client is logged in
+    std::chrono::steady_clock::duration loadDuration { std::chrono::seconds { 10 } };
+    /// Time to wait for remaining responses once clients stopped sending Service Requests
+    std::chrono::steady_clock::duration drainTimeout { std::chrono::seconds { 5 } };
+    /// Time for clients to log out before remaining connections are dropped
+    std::chrono::steady_clock::duration closeTimeout { std::chrono::seconds { 5 } };
+    /// Time for TCP connection and TLS handshake before a client is considered unable to connect
+    std::chrono::steady_clock::duration connectTimeout { std::chrono::seconds { 10 } };
+    /// Service Requests sent periodically by each client
+    std::vector<MixedRequest> mix;
+};
+
+
+/**
+ * @brief Opens many Websocket connections to an RpT server from a single thread, logs each one in as its own actor,
+ * then sends Service Requests from each client at configured rates and measures time until replies are received
+ *
+ * Clients connect while limiting how many of them are connecting at once. Once every client is either logged in or
+ * failed, each logged in client sends every request of the mix at its own rate, with a random phase so requests
+ * aren't sent in bursts. Load is open-loop: requests are sent at schedule whether previous ones were answered or not,
+ * so server saturation shows up in latencies rather than in sending rate.
+ *
+ * Response latency is the time from a Service Request being sent to the `SERVICE RESPONSE` with the same RUID being
+ * received. To measure Service Events latency, each request command data is followed by a ` #<actor_uid>:<ruid>`
+ * tag. Any `SERVICE EVENT` which data ends with such a tag, as Chat messages events do, is timed from the tagged
+ * request being sent to it being received, for every client receiving it.
+ *
+ * After load duration, clients stop sending requests and remaining responses are waited for until drain timeout.
+ * Every client then logs out with a `LOGOUT` command.
+ *
+ * `SIGINT` and `SIGTERM` stop load early, a second signal drops every connection.
+ *
+ * @tparam Stream Either `WebsocketStream` or `SecureWebsocketStream`
+ *
+ * @author ThisALV, https://github.com/ThisALV
+ */
+template<typename Stream>
+class LoadGenerator {
+private:
+    static constexpr bool IS_SECURE {
+        std::is_same_v<Stream, SecureWebsocketStream>
+    };
+
+    using Clock = std::chrono::steady_clock;
+
+    /// Progress of load generation run, each phase is followed by the next one
+    enum struct Phase {
+        Connecting, Loading, Draining, Closing
+    };
+
+    /// Progress of one client connection
+    enum struct ClientState {
+        Connecting, LoggingIn, LoggedIn, LoggingOut, Closed
+    };
+
+    /// Service Request sent by a client, identified by its RUID
+    struct SentRequest {
+        /// When request was queued for sending
+        Clock::time_point sentAt;
+        /// Request inside mix
+        std::size_t mixIndex;
+        /// Has response with request RUID been received
+        bool answered;
+    };
+
+    /**
+     * @brief Websocket connection for one actor, sending requests for each mix request at scheduled time
+     *
+     * Every operation runs on generator thread, so there isn't any synchronization.
+     *
+     * @author ThisALV, https://github.com/ThisALV
+     */
+    class Client {
+    private:
+        LoadGenerator& generator_;
+        const std::uint64_t actor_uid_;
+        Stream stream_;
+        boost::beast::flat_buffer received_message_;
+        // Websocket stream allows only one write operation at a time
+        std::queue<std::string> sending_queue_;
+        bool writing_;
+        ClientState state_;
+        // One timer for each mix request
+        std::vector<boost::asio::steady_timer> request_timers_;
+        // Indexed by RUID, which are given in order from 0
+        std::vector<SentRequest> sent_requests_;
+        std::size_t pending_responses_;
+
+        /// Closes connection because of an error, increasing given report counter
+        void fail(std::uint64_t LoadReport::* error_counter) {
+            if (state_ == ClientState::Closed)
+                return;
+
+            generator_.report_.*error_counter += 1;
+            close();
+        }
+
+        /// Handles connection being lost, which is an error unless client was logging out
+        void connectionLost() {
+            if (state_ == ClientState::LoggingOut)
+                close();
+            else if (state_ == ClientState::LoggedIn)
+                fail(&LoadReport::disconnections);
+            else if (state_ != ClientState::Closed) // Connection was lost during handshake
+                fail(&LoadReport::loginErrors);
+        }
+
+        /// Stops sending requests, closes connection and notifies generator
+        void close() {
+            const ClientState previous_state { state_ };
+            state_ = ClientState::Closed;
+
+            stopRequests();
+
+            boost::system::error_code ignored_err;
+            boost::beast::get_lowest_layer(stream_).socket().close(ignored_err);
+
+            generator_.clientClosed(*this, previous_state);
+        }
+
+        /// Connects TCP socket to one of resolved server endpoints
+        void connect(const boost::asio::ip::tcp::resolver::results_type& server_endpoints) {
+            boost::beast::get_lowest_layer(stream_).expires_after(generator_.options_.connectTimeout);
+            boost::beast::get_lowest_layer(stream_).async_connect(server_endpoints, [this](
+                    const boost::system::error_code& err, const boost::asio::ip::tcp::endpoint&) {
+
+                if (err) {
+                    fail(&LoadReport::connectErrors);
+                    return;
+                }
+
+                // Requests are latency sensitive and small, they must not wait for more data to be sent
+                boost::beast::get_lowest_layer(stream_).socket().set_option(boost::asio::ip::tcp::no_delay { true });
+
+                if constexpr (IS_SECURE)
+                    handshakeTls();
+                else
+                    handshakeWebsocket();
+            });
+        }
+
+        /// Performs TLS handshake with server name indication, then Websocket handshake
+        void handshakeTls() {
+            SSL* const tls_session { stream_.next_layer().native_handle() };
+            // Server is checked against given host name, unless certificate verification is disabled
+            SSL_set_tlsext_host_name(tls_session, generator_.options_.host.c_str());
+            SSL_set1_host(tls_session, generator_.options_.host.c_str());
+
+            stream_.next_layer().async_handshake(boost::asio::ssl::stream_base::client, [this](
+                    const boost::system::error_code& err) {
+
+                if (err) {
+                    fail(&LoadReport::handshakeErrors);
+                    return;
+                }
+
+                handshakeWebsocket();
+            });
+        }
+
+        /// Performs Websocket handshake then sends LOGIN command
+        void handshakeWebsocket() {
+            // Websocket stream has its own timeouts
+            boost::beast::get_lowest_layer(stream_).expires_never();
+            stream_.set_option(
+                    boost::beast::websocket::stream_base::timeout::suggested(boost::beast::role_type::client));
+
+            stream_.async_handshake(generator_.host_header_, "/", [this](const boost::system::error_code& err) {
+                if (err) {
+                    fail(&LoadReport::handshakeErrors);
+                    return;
+                }
+
+                generator_.report_.connected++;
+                state_ = ClientState::LoggingIn;
+                stream_.text(true);
+
+                const std::string actor_uid_copy { std::to_string(actor_uid_) };
+                send("LOGIN " + actor_uid_copy + " loadgen" + actor_uid_copy);
+                receiveNextMessage();
+            });
+        }
+
+        /// Queues given RPTL message, sending it immediately if no other message is being sent
+        void send(std::string rptl_message) {
+            sending_queue_.push(std::move(rptl_message));
+
+            if (!writing_)
+                sendNextMessage();
+        }
+
+        /// Sends message in front of queue, then next ones until queue is empty
+        void sendNextMessage() {
+            writing_ = true;
+
+            stream_.async_write(boost::asio::buffer(sending_queue_.front()), [this](
+                    const boost::system::error_code& err, std::size_t) {
+
+                writing_ = false;
+                sending_queue_.pop();
+
+                if (err) {
+                    connectionLost();
+                    return;
+                }
+
+                if (!sending_queue_.empty() && state_ != ClientState::Closed)
+                    sendNextMessage();
+            });
+        }
+
+        /// Waits for next RPTL message from server, then handles it
+        void receiveNextMessage() {
+            stream_.async_read(received_message_, [this](const boost::system::error_code& err, std::size_t) {
+                if (err) {
+                    connectionLost();
+                    return;
+                }
+
+                const Clock::time_point received_at { Clock::now() };
+                const auto& message_data { received_message_.data() };
+                handleMessage({ static_cast<const char*>(message_data.data()), message_data.size() }, received_at);
+
+                received_message_.consume(received_message_.size());
+
+                if (state_ != ClientState::Closed)
+                    receiveNextMessage();
+            });
+        }
+
+        /// Handles RPTL message from server, received at given time
+        void handleMessage(const std::string_view rptl_message, const Clock::time_point received_at) {
+            constexpr std::string_view SRR_PREFIX { "SERVICE RESPONSE " };
+            constexpr std::string_view SE_PREFIX { "SERVICE EVENT " };
+            constexpr std::string_view LOGGED_IN_PREFIX { "LOGGED_IN " };
+            constexpr std::string_view INTERRUPT_COMMAND { "INTERRUPT" };
+
+            if (rptl_message.substr(0, SRR_PREFIX.size()) == SRR_PREFIX) {
+                handleResponse(rptl_message.substr(SRR_PREFIX.size()), received_at);
+            } else if (rptl_message.substr(0, SE_PREFIX.size()) == SE_PREFIX) {
+                generator_.eventReceived(rptl_message.substr(SE_PREFIX.size()), received_at);
+            } else if (rptl_message.substr(0, LOGGED_IN_PREFIX.size()) == LOGGED_IN_PREFIX) {
+                // Every client is notified for each login, only own actor login completes handshake
+                const std::string_view login_args { rptl_message.substr(LOGGED_IN_PREFIX.size()) };
+                const std::string own_login_prefix { std::to_string(actor_uid_) + ' ' };
+
+                const bool own_login { login_args.substr(0, own_login_prefix.size()) == own_login_prefix };
+
+                if (state_ == ClientState::LoggingIn && own_login) {
+                    state_ = ClientState::LoggedIn;
+                    generator_.clientLoggedIn();
+                }
+            } else if (rptl_message.substr(0, INTERRUPT_COMMAND.size()) == INTERRUPT_COMMAND) {
+                // Connection is closed by server right after, error is counted now to know what happened
+                if (state_ == ClientState::LoggingIn) {
+                    generator_.logger_.warn("Actor {} login rejected: {}", actor_uid_, rptl_message);
+                    fail(&LoadReport::loginErrors);
+                } else if (state_ == ClientState::LoggedIn) {
+                    generator_.logger_.warn("Actor {} interrupted: {}", actor_uid_, rptl_message);
+                    fail(&LoadReport::disconnections);
+                }
+            } // Other messages like REGISTRATION or LOGGED_OUT aren't measured
+        }
+
+        /// Handles `SERVICE RESPONSE` message arguments, formatted as `<RUID> OK` or `<RUID> KO <ERR_MSG>`
+        void handleResponse(const std::string_view srr_args, const Clock::time_point received_at) {
+            std::uint64_t ruid;
+            const char* const srr_args_end { srr_args.data() + srr_args.size() };
+            const auto [ruid_end, parsing_err] { std::from_chars(srr_args.data(), srr_args_end, ruid) };
+
+            // Response must be for a request sent by this client which wasn't answered yet
+            if (parsing_err != std::errc {} || ruid >= sent_requests_.size() || sent_requests_[ruid].answered) {
+                generator_.logger_.warn("Actor {} received unexpected response: {}", actor_uid_, srr_args);
+                return;
+            }
+
+            SentRequest& answered_request { sent_requests_[ruid] };
+            answered_request.answered = true;
+            pending_responses_--;
+
+            RequestResults& results { generator_.report_.requests[answered_request.mixIndex] };
+            const std::string_view status { ruid_end, static_cast<std::size_t>(srr_args_end - ruid_end) };
+
+            if (status.substr(0, 3) == " OK")
+                results.succeeded++;
+            else
+                results.failed++;
+
+            results.responseLatency.record(microsecondsBetween(answered_request.sentAt, received_at));
+
+            generator_.responseReceived();
+        }
+
+        /// Sends given mix request at given time, then schedules next one
+        void scheduleRequest(const std::size_t mix_index, const Clock::time_point sending_time) {
+            boost::asio::steady_timer& request_timer { request_timers_[mix_index] };
+
+            request_timer.expires_at(sending_time);
+            request_timer.async_wait([this, mix_index, sending_time](const boost::system::error_code& err) {
+                if (err) // Requests were stopped
+                    return;
+
+                sendRequest(mix_index);
+
+                // Next request is scheduled from previous schedule, so rate doesn't drift if client falls behind
+                scheduleRequest(mix_index, sending_time + generator_.request_intervals_[mix_index]);
+            });
+        }
+
+        /// Sends given mix request with next RUID, tagged so Service Events can be tracked back to it
+        void sendRequest(const std::size_t mix_index) {
+            const MixedRequest& request { generator_.options_.mix[mix_index] };
+            const std::string ruid_copy { std::to_string(sent_requests_.size()) };
+
+            std::string sr_command { "SERVICE REQUEST " + ruid_copy + ' ' + request.serviceName + ' ' };
+            if (!request.commandData.empty())
+                sr_command.append(request.commandData) += ' ';
+
+            sr_command.append("#" + std::to_string(actor_uid_) + ':' + ruid_copy);
+
+            sent_requests_.push_back({ Clock::now(), mix_index, false });
+            pending_responses_++;
+            generator_.report_.requests[mix_index].sent++;
+            generator_.requestSent();
+
+            send(std::move(sr_command));
+        }
+
+    public:
+        /// Constructs client for given actor UID, using given TLS context if stream is secure
+        Client(LoadGenerator& generator, const std::uint64_t actor_uid)
+        : generator_ { generator }, actor_uid_ { actor_uid }, stream_ { makeStream(generator) }, writing_ { false },
+        state_ { ClientState::Connecting }, pending_responses_ { 0 } {
+            request_timers_.reserve(generator_.options_.mix.size());
+
+            for (std::size_t i { 0 }; i < generator_.options_.mix.size(); i++)
+                request_timers_.emplace_back(generator_.io_context_);
+        }
+
+        /// Constructs stream running on generator context, with generator TLS context if stream is secure
+        static Stream makeStream(LoadGenerator& generator) {
+            if constexpr (IS_SECURE)
+                return Stream { generator.io_context_, *generator.tls_context_ };
+            else
+                return Stream { generator.io_context_ };
+        }
+
+        /// Starts connection, TLS handshake, Websocket handshake and login
+        void start(const boost::asio::ip::tcp::resolver::results_type& server_endpoints) {
+            connect(server_endpoints);
+        }
+
+        /// Schedules every mix request with a random phase inside its interval, starting from given time
+        void startRequests(const Clock::time_point load_start) {
+            for (std::size_t i { 0 }; i < request_timers_.size(); i++) {
+                const Clock::duration interval { generator_.request_intervals_[i] };
+                std::uniform_int_distribution<Clock::rep> phase_distribution { 0, interval.count() };
+
+                scheduleRequest(i, load_start + Clock::duration { phase_distribution(generator_.random_engine_) });
+            }
+        }
+
+        /// Cancels every scheduled request
+        void stopRequests() {
+            for (boost::asio::steady_timer& request_timer : request_timers_)
+                request_timer.cancel();
+        }
+
+        /// Sends LOGOUT command if logged in, drops connection otherwise
+        void logout() {
+            if (state_ == ClientState::LoggedIn) {
+                state_ = ClientState::LoggingOut;
+                send("LOGOUT");
+            } else if (state_ != ClientState::LoggingOut && state_ != ClientState::Closed) {
+                fail(&LoadReport::loginErrors); // Client couldn't log in before run was stopped
+            }
+        }
+
+        /// Drops connection without logging out, because server took too long to close it
+        void drop() {
+            if (state_ != ClientState::Closed)
+                fail(&LoadReport::disconnections);
+        }
+
+        /// Checks if client is logged in and sending requests
+        bool loggedIn() const {
+            return state_ == ClientState::LoggedIn;
+        }
+
+        /// Count of requests sent by client without a response
+        std::size_t pendingResponses() const {
+            return pending_responses_;
+        }
+
+        /// Retrieves request sent with given RUID, or `nullptr` if there isn't any
+        const SentRequest* sentRequest(const std::uint64_t ruid) const {
+            return ruid < sent_requests_.size() ? &sent_requests_[ruid] : nullptr;
+        }
+    };
+
+    /// Parses request tag formatted as `<actor_uid>:<ruid>` into given integers, returns `false` if ill-formed
+    static bool parseRequestTag(const std::string_view tag, std::uint64_t& actor_uid, std::uint64_t& ruid) {
+        const char* const tag_end { tag.data() + tag.size() };
+
+        const auto [actor_uid_end, actor_uid_err] { std::from_chars(tag.data(), tag_end, actor_uid) };
+        if (actor_uid_err != std::errc {} || actor_uid_end == tag_end || *actor_uid_end != ':')
+            return false;
+
+        const auto [ruid_end, ruid_err] { std::from_chars(actor_uid_end + 1, tag_end, ruid) };
+
+        return ruid_err == std::errc {} && ruid_end == tag_end;
+    }
+
+    /// Microseconds elapsed from first to second given time point
+    static std::uint64_t microsecondsBetween(const Clock::time_point from, const Clock::time_point to) {
+        return std::chrono::duration_cast<std::chrono::microseconds>(to - from).count();
+    }
+
+    const LoadOptions options_;
+    boost::asio::ssl::context* const tls_context_;
+    const std::string host_header_;
+    // Interval between two requests sent by a client, for each mix request
+    std::vector<Clock::duration> request_intervals_;
+
+    boost::asio::io_context io_context_;
+    boost::asio::signal_set stop_signals_;
+    // Waits for load duration, then drain timeout, then close timeout
+    boost::asio::steady_timer phase_timer_;
+    std::mt19937_64 random_engine_;
+    Utils::LoggerView logger_;
+
+    Phase phase_;
+    boost::asio::ip::tcp::resolver::results_type server_endpoints_;
+    // Each client owns its timers and stream, so it mustn't be moved
+    std::vector<std::unique_ptr<Client>> clients_;
+    // Next client to start
+    std::size_t next_client_;
+    std::size_t connecting_clients_;
+    std::size_t closed_clients_;
+    std::size_t pending_responses_;
+    Clock::time_point load_start_;
+
+    LoadReport report_;
+
+    /// Starts clients until every client is started, or until connecting clients limit is reached
+    void connectNextClients() {
+        while (next_client_ < clients_.size() && connecting_clients_ < options_.maxConnecting) {
+            connecting_clients_++;
+            clients_[next_client_++]->start(server_endpoints_);
+        }
+
+        // Load starts once every client either logged in or failed
+        if (phase_ == Phase::Connecting && next_client_ == clients_.size() && connecting_clients_ == 0)
+            startLoad();
+    }
+
+    /// Called when a client received its own LOGGED_IN message
+    void clientLoggedIn() {
+        report_.loggedIn++;
+        connecting_clients_--;
+
+        connectNextClients();
+    }
+
+    /// Called when a client connection was closed, given state is client state before it was closed
+    void clientClosed(const Client& client, const ClientState previous_state) {
+        closed_clients_++;
+
+        if (previous_state == ClientState::Connecting || previous_state == ClientState::LoggingIn) {
+            connecting_clients_--;
+
+            if (phase_ == Phase::Connecting)
+                connectNextClients();
+        } else if (previous_state == ClientState::LoggedIn) { // Responses will never be received
+            pending_responses_ -= client.pendingResponses();
+
+            if (phase_ == Phase::Draining)
+                checkDrained();
+        }
+
+        // Run is done once every connection is closed
+        if (phase_ == Phase::Closing && closed_clients_ == clients_.size()) {
+            phase_timer_.cancel();
+            stop_signals_.cancel();
+        }
+    }
+
+    /// Called for each Service Request sent
+    void requestSent() {
+        pending_responses_++;
+    }
+
+    /// Called for each Service Request Response received
+    void responseReceived() {
+        pending_responses_--;
+
+        if (phase_ == Phase::Draining)
+            checkDrained();
+    }
+
+    /// Called for each Service Event received, with its arguments formatted as `<service_name> <event_data>`
+    void eventReceived(const std::string_view se_args, const Clock::time_point received_at) {
+        report_.eventsReceived++;
+
+        const std::size_t service_name_end { std::min(se_args.find(' '), se_args.size()) };
+        const std::string_view service_name { se_args.substr(0, service_name_end) };
+
+        // Event is tracked only if it ends with a request tag
+        const std::size_t tag_begin { se_args.rfind('#') };
+        if (tag_begin == std::string_view::npos || tag_begin <= service_name_end || se_args[tag_begin - 1] != ' ') {
+            report_.untrackedEvents++;
+            return;
+        }
+
+        std::uint64_t actor_uid;
+        std::uint64_t ruid;
+        // Tag must have been sent by one of this run clients, with a request for the same service
+        const SentRequest* tagged_request { nullptr };
+        if (parseRequestTag(se_args.substr(tag_begin + 1), actor_uid, ruid) && actor_uid >= options_.firstUid
+            && actor_uid - options_.firstUid < clients_.size()) {
+
+            tagged_request = clients_[actor_uid - options_.firstUid]->sentRequest(ruid);
+        }
+
+        if (tagged_request == nullptr || options_.mix[tagged_request->mixIndex].serviceName != service_name) {
+            report_.untrackedEvents++;
+            return;
+        }
+
+        report_.eventLatency.record(microsecondsBetween(tagged_request->sentAt, received_at));
+    }
+
+    /// Every logged in client starts sending requests for load duration, or run is done if none logged in
+    void startLoad() {
+        if (report_.loggedIn == 0) {
+            logger_.error("No client could log in, no request will be sent.");
+
+            finish();
+            return;
+        }
+
+        logger_.info("{} clients logged in, sending requests for {}s.", report_.loggedIn,
+                     std::chrono::duration_cast<std::chrono::seconds>(options_.loadDuration).count());
+
+        phase_ = Phase::Loading;
+        load_start_ = Clock::now();
+
+        for (const std::unique_ptr<Client>& client : clients_) {
+            if (client->loggedIn())
+                client->startRequests(load_start_);
+        }
+
+        phase_timer_.expires_at(load_start_ + options_.loadDuration);
+        phase_timer_.async_wait([this](const boost::system::error_code& err) {
+            if (!err) // Load might have been stopped early by a signal
+                stopLoad();
+        });
+    }
+
+    /// Every client stops sending requests, then remaining responses are waited for
+    void stopLoad() {
+        report_.loadDuration = Clock::now() - load_start_;
+
+        logger_.info("Load stopped, waiting for {} remaining responses.", pending_responses_);
+
+        phase_ = Phase::Draining;
+        for (const std::unique_ptr<Client>& client : clients_)
+            client->stopRequests();
+
+        phase_timer_.expires_after(options_.drainTimeout);
+        phase_timer_.async_wait([this](const boost::system::error_code& err) {
+            if (!err) // Might have been cancelled because every response was received
+                finish();
+        });
+
+        checkDrained();
+    }
+
+    /// Logs clients out if every response was received
+    void checkDrained() {
+        if (pending_responses_ == 0)
+            finish();
+    }
+
+    /// Every client logs out, remaining connections are dropped after close timeout
+    void finish() {
+        logger_.info("Logging clients out...");
+
+        phase_ = Phase::Closing;
+        for (const std::unique_ptr<Client>& client : clients_)
+            client->logout();
+
+        if (closed_clients_ == clients_.size()) { // Might be the case if no client could log in
+            phase_timer_.cancel();
+            stop_signals_.cancel();
+
+            return;
+        }
+
+        phase_timer_.expires_after(options_.closeTimeout);
+        phase_timer_.async_wait([this](const boost::system::error_code& err) {
+            if (err) // Every connection was closed
+                return;
+
+            logger_.warn("Server didn't close every connection, dropping remaining ones.");
+            dropClients();
+        });
+    }
+
+    /// Drops every connection remaining, without waiting for server to close them
+    void dropClients() {
+        for (const std::unique_ptr<Client>& client : clients_)
+            client->drop();
+    }
+
+    /// Stops current phase early when a signal is caught, second one drops every connection
+    void waitForStopSignal() {
+        stop_signals_.async_wait([this](const boost::system::error_code& err, const int) {
+            if (err) // Run is done
+                return;
+
+            logger_.warn("Stop signal caught.");
+
+            if (phase_ == Phase::Loading) {
+                phase_timer_.cancel();
+                stopLoad();
+            } else if (phase_ == Phase::Closing) {
+                dropClients();
+            } else {
+                finish();
+            }
+
+            if (phase_ != Phase::Closing || closed_clients_ != clients_.size())
+                waitForStopSignal();
+        });
+    }
+
+public:
+    /**
+     * @brief Prepares load generation with given options, clients are connected by `run()`
+     *
+     * @param options Options for clients and load
+     * @param logging_context Context providing logging features
+     * @param tls_context TLS features for clients, required only if stream is secure
+     *
+     * @throws std::invalid_argument If a TLS context is required but none given, or if options are invalid
+     */
+    LoadGenerator(LoadOptions options, Utils::LoggingContext& logging_context,
+                  boost::asio::ssl::context* tls_context = nullptr)
+    : options_ { std::move(options) }, tls_context_ { tls_context },
+    host_header_ { options_.host + ':' + std::to_string(options_.port) },
+    io_context_ { 1 }, stop_signals_ { io_context_, SIGINT, SIGTERM }, phase_timer_ { io_context_ },
+    random_engine_ { std::random_device {}() }, logger_ { "Loadgen", logging_context }, phase_ { Phase::Connecting },
+    next_client_ { 0 }, connecting_clients_ { 0 }, closed_clients_ { 0 }, pending_responses_ { 0 } {
+        if (IS_SECURE && tls_context_ == nullptr)
+            throw std::invalid_argument { "TLS context is required for secure Websocket clients" };
+
+        if (options_.clientsCount == 0 || options_.maxConnecting == 0)
+            throw std::invalid_argument { "Clients count and connecting clients limit must be positive" };
+
+        if (options_.mix.empty())
+            throw std::invalid_argument { "Requests mix must contain at least one request" };
+
+        for (const MixedRequest& request : options_.mix) {
+            request_intervals_.push_back(std::chrono::duration_cast<Clock::duration>(
+                    std::chrono::duration<double> { 1 / request.rate }));
+
+            RequestResults request_results;
+            request_results.request = request;
+            report_.requests.push_back(std::move(request_results));
+        }
+    }
+
+    /**
+     * @brief Connects every client, sends requests for load duration, then logs every client out
+     *
+     * Blocks calling thread until every connection is closed.
+     *
+     * @returns Results for this run
+     *
+     * @throws boost::system::system_error If server host name cannot be resolved
+     */
+    LoadReport run() {
+        server_endpoints_ = boost::asio::ip::tcp::resolver { io_context_ }.resolve(
+                options_.host, std::to_string(options_.port));
+
+        report_.clients = options_.clientsCount;
+        clients_.reserve(options_.clientsCount);
+        for (std::size_t i { 0 }; i < options_.clientsCount; i++)
+            clients_.push_back(std::make_unique<Client>(*this, options_.firstUid + i));
+
+        logger_.info("Connecting {} clients to {}, {} at a time...", options_.clientsCount, host_header_,
+                     std::min(options_.maxConnecting, options_.clientsCount));
+
+        waitForStopSignal();
+        connectNextClients();
+
+        io_context_.run();
+
+        for (const std::unique_ptr<Client>& client : clients_)
+            report_.unanswered += client->pendingResponses();
+
+        return report_;
+    }
+};
+
+
+}
+
+
+#endif //RPTOGETHER_SERVER_LOADGENERATOR_INL
@@ -0,0 +1,88 @@
+#ifndef RPTOGETHER_SERVER_LOADREPORT_HPP
+#define RPTOGETHER_SERVER_LOADREPORT_HPP
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <RpT-Loadgen/RequestMix.hpp>
+#include <RpT-Utils/LatencyHistogram.hpp>
+
+/**
+ * @file LoadReport.hpp
+ */
+
+
+namespace RpT::Loadgen {
+
+
+/**
+ * @brief Results for one request of the mix, accumulated across every client
+ *
+ * @author ThisALV, https://github.com/ThisALV
+ */
+struct RequestResults {
+    /// Request which results are about
+    MixedRequest request;
+    /// Service Requests sent by clients
+    std::uint64_t sent { 0 };
+    /// Service Request Responses with OK status
+    std::uint64_t succeeded { 0 };
+    /// Service Request Responses with KO status
+    std::uint64_t failed { 0 };
+    /// Microseconds from Service Request being sent to its response being received
+    Utils::LatencyHistogram responseLatency;
+};
+
+/**
+ * @brief Results for a load generation run, from clients connection to their logout
+ *
+ * @author ThisALV, https://github.com/ThisALV
+ */
+struct LoadReport {
+    /// Clients which were started
+    std::uint64_t clients { 0 };
+    /// Clients which completed Websocket handshake
+    std::uint64_t connected { 0 };
+    /// Clients which received their own actor LOGGED_IN message
+    std::uint64_t loggedIn { 0 };
+
+    /// Connections which couldn't be established
+    std::uint64_t connectErrors { 0 };
+    /// Connections which failed TLS or Websocket handshake
+    std::uint64_t handshakeErrors { 0 };
+    /// Handshakes rejected by server with an INTERRUPT message
+    std::uint64_t loginErrors { 0 };
+    /// Logged in clients disconnected before their logout, whether by server or by a network error
+    std::uint64_t disconnections { 0 };
+    /// Service Requests without response, because of disconnection or because draining timed out
+    std::uint64_t unanswered { 0 };
+
+    /// Time from first to last Service Request being sent
+    std::chrono::steady_clock::duration loadDuration { 0 };
+    /// Results for each mix request, in mix order
+    std::vector<RequestResults> requests;
+
+    /// Service Events received by every client
+    std::uint64_t eventsReceived { 0 };
+    /// Service Events which data doesn't contain any request tag, so their latency can't be measured
+    std::uint64_t untrackedEvents { 0 };
+    /// Microseconds from Service Request being sent to a Service Event tagged by it being received, for each client
+    Utils::LatencyHistogram eventLatency;
+
+    /**
+     * @brief Formats report as JSON
+     *
+     * Latencies are given in microseconds, as percentiles p50, p90, p99 and max, plus count and mean. Throughput is
+     * given in messages per second for Service Requests sent, Service Request Responses and Service Events received.
+     *
+     * @returns JSON object for this report
+     */
+    std::string toJson() const;
+};
+
+
+}
+
+
+#endif //RPTOGETHER_SERVER_LOADREPORT_HPP
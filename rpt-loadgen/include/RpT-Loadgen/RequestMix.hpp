@@ -0,0 +1,52 @@
+#ifndef RPTOGETHER_SERVER_REQUESTMIX_HPP
+#define RPTOGETHER_SERVER_REQUESTMIX_HPP
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * @file RequestMix.hpp
+ */
+
+
+/**
+ * @brief Load generation client driving many RPTL connections against a running RpT server
+ */
+namespace RpT::Loadgen {
+
+
+/**
+ * @brief Service Request sent periodically by each load generation client
+ *
+ * @author ThisALV, https://github.com/ThisALV
+ */
+struct MixedRequest {
+    /// Service which the request is sent to
+    std::string serviceName;
+    /// Requests sent per second by each client
+    double rate;
+    /// Command data sent to service, might be empty
+    std::string commandData;
+};
+
+/**
+ * @brief Parses Service Requests mix as given to command line
+ *
+ * Mix is a list of requests separated by `;`, each one formatted as `<service_name>:<rate>:<command_data>`. Rate is
+ * the number of requests sent per second by each client and might be fractional. Command data is everything after
+ * rate separator, so it might contain `:`. Default mix is `Chat:1:Hello from rpt-loadgen`.
+ *
+ * @param mix Command line value for requests mix
+ *
+ * @returns One request for each list item, in the same order
+ *
+ * @throws RpT::Utils::OptionsError If mix is empty, if a request is ill-formed or if a rate isn't positive
+ */
+std::vector<MixedRequest> parseRequestMix(std::string_view mix);
+
+
+}
+
+
+#endif //RPTOGETHER_SERVER_REQUESTMIX_HPP
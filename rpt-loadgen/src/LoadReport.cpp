@@ -0,0 +1,106 @@
+#include <RpT-Loadgen/LoadReport.hpp>
+
+#include <cstdio>
+#include <sstream>
+
+
+namespace RpT::Loadgen {
+
+
+namespace {
+
+
+/// Writes given string as JSON string literal, escaping quotes, backslashes and control characters
+void writeJsonString(std::ostringstream& json, const std::string_view value) {
+    json << '"';
+
+    for (const char c : value) {
+        if (c == '"' || c == '\\') {
+            json << '\\' << c;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            char escaped_char[7];
+            std::snprintf(escaped_char, sizeof(escaped_char), "\\u%04x", static_cast<unsigned int>(c));
+
+            json << escaped_char;
+        } else {
+            json << c;
+        }
+    }
+
+    json << '"';
+}
+
+/// Writes latency percentiles, count and mean recorded by given histogram as JSON object
+void writeLatencies(std::ostringstream& json, const Utils::LatencyHistogram& latencies) {
+    json << "{ \"count\": " << latencies.count()
+         << ", \"mean\": " << latencies.mean()
+         << ", \"p50\": " << latencies.percentile(50)
+         << ", \"p90\": " << latencies.percentile(90)
+         << ", \"p99\": " << latencies.percentile(99)
+         << ", \"max\": " << latencies.max() << " }";
+}
+
+
+}
+
+
+std::string LoadReport::toJson() const {
+    const double duration_seconds { std::chrono::duration<double> { loadDuration }.count() };
+    // Load might have been stopped before any request was sent, there isn't any throughput then
+    const auto per_second { [duration_seconds](const std::uint64_t messages_count) {
+        return duration_seconds == 0 ? 0 : messages_count / duration_seconds;
+    } };
+
+    std::uint64_t total_sent { 0 };
+    std::uint64_t total_responses { 0 };
+    Utils::LatencyHistogram response_latency;
+
+    std::ostringstream json;
+    json << "{\n";
+
+    json << "  \"clients\": { \"started\": " << clients << ", \"connected\": " << connected
+         << ", \"logged_in\": " << loggedIn << " },\n";
+    json << "  \"duration_s\": " << duration_seconds << ",\n";
+
+    json << "  \"requests\": [";
+    for (std::size_t i { 0 }; i < requests.size(); i++) {
+        const RequestResults& results { requests[i] };
+
+        total_sent += results.sent;
+        total_responses += results.succeeded + results.failed;
+        response_latency.merge(results.responseLatency);
+
+        json << (i == 0 ? "\n" : ",\n");
+        json << "    { \"service\": ";
+        writeJsonString(json, results.request.serviceName);
+        json << ", \"rate_per_client\": " << results.request.rate
+             << ", \"sent\": " << results.sent << ", \"ok\": " << results.succeeded << ", \"ko\": " << results.failed
+             << ", \"response_latency_us\": ";
+        writeLatencies(json, results.responseLatency);
+        json << " }";
+    }
+    json << "\n  ],\n";
+
+    json << "  \"latency_us\": {\n    \"response\": ";
+    writeLatencies(json, response_latency);
+    json << ",\n    \"event\": ";
+    writeLatencies(json, eventLatency);
+    json << "\n  },\n";
+
+    json << "  \"throughput_per_s\": { \"requests\": " << per_second(total_sent)
+         << ", \"responses\": " << per_second(total_responses)
+         << ", \"events\": " << per_second(eventsReceived) << " },\n";
+
+    json << "  \"events\": { \"received\": " << eventsReceived << ", \"untracked\": " << untrackedEvents << " },\n";
+
+    json << "  \"errors\": { \"connect\": " << connectErrors << ", \"handshake\": " << handshakeErrors
+         << ", \"login\": " << loginErrors << ", \"disconnected\": " << disconnections
+         << ", \"unanswered\": " << unanswered << " }\n";
+
+    json << "}\n";
+
+    return json.str();
+}
+
+
+}
@@ -0,0 +1,210 @@
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+#include <RpT-Config/Config.hpp>
+#include <RpT-Loadgen/LoadGenerator.inl>
+#include <RpT-Utils/CommandLineOptionsParser.hpp>
+
+#if RPT_RUNTIME_PLATFORM == RPT_RUNTIME_UNIX
+#include <sys/resource.h>
+#endif
+
+
+constexpr int SUCCESS { 0 };
+constexpr int INVALID_ARGS { 1 };
+constexpr int RUNTIME_ERROR { 2 };
+
+constexpr std::string_view DEFAULT_MIX { "Chat:1:Hello from rpt-loadgen" };
+
+
+/**
+ * @brief Parses log level string and converts to enum value.
+ *
+ * @param level String or first char of log level
+ *
+ * @throws std::invalid_argument If level string cannot be parsed into LogLevel value
+ *
+ * @return Corresponding `RpT::Core::LogLevel` enum value
+ */
+constexpr RpT::Utils::LogLevel parseLogLevel(const std::string_view level) {
+    if (level == "t" || level == "trace")
+        return RpT::Utils::LogLevel::TRACE;
+    else if (level == "d" || level == "debug")
+        return RpT::Utils::LogLevel::DEBUG;
+    else if (level == "i" || level == "info")
+        return RpT::Utils::LogLevel::INFO;
+    else if (level == "w" || level == "warn")
+        return RpT::Utils::LogLevel::WARN;
+    else if (level == "e" || level == "error")
+        return RpT::Utils::LogLevel::ERR;
+    else if (level == "f" || level == "fatal")
+        return RpT::Utils::LogLevel::FATAL;
+    else
+        throw std::invalid_argument { "Unable to parse level \"" + std::string { level }+ "\"" };
+}
+
+/// Parses unsigned integer option if given, otherwise keeps given default value
+std::uint64_t parseCount(const RpT::Utils::CommandLineOptionsParser& cmd_line_options, const std::string_view option,
+                         const std::uint64_t default_value) {
+
+    if (!cmd_line_options.has(option))
+        return default_value;
+
+    // String copy must be created anyway to use stoull function
+    const std::string count_argument { cmd_line_options.get(option) };
+
+    return std::stoull(count_argument);
+}
+
+/// Parses seconds count option if given, otherwise keeps given default duration
+std::chrono::steady_clock::duration parseSeconds(const RpT::Utils::CommandLineOptionsParser& cmd_line_options,
+                                                 const std::string_view option,
+                                                 const std::chrono::steady_clock::duration default_duration) {
+
+    if (!cmd_line_options.has(option))
+        return default_duration;
+
+    // String copy must be created anyway to use stod function
+    const std::string seconds_argument { cmd_line_options.get(option) };
+
+    return std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+            std::chrono::duration<double> { std::stod(seconds_argument) });
+}
+
+/// Raises open files limit so every client connection can be opened, warns if it cannot be raised enough
+void raiseOpenFilesLimit(const std::size_t clients_count, RpT::Utils::LoggerView& logger) {
+#if RPT_RUNTIME_PLATFORM == RPT_RUNTIME_UNIX
+    // Standard streams, resolver, signal pipe and log file also use file descriptors
+    constexpr rlim_t OTHER_FILES { 64 };
+
+    rlimit open_files_limit {};
+    if (getrlimit(RLIMIT_NOFILE, &open_files_limit) != 0)
+        return;
+
+    const rlim_t required_files { clients_count + OTHER_FILES };
+    if (open_files_limit.rlim_cur >= required_files)
+        return;
+
+    open_files_limit.rlim_cur = std::min(required_files, open_files_limit.rlim_max);
+    if (setrlimit(RLIMIT_NOFILE, &open_files_limit) != 0 || open_files_limit.rlim_cur < required_files) {
+        logger.warn("Open files limit is {}, some of {} clients will fail to connect.", open_files_limit.rlim_cur,
+                    clients_count);
+    }
+#endif
+}
+
+int main(const int argc, const char** argv) {
+    RpT::Utils::LoggingContext loadgen_logging;
+    RpT::Utils::LoggerView logger { "Main", loadgen_logging };
+
+    try {
+        // Read and parse command line options
+        const RpT::Utils::CommandLineOptionsParser cmd_line_options {
+            argc, argv, { "host", "port", "scheme", "ca", "insecure", "clients", "first-uid", "max-connecting",
+                    "duration", "drain-timeout", "mix", "output", "log-level" }
+        };
+
+        // Try to get and parse logging level from command line options
+        if (cmd_line_options.has("log-level")) {
+            try {
+                const std::string_view log_level_argument { cmd_line_options.get("log-level") };
+
+                loadgen_logging.updateLoggingLevel(parseLogLevel(log_level_argument));
+            } catch (const std::logic_error& err) { // Option value may be missing, or parse may fail
+                logger.error("Log-level parsing: {}", err.what());
+                logger.warn("log-level option has been ignored, \"info\" will be used.");
+            }
+        }
+
+        RpT::Loadgen::LoadOptions load_options;
+
+        if (cmd_line_options.has("host"))
+            load_options.host = cmd_line_options.get("host");
+
+        const std::uint64_t parsed_port { parseCount(cmd_line_options, "port", load_options.port) };
+        if (parsed_port > std::numeric_limits<std::uint16_t>::max())
+            throw RpT::Utils::OptionsError { "port argument must be included inside 0..65535" };
+
+        load_options.port = parsed_port;
+        load_options.clientsCount = parseCount(cmd_line_options, "clients", load_options.clientsCount);
+        load_options.firstUid = parseCount(cmd_line_options, "first-uid", load_options.firstUid);
+        load_options.maxConnecting = parseCount(cmd_line_options, "max-connecting", load_options.maxConnecting);
+        load_options.loadDuration = parseSeconds(cmd_line_options, "duration", load_options.loadDuration);
+        load_options.drainTimeout = parseSeconds(cmd_line_options, "drain-timeout", load_options.drainTimeout);
+        load_options.mix = RpT::Loadgen::parseRequestMix(
+                cmd_line_options.has("mix") ? cmd_line_options.get("mix") : DEFAULT_MIX);
+
+        for (const RpT::Loadgen::MixedRequest& request : load_options.mix)
+            logger.debug("Each client sends {} requests/s to {}: {}", request.rate, request.serviceName,
+                         request.commandData);
+
+        raiseOpenFilesLimit(load_options.clientsCount, logger);
+
+        // Same default as server backend, Websockets switched from HTTPS
+        std::string_view scheme { "wss" };
+        if (cmd_line_options.has("scheme"))
+            scheme = cmd_line_options.get("scheme");
+
+        RpT::Loadgen::LoadReport report;
+        if (scheme == "wss") {
+            boost::asio::ssl::context tls_context { boost::asio::ssl::context::tls_client };
+
+            if (cmd_line_options.has("insecure")) { // Any certificate is accepted
+                logger.warn("Server certificate will not be verified.");
+
+                tls_context.set_verify_mode(boost::asio::ssl::verify_none);
+            } else {
+                // A local server usually runs with a self-signed certificate, which must be given to be trusted
+                if (cmd_line_options.has("ca"))
+                    tls_context.load_verify_file(std::string { cmd_line_options.get("ca") });
+                else
+                    tls_context.set_default_verify_paths();
+
+                tls_context.set_verify_mode(boost::asio::ssl::verify_peer);
+            }
+
+            RpT::Loadgen::LoadGenerator<RpT::Loadgen::SecureWebsocketStream> load_generator {
+                std::move(load_options), loadgen_logging, &tls_context
+            };
+
+            report = load_generator.run();
+        } else if (scheme == "ws") {
+            RpT::Loadgen::LoadGenerator<RpT::Loadgen::WebsocketStream> load_generator {
+                std::move(load_options), loadgen_logging
+            };
+
+            report = load_generator.run();
+        } else {
+            throw RpT::Utils::OptionsError { "Unknown scheme: " + std::string { scheme } };
+        }
+
+        const std::string json_report { report.toJson() };
+        // Report is written to stdout unless an output file is given, as logs are also written to stdout
+        if (cmd_line_options.has("output")) {
+            const std::string output_path { cmd_line_options.get("output") };
+            std::ofstream output_file { output_path };
+
+            if (!(output_file << json_report))
+                throw std::runtime_error { "Unable to write report to " + output_path };
+
+            logger.info("Report written to {}.", output_path);
+        } else {
+            std::cout << json_report << std::flush;
+        }
+
+        // Run is considered failed only if no client could even log in
+        return report.loggedIn == 0 ? RUNTIME_ERROR : SUCCESS;
+    } catch (const RpT::Utils::OptionsError& err) {
+        logger.fatal("Command line error: {}", err.what());
+
+        return INVALID_ARGS;
+    } catch (const std::exception& err) {
+        logger.fatal("Unhandled runtime error: {}", err.what());
+
+        return RUNTIME_ERROR;
+    }
+}
@@ -0,0 +1,54 @@
+#include <RpT-Loadgen/RequestMix.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+#include <RpT-Utils/CommandLineOptionsParser.hpp>
+
+
+namespace RpT::Loadgen {
+
+
+std::vector<MixedRequest> parseRequestMix(std::string_view mix) {
+    std::vector<MixedRequest> requests;
+
+    while (!mix.empty()) {
+        const std::size_t request_end { std::min(mix.find(';'), mix.size()) };
+        const std::string request { mix.substr(0, request_end) }; // Copy required for error messages and stod
+
+        const std::size_t service_name_end { request.find(':') };
+        const std::size_t rate_end { request.find(':', service_name_end + 1) };
+        if (service_name_end == 0 || service_name_end == std::string::npos || rate_end == std::string::npos)
+            throw Utils::OptionsError { "Expected <service_name>:<rate>:<command_data> request, got: " + request };
+
+        std::string service_name { request.substr(0, service_name_end) };
+        if (service_name.find(' ') != std::string::npos) // SER Protocol uses space as separator
+            throw Utils::OptionsError { "Service name must not contain space: " + service_name };
+
+        const std::string rate_argument { request.substr(service_name_end + 1, rate_end - service_name_end - 1) };
+        double rate;
+        try {
+            std::size_t parsed_chars;
+            rate = std::stod(rate_argument, &parsed_chars);
+
+            if (parsed_chars != rate_argument.size())
+                throw std::invalid_argument { "Trailing characters" };
+        } catch (const std::logic_error&) { // Both invalid_argument and out_of_range
+            throw Utils::OptionsError { "Invalid rate for request: " + request };
+        }
+
+        if (!(rate > 0)) // Also rejects NaN
+            throw Utils::OptionsError { "Rate must be positive for request: " + request };
+
+        requests.push_back({ std::move(service_name), rate, request.substr(rate_end + 1) });
+
+        mix.remove_prefix(std::min(request_end + 1, mix.size())); // Skips separator after request, if any
+    }
+
+    if (requests.empty())
+        throw Utils::OptionsError { "Requests mix must contain at least one request" };
+
+    return requests;
+}
+
+
+}
@@ -1,14 +1,27 @@
 #ifndef RPTOGETHER_SERVER_BEASTWEBSOCKETBACKENDBASE_INL
 #define RPTOGETHER_SERVER_BEASTWEBSOCKETBACKENDBASE_INL
 
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <memory>
 #include <sstream>
+#include <stdexcept>
 #include <string_view>
 #include <type_traits>
 #include <utility>
+#include <vector>
+#include <boost/asio/local/stream_protocol.hpp>
 #include <boost/asio/signal_set.hpp>
+#include <boost/asio/strand.hpp>
+#include <boost/asio/thread_pool.hpp>
 #include <boost/beast.hpp>
+#include <boost/version.hpp>
 #include <RpT-Config/Config.hpp>
+#include <RpT-Network/ClientsSlotMap.hpp>
+#include <RpT-Network/MetricsEndpoint.hpp>
 #include <RpT-Network/NetworkBackend.hpp>
+#include <RpT-Network/OutboundQueue.hpp>
 #include <RpT-Utils/LoggerView.hpp>
 
 /**
@@ -22,6 +35,97 @@
 namespace RpT::Network {
 
 
+/**
+ * @brief Options for Websocket permessage-deflate extension, extension is offered to clients only if enabled
+ *
+ * Messages are compressed only if client accepted extension during Websocket handshake.
+ */
+struct DeflateOptions {
+    /// Is extension offered to clients
+    bool enabled { false };
+    /// Maximum LZ77 sliding window size as power of 2, between 9 and 15
+    int windowBits { 15 };
+    /// Deflate memory level, between 1 and 9, higher is faster and compresses better but uses more memory
+    int memLevel { 4 };
+    /// Messages smaller than this size in bytes are sent uncompressed, requires Boost 1.75 or later
+    std::size_t minMessageSize { 0 };
+};
+
+
+/**
+ * @brief Options for clients handshakes, so a connections storm doesn't delay IO operations for established clients
+ */
+struct HandshakeOptions {
+    /// Number of threads dedicated to TLS and Websocket handshakes, 0 to run them as established clients IO operations
+    std::size_t threadsCount { 0 };
+    /// Maximum count of handshakes in progress, no connection is accepted while it is reached, 0 for unlimited
+    std::size_t maxPending { 0 };
+};
+
+
+/**
+ * @brief Delays after which stalled or silent connections are closed, 0 disables a timeout
+ */
+struct TimeoutOptions {
+    /// Delay for each of TLS and Websocket handshakes to be done
+    std::chrono::seconds handshake { 30 };
+    /// Delay without any data received from established client before it is killed
+    std::chrono::seconds idle { 300 };
+    /// Are Websocket pings sent to clients idle for half idle delay, so only unresponsive clients are killed
+    bool keepAlivePings { true };
+    /// Delay for Websocket closing handshake to be done, then connection is closed anyway
+    std::chrono::seconds close { 30 };
+};
+
+/**
+ * @brief Default timeouts for length-prefixed backends, with idle timeout disabled
+ *
+ * Length-prefixed framing doesn't have any ping message, so a client only receiving messages would be killed by
+ * idle timeout even if it is still connected.
+ *
+ * @returns Default timeouts, except for idle timeout which is 0
+ */
+inline TimeoutOptions lengthPrefixedTimeouts() {
+    TimeoutOptions timeouts;
+    timeouts.idle = std::chrono::seconds { 0 };
+
+    return timeouts;
+}
+
+
+/**
+ * @brief Options for listening sockets, so incoming connections can be accepted concurrently
+ *
+ * Local sockets cannot share their path, so only one acceptor can listen on a local endpoint.
+ */
+struct AcceptOptions {
+    /// Number of sockets listening on the same endpoint with SO_REUSEPORT, kernel spreads connections among them
+    std::size_t acceptorsCount { 1 };
+    /// Number of accept operations pending on each listening socket
+    std::size_t pendingAccepts { 1 };
+};
+
+
+/**
+ * @brief Counters for connections lifecycle since backend construction, so failing handshakes or writes can be
+ * monitored
+ */
+struct ConnectionCounters {
+    /// Connections accepted by any listening socket
+    std::uint64_t accepted { 0 };
+    /// Accepted connections which handshakes failed or timed out
+    std::uint64_t handshakesFailed { 0 };
+    /// Messages which couldn't be written to their client, which was then killed
+    std::uint64_t writeErrors { 0 };
+};
+
+
+#if RPT_RUNTIME_PLATFORM == RPT_RUNTIME_UNIX
+/// Stream over Unix domain socket, for clients on the same host like a TLS terminating sidecar
+using UnixStream = boost::beast::basic_stream<boost::asio::local::stream_protocol>;
+#endif
+
+
 /**
  * @brief IO interface implementation using websockets protocol over user-defined TCP stream
  *
@@ -32,44 +136,107 @@ namespace RpT::Network {
  * As all IO operations complete asynchronously, any error result in WS stream to be closed next time `waitForEvent()
  * ` is called.
  *
- * `BeastWebsocketBackendBase` subclass responsibility is to establish any valid Websocket stream using given
+ * By default, every asynchronous IO operation is ran by the thread calling `waitForEvent()`, which is the thread
+ * running the `Core::Executor` main loop. If IO threads are enabled at construction, each client stream is instead
+ * bound to its own strand inside an IO threads pool, so TLS records, Websocket framing and handshakes are processed
+ * concurrently. Completion handlers are then posted back to the backend IO context, in the order operations completed,
+ * so every `NetworkBackend` state access still happens from the main loop thread only.
+ *
+ * Messages flushed for a client are queued until they're sent. Queues can be bounded by `OutboundQueueLimits`,
+ * deciding what to do with clients too slow to receive messages at the rate they're flushed. Service Events are the
+ * only droppable messages.
+ *
+ * Websocket permessage-deflate extension might be offered to clients using `DeflateOptions`, at the cost of CPU
+ * time and memory for each compressing client stream.
+ *
+ * Handshakes can be ran by dedicated handshake threads, configured with `HandshakeOptions`. New connection is then
+ * bound to a strand of handshake threads pool until its Websocket stream is open, then its socket is handed over to
+ * executor used by established client streams. Count of handshakes in progress can be bounded, pausing connections
+ * accepting so pending connections wait inside listen backlog instead.
+ *
+ * Stalled handshakes, idle clients and unanswered closing handshakes are timed out as configured by
+ * `TimeoutOptions`. Idle clients are pinged before being timed out, and killed as for any read error, so dead
+ * connections don't keep their socket, stream and queue forever. Dead clients which messages cannot be sent are
+ * killed in the same way, as their stream is still read.
+ *
+ * Several listening sockets can share local endpoint with `AcceptOptions`, each having several pending accept
+ * operations. Listening sockets are bound to handshake threads or IO threads strands if any of them is enabled, so
+ * accepts are performed concurrently. Accepted connections are still counted from backend thread.
+ *
+ * Connections lifecycle is counted by `ConnectionCounters`. Those counters, outbound queues depth aggregated over
+ * every client and slow client counters are added to `NetworkBackend` metrics, which can be served over HTTP by
+ * `exposeMetrics()` from backend IO context.
+ *
+ * Messages are exchanged using Websocket stream by default. Another messages framing can be used by providing a
+ * stream type with the same interface than `boost::beast::websocket::stream` for reading, writing and closing
+ * messages, like `LengthPrefixedStream`.
+ *
+ * Underlying stream might also be a `UnixStream`, listening on a local endpoint instead, so connections from the same
+ * host skip TCP/IP stack. Stale socket file left by a previous server is replaced at construction, and socket file is
+ * removed once backend is closed.
+ *
+ * `BeastWebsocketBackendBase` subclass responsibility is to establish any valid client stream using given
  * `TcpStream` as underlying stream from incoming established TCP connection (using TCP socket).
  *
- * @tparam TcpStream Underlying tcp stream type
+ * @tparam TcpStream Underlying tcp stream type, or `UnixStream`
+ * @tparam MessageStream Stream messages are read from and written to, Websocket stream over `TcpStream` by default
  *
  * @author ThisALV, https://github.com/ThisALV
  */
-template<typename TcpStream>
+template<typename TcpStream, typename MessageStream = boost::beast::websocket::stream<TcpStream>>
 class BeastWebsocketBackendBase : public NetworkBackend {
 protected: // Must be defined early so it can be used all along the class definitions
-    using WebsocketStream = boost::beast::websocket::stream<TcpStream>;
+    using ClientStream = MessageStream;
+    /// Socket type for connections accepted by backend, lowest layer of client stream
+    using Socket = typename boost::beast::lowest_layer_type<TcpStream>::socket_type;
+    /// Endpoint type for listening sockets and remote clients
+    using Endpoint = typename boost::beast::lowest_layer_type<TcpStream>::endpoint_type;
 
 private:
+    /// Listening socket type for lowest layer protocol
+    using Acceptor = typename boost::beast::lowest_layer_type<TcpStream>::protocol_type::acceptor;
+
+    /// Is lowest layer running over IP, so endpoints have a port and can be shared by several listening sockets
+    static constexpr bool IP_TRANSPORT {
+        std::is_same_v<typename boost::beast::lowest_layer_type<TcpStream>::protocol_type, boost::asio::ip::tcp>
+    };
+
     /// Handles message sending result to given client token
     class SentMessageHandler {
     private:
         BeastWebsocketBackendBase& protocol_instance_;
         const std::uint64_t client_token_;
-        std::queue<std::shared_ptr<std::string>> remaining_messages_;
 
     public:
         /**
          * @brief Constructs handler for message sent to given actor from given RPTL protocol backend instance
          *
          * @param protocol_instance Instance which sent message to client
-         * @param client_token Client who must receive instance message
-         * @param remaining_messages Queue owning messages which will be recursively sent to given client, including
-         * message currently being sent
+         * @param client_token Client who must receive instance message, its sending queue front is the message
+         * currently being sent
          */
-        SentMessageHandler(BeastWebsocketBackendBase& protocol_instance, const std::uint64_t client_token,
-                           std::queue<std::shared_ptr<std::string>> remaining_messages)
-        : protocol_instance_ { protocol_instance }, client_token_ { client_token },
-        remaining_messages_ { std::move(remaining_messages) } {}
+        SentMessageHandler(BeastWebsocketBackendBase& protocol_instance, const std::uint64_t client_token)
+        : protocol_instance_ { protocol_instance }, client_token_ { client_token } {}
 
-        /// Makes handler callable object
+        /// Makes handler callable object, sending result is handled from backend thread as it accesses clients registry
         void operator()(const boost::system::error_code& err, std::size_t) {
+            // Write completion is timestamped before handler waits for backend thread, only if latency is traced
+            const Core::LatencyTracer::Clock::time_point written_at {
+                protocol_instance_.latencyTracer() ? Core::LatencyTracer::Clock::now()
+                                                   : Core::LatencyTracer::Clock::time_point {}
+            };
+
+            protocol_instance_.runOnBackend([sent_message_handler { *this }, err, written_at]() {
+                sent_message_handler.handleResult(err, written_at);
+            });
+        }
+
+        /// Handles sending result for current message, then sends next message if any
+        void handleResult(const boost::system::error_code& err,
+                          const Core::LatencyTracer::Clock::time_point written_at) const {
+
             // If client was disconnected, sending message to it is useless
-            if (protocol_instance_.clients_stream_.count(client_token_) == 0)
+            if (!protocol_instance_.clients_connection_.contains(client_token_))
                 return;
 
             /*
@@ -77,8 +244,14 @@ private:
              * still exists
              */
 
+            auto& sending_queue { protocol_instance_.clients_connection_.at(client_token_).sendingQueue };
+
+            Core::LatencyTracer* const latency_tracer { protocol_instance_.latencyTracer() };
+            if (latency_tracer && !err) // Responses carried by current message have been sent
+                latency_tracer->sent(client_token_, sending_queue.front().get(), written_at);
+
             // Current message is finally sent, removes it from queue, no longer requires it
-            remaining_messages_.pop();
+            sending_queue.pop();
 
             // Ignores if server stopped
             if (err == boost::asio::error::operation_aborted)
@@ -86,6 +259,8 @@ private:
 
             // Handles error with connection closure, as specified by RPTL protocol
             if (err) {
+                protocol_instance_.connection_counters_.writeErrors++;
+
                 std::string error_message { err.message() }; // Retrieves Asio error code associated message
 
                 protocol_instance_.logger_.error("Unable to send message to client {}: {}", client_token_, error_message);
@@ -96,8 +271,8 @@ private:
             }
 
             // If no error occurred, checks for messages queue and send next message recursively if any
-            if (!remaining_messages_.empty()) // Handler completed, remaining messages pointers are moved
-                protocol_instance_.sendNextMessage(client_token_, std::move(remaining_messages_));
+            if (!sending_queue.empty())
+                protocol_instance_.sendNextMessage(client_token_);
         }
     };
 
@@ -151,68 +326,295 @@ private:
     // Provides logging features
     Utils::LoggerView logger_;
 
-    // Websocket stream using given TCP stream for each client token
-    std::unordered_map<std::uint64_t, WebsocketStream> clients_stream_;
-    // Provides running context for all async IO operations
+    // Runs clients streams IO operations if IO threads are enabled, must outlive streams bound to its strands
+    std::unique_ptr<boost::asio::thread_pool> io_threads_pool_;
+    // Runs clients handshakes if handshake threads are enabled, must outlive streams as their timers stay bound to it
+    std::unique_ptr<boost::asio::thread_pool> handshake_threads_pool_;
+    /// Connection state for a client, stored inside one record so a single lookup is required for each client
+    struct ClientConnection {
+        // Client stream using given TCP stream, shared so stream outlives operations initiated from its strand
+        std::shared_ptr<ClientStream> stream;
+        // Messages flushed for client stream, front message is being sent if queue isn't empty, as only one write
+        // operation can be pending for a Websocket stream
+        OutboundQueue sendingQueue;
+        // Buffer reused for each message received from client stream, shared so buffer outlives pending read
+        // operation
+        std::shared_ptr<boost::beast::flat_buffer> readBuffer;
+    };
+
+    // Connection for each client token, same slots than clients inside NetworkBackend as tokens are given by it
+    ClientsSlotMap<ClientConnection> clients_connection_;
+    // Bounds for each client sending queue
+    const OutboundQueueLimits outbound_limits_;
+    // How many times slow client policy fired
+    SlowClientCounters slow_client_counters_;
+    // Accepted connections, failed handshakes and failed writes
+    ConnectionCounters connection_counters_;
+    // Dead clients which streams will be closed once their remaining messages have been sent
+    std::vector<std::uint64_t> clients_pending_close_;
+    // Websocket permessage-deflate extension options applied to each client stream
+    boost::beast::websocket::permessage_deflate deflate_options_;
+    // Delay for TLS handshake, if underlying stream provides it
+    const std::chrono::seconds handshake_timeout_;
+    // Websocket stream timeouts applied until Websocket handshake is done
+    boost::beast::websocket::stream_base::timeout handshake_timeouts_;
+    // Websocket stream timeouts applied once client is established, including closing handshake
+    boost::beast::websocket::stream_base::timeout established_timeouts_;
+    // Maximum count of handshakes in progress, 0 for unlimited
+    const std::size_t max_pending_handshakes_;
+    // Accepted connections which Websocket stream isn't open yet, nor failed to be
+    std::size_t pending_handshakes_;
+    // Index of acceptors which couldn't initiate accept operation because of pending handshakes limit
+    std::vector<std::size_t> paused_acceptors_;
+    // Provides running context for all async IO operations handlers accessing backend state
     boost::asio::io_context async_io_context_;
     // Posix signals handling to stop server
     boost::asio::signal_set stop_signals_handling_;
-    // Provides ready TCP connection to open WS stream from
-    boost::asio::ip::tcp::acceptor tcp_acceptor_;
-    // Keep total clients count so an unique token can be given to each new client
-    std::uint64_t tokens_count_;
+    // Posix signal handling to dump latency trace, if any signal can be used for it on runtime platform
+    boost::asio::signal_set dump_signal_handling_;
+    // Endpoint shared by every acceptor, with actual port if ephemeral port was requested
+    Endpoint local_endpoint_;
+    // Provide ready TCP connections to open WS stream from, sharing the same local endpoint
+    std::vector<Acceptor> acceptors_;
+    // Serves metrics over HTTP if exposed, from backend IO context
+    std::unique_ptr<MetricsEndpoint> metrics_endpoint_;
+
+#if RPT_RUNTIME_PLATFORM == RPT_RUNTIME_UNIX
+    /// Socket option allowing several sockets to listen on the same endpoint, connections being spread by kernel
+    using ReusePort = boost::asio::detail::socket_option::boolean<SOL_SOCKET, SO_REUSEPORT>;
+#endif
+
+    /// Converts given timeout option into Websocket stream timeout delay, 0 being disabled timeout
+    static boost::beast::websocket::stream_base::duration timeoutDelay(const std::chrono::seconds delay) {
+        if (delay.count() == 0)
+            return boost::beast::websocket::stream_base::none();
+
+        return delay;
+    }
+
+    /**
+     * @brief Removes socket file at given local endpoint path if no server is listening on it anymore
+     *
+     * Any other file, or socket still accepting connections, is kept so binding fails as address is already in use.
+     *
+     * @param executor Executor to probe socket with
+     * @param local_endpoint Local endpoint to bind listening socket to
+     */
+    static void removeStaleSocket(const boost::asio::any_io_executor& executor, const Endpoint& local_endpoint) {
+        const std::filesystem::path socket_path { local_endpoint.path() };
+
+        std::error_code status_err;
+        if (std::filesystem::status(socket_path, status_err).type() != std::filesystem::file_type::socket)
+            return;
+
+        Socket probe { executor };
+        boost::system::error_code connect_err;
+        probe.connect(local_endpoint, connect_err);
+
+        if (connect_err == boost::asio::error::connection_refused) // Nobody listening, left by a stopped server
+            std::filesystem::remove(socket_path, status_err);
+    }
+
+    /**
+     * @brief Opens socket listening on given local endpoint
+     *
+     * @param executor Executor running accept operations
+     * @param local_endpoint Endpoint to bind socket to
+     * @param share_endpoint Is endpoint shared with other listening sockets, requires SO_REUSEPORT
+     *
+     * @returns Listening socket
+     *
+     * @throws boost::system::system_error if socket cannot be opened, bound or listening
+     */
+    static Acceptor openAcceptor(const boost::asio::any_io_executor& executor, const Endpoint& local_endpoint,
+                                 const bool share_endpoint) {
+
+        Acceptor acceptor { executor };
+
+        acceptor.open(local_endpoint.protocol());
+
+        if constexpr (IP_TRANSPORT) {
+            acceptor.set_option(boost::asio::socket_base::reuse_address { true });
+#if RPT_RUNTIME_PLATFORM == RPT_RUNTIME_UNIX
+            if (share_endpoint) // Checked by constructor for other platforms
+                acceptor.set_option(ReusePort { true });
+#endif
+        } else { // Local socket file isn't removed when socket is closed, it must be removed before binding again
+            removeStaleSocket(executor, local_endpoint);
+        }
+
+        acceptor.bind(local_endpoint);
+        acceptor.listen();
+
+        return acceptor;
+    }
 
     /**
-     * @brief Starts listening for incoming client TCP connection on local endpoint
+     * @brief Waits for `SIGUSR1` to dump latency trace, then waits for it again
      */
-    void start() {
-        logger_.info("Open IO interface on local port {}.", tcp_acceptor_.local_endpoint().port());
+    void waitDumpSignal() {
+        dump_signal_handling_.async_wait([this](const boost::system::error_code& err, const int posix_signal) {
+            if (err == boost::asio::error::operation_aborted) // Ignores if server stopped
+                return;
+
+            if (err) {
+                logger_.error("Failed to handle posix signal {}: {}", posix_signal, err.message());
+                return;
+            }
 
-        waitNextClient();
+            Core::LatencyTracer* const latency_tracer { latencyTracer() };
+            if (!latency_tracer) {
+                logger_.warn("Posix signal {}, but latency isn't traced.", posix_signal);
+            } else {
+                try {
+                    latency_tracer->dump();
+
+                    logger_.info("Latency trace dumped into {}.", latency_tracer->dumpPath());
+                } catch (const std::runtime_error& dump_err) { // Server keeps running, dump might be asked again
+                    logger_.error("Latency trace dump: {}", dump_err.what());
+                }
+            }
+
+            waitDumpSignal();
+        });
+    }
+
+    /**
+     * @brief Starts listening for incoming client TCP connections on local endpoint
+     *
+     * @param pending_accepts Number of accept operations initiated for each acceptor
+     */
+    void start(const std::size_t pending_accepts) {
+        if constexpr (IP_TRANSPORT)
+            logger_.info("Open IO interface on local port {}.", local_endpoint_.port());
+        else
+            logger_.info("Open IO interface on local socket {}.", local_endpoint_.path());
+
+        for (std::size_t acceptor_index { 0 }; acceptor_index < acceptors_.size(); acceptor_index++) {
+            for (std::size_t i { 0 }; i < pending_accepts; i++)
+                waitNextClient(acceptor_index);
+        }
+    }
+
+    /**
+     * @brief Retrieves executor for next accepted client connection
+     *
+     * @returns New strand from IO threads pool if enabled, backend IO context executor otherwise
+     */
+    boost::asio::any_io_executor nextStreamExecutor() {
+        if (io_threads_pool_)
+            return boost::asio::make_strand(*io_threads_pool_);
+        else
+            return async_io_context_.get_executor();
+    }
+
+    /**
+     * @brief Retrieves executor for next accepted connection handshakes
+     *
+     * @returns New strand from handshake threads pool if enabled, next stream executor otherwise
+     */
+    boost::asio::any_io_executor nextHandshakeExecutor() {
+        if (handshake_threads_pool_)
+            return boost::asio::make_strand(*handshake_threads_pool_);
+        else
+            return nextStreamExecutor();
     }
 
     /**
      * @brief Sends next queued message for given client, async handler will recursively send next message when
      * operation will complete
      *
-     * @param client_token Token for queue to send messages from
+     * @param client_token Token for client to send sending queue front message to
      */
-    void sendNextMessage(const std::uint64_t client_token,
-                         std::queue<std::shared_ptr<std::string>> remaining_messages) {
+    void sendNextMessage(const std::uint64_t client_token) {
+        // Using shared_ptr copied from queue, data will be valid during async handler execution
+        ClientConnection& client_connection { clients_connection_.at(client_token) };
 
-        // Using shared_ptr stored inside queue, data will be valid during async handler execution
-        const auto message_owner { remaining_messages.front() };
+        const auto message_owner { client_connection.sendingQueue.front() };
         // Data owned
         // Buffer read by Asio to send message, data must be valid until handler call finished
         const boost::asio::const_buffer message_buffer { message_owner->data(), message_owner->size() };
 
-        clients_stream_.at(client_token).async_write(
-                message_buffer, SentMessageHandler { *this, client_token, remaining_messages });
+        const std::shared_ptr<ClientStream> client_stream { client_connection.stream };
+        // Binary encoding isn't valid UTF-8, so it must be sent inside Websocket binary frames
+        const bool binary_messages { binaryMessages(client_token) };
+
+        runOnStream(*client_stream, [this, client_stream, message_owner, message_buffer, client_token,
+                                     binary_messages]() {
+
+            client_stream->binary(binary_messages); // Only one write is pending, so it applies to this message only
+            client_stream->async_write(message_buffer, SentMessageHandler { *this, client_token });
+        });
     }
 
-    /// Accepts next incoming TCP client connection, then wait for next client again
-    void waitNextClient() {
-        logger_.trace("Waiting for new TCP connection...");
+    /// Checks if count of handshakes in progress reached limit, if any
+    bool handshakesLimitReached() const {
+        return max_pending_handshakes_ > 0 && pending_handshakes_ >= max_pending_handshakes_;
+    }
 
-        tcp_acceptor_.async_accept([this](
-                const boost::system::error_code& err, boost::asio::ip::tcp::socket new_client_connection) {
+    /**
+     * @brief Accepts next incoming TCP client connection with given acceptor, then wait for next client again
+     *
+     * If too many handshakes are in progress, acceptor is paused instead until `endHandshake()` is called. Limit
+     * might be exceeded by accept operations already pending.
+     *
+     * @param acceptor_index Acceptor to initiate accept operation for
+     */
+    void waitNextClient(const std::size_t acceptor_index) {
+        if (handshakesLimitReached()) {
+            logger_.debug("{} handshakes in progress, pause accepting new connections.", pending_handshakes_);
 
-            if (err == boost::asio::error::operation_aborted) // Ignores if server execution stopped
-                return;
+            paused_acceptors_.push_back(acceptor_index); // Resumed by endHandshake()
+            return;
+        }
 
-            if (err) {
-                logger_.error("Unable to accept TCP from {}: {}", endpointFor(new_client_connection), err.message());
-            } else {
-                logger_.debug("Accepted TCP connection from {}", endpointFor(new_client_connection));
+        logger_.trace("Waiting for new connection...");
 
-                // Tries to asynchronously open WS stream with TCP connection established from new client
-                openWebsocketStream(std::move(new_client_connection));
-            }
+        Acceptor& acceptor { acceptors_[acceptor_index] };
 
-            waitNextClient(); // In any case, server must be waiting again for the next TCP connection
+        // Acceptor might be bound to a strand, operations must be initiated from it
+        boost::asio::dispatch(acceptor.get_executor(), [this, &acceptor, acceptor_index]() {
+            // New connection is bound to its own strand if IO threads or handshake threads are enabled
+            acceptor.async_accept(nextHandshakeExecutor(), [this, acceptor_index](
+                    const boost::system::error_code& err, Socket new_client_connection) {
+
+                // Accepted connection is counted from backend thread, as handshakes in progress
+                runOnBackend([this, acceptor_index, err, new_client_connection { std::move(new_client_connection) }]()
+                        mutable {
+
+                    handleAcceptedConnection(acceptor_index, err, std::move(new_client_connection));
+                });
+            });
         });
     }
 
+    /**
+     * @brief Opens client stream for connection accepted by given acceptor, then waits for next client again
+     *
+     * @param acceptor_index Acceptor which accepted connection
+     * @param err Accept operation result
+     * @param new_client_connection Accepted connection, if no error occurred
+     */
+    void handleAcceptedConnection(const std::size_t acceptor_index, const boost::system::error_code& err,
+                                  Socket new_client_connection) {
+
+        if (err == boost::asio::error::operation_aborted) // Ignores if server execution stopped
+            return;
+
+        if (err) {
+            logger_.error("Unable to accept connection from {}: {}", endpointFor(new_client_connection), err.message());
+        } else {
+            logger_.debug("Accepted connection from {}", endpointFor(new_client_connection));
+
+            connection_counters_.accepted++;
+            pending_handshakes_++; // Until implementation calls endHandshake()
+            // Tries to asynchronously open WS stream with TCP connection established from new client
+            openClientStream(std::move(new_client_connection));
+        }
+
+        waitNextClient(acceptor_index); // In any case, server must be waiting again for the next TCP connection
+    }
+
     /**
      * @brief Receives and handles incoming message from given client
      *
@@ -221,56 +623,96 @@ private:
     void listenMessageFrom(const std::uint64_t client_token) {
         logger_.trace("Listening next message from {}...", client_token);
 
-        // A new buffer has to be initialized for each received/sent message as multiple messages could be
-        // sent/received before handlers call
-        const auto read_buffer { std::make_shared<boost::beast::flat_buffer>() };
-        // Buffer should lives for both async_read and callback handler operations, so shared pointer is used
+        // Only one read operation is pending at a time for each client, so its buffer is recycled between messages
+        const ClientConnection& client_connection { clients_connection_.at(client_token) };
 
-        clients_stream_.at(client_token).async_read(*read_buffer, [this, read_buffer, client_token](
-                const boost::system::error_code& err, const std::size_t) {
+        const std::shared_ptr<boost::beast::flat_buffer> read_buffer { client_connection.readBuffer };
+        const std::shared_ptr<ClientStream> client_stream { client_connection.stream };
 
-            if (err) {
-                if (err == boost::asio::error::operation_aborted) // Ignores if server stopped
-                    return;
-
-                Utils::HandlingResult message_handling_result; // No error for now
-                if (err == boost::beast::websocket::error::closed) { // Client sent a close frame
-                    logger_.info("Websocket close frame from client {}", client_token);
-                } else { // Ignores if server stopped
-                    const std::string error_message { err.message() };
-
-                    logger_.error("Failed to receive message from client {}: {}", client_token, error_message);
-                    // Error occurred, sets correct message handling result with given error message
-                    message_handling_result = Utils::HandlingResult { error_message };
-                }
+        runOnStream(*client_stream, [this, client_stream, read_buffer, client_token]() {
+            client_stream->async_read(*read_buffer, [this, read_buffer, client_token](
+                    const boost::system::error_code& err, const std::size_t) {
 
-                // In any case, an error means that client must NOT be listened anymore
-                killClient(client_token, message_handling_result);
+                // Read completion is timestamped before handler waits for backend thread, only if latency is traced
+                const Core::LatencyTracer::Clock::time_point read_at {
+                    latencyTracer() ? Core::LatencyTracer::Clock::now() : Core::LatencyTracer::Clock::time_point {}
+                };
 
-                return;
+                // Received message must be handled by backend thread, as it accesses clients registry
+                runOnBackend([this, read_buffer, client_token, err, read_at]() {
+                    handleReceivedMessage(client_token, err, *read_buffer, read_at);
+                });
+            });
+        });
+    }
+
+    /**
+     * @brief Handles message read result from given client, then listens for next message if client is still alive
+     *
+     * @param client_token Token for client message was received from
+     * @param err Read operation result
+     * @param read_buffer Buffer containing received message, consumed once message has been handled
+     * @param read_at When read operation completed, only set if latency is traced
+     */
+    void handleReceivedMessage(const std::uint64_t client_token, const boost::system::error_code& err,
+                               boost::beast::flat_buffer& read_buffer,
+                               const Core::LatencyTracer::Clock::time_point read_at) {
+
+        if (err == boost::asio::error::operation_aborted) // Ignores if server stopped
+            return;
+
+        // If client stream was closed before handler was called, client is no longer listened
+        if (!clients_connection_.contains(client_token))
+            return;
+
+        if (err) {
+            Utils::HandlingResult message_handling_result; // No error for now
+            if (err == boost::beast::websocket::error::closed) { // Client sent a close frame
+                logger_.info("Websocket close frame from client {}", client_token);
+            } else if (err == boost::asio::error::eof) { // Client closed connection between two messages
+                logger_.info("Connection closed by client {}", client_token);
+            } else if (err == boost::beast::error::timeout) { // Client didn't send anything, not even pong frames
+                logger_.warn("Client {} timed out", client_token);
+                message_handling_result = Utils::HandlingResult { err.message() };
+            } else {
+                const std::string error_message { err.message() };
+
+                logger_.error("Failed to receive message from client {}: {}", client_token, error_message);
+                // Error occurred, sets correct message handling result with given error message
+                message_handling_result = Utils::HandlingResult { error_message };
             }
 
-            // Const readable for received message
-            const boost::asio::const_buffer readonly_buffer { read_buffer->cdata() };
+            // In any case, an error means that client must NOT be listened anymore
+            killClient(client_token, message_handling_result);
 
-            // Reinterpret generic void pointer to cstring with buffer-defined message length
-            std::string rptl_message { reinterpret_cast<const char*>(readonly_buffer.data()), readonly_buffer.size() };
+            return;
+        }
 
-            try {
-                Core::AnyInputEvent client_triggered_event { handleMessage(client_token, rptl_message) };
+        // Const readable for received message
+        const boost::asio::const_buffer readonly_buffer { read_buffer.cdata() };
 
-                // Visits triggered event checking for type
-                boost::apply_visitor(TriggeredInputEventVisitor { *this, client_token }, client_triggered_event);
+        // Reinterpret generic void pointer to cstring with buffer-defined message length, without any copy
+        const std::string_view rptl_message {
+            reinterpret_cast<const char*>(readonly_buffer.data()), readonly_buffer.size()
+        };
 
-                pushInputEvent(std::move(client_triggered_event)); // Moves triggered event into queue
-                listenMessageFrom(client_token); // Then listens next message from current client
-            } catch (const std::exception& err) { // Any error in message handling results into client disconnection
-                logger_.error("During {} message handling: {}", client_token, err.what());
+        try {
+            Core::AnyInputEvent client_triggered_event { handleMessage(client_token, rptl_message) };
 
-                // Client will be disconnect for thrown error reason
-                killClient(client_token, Utils::HandlingResult { err.what() });
-            }
-        });
+            // Visits triggered event checking for type
+            boost::apply_visitor(TriggeredInputEventVisitor { *this, client_token }, client_triggered_event);
+
+            traceReceived(client_token, client_triggered_event, read_at);
+            pushInputEvent(client_triggered_event); // Copies triggered event payload into queue
+            // Triggered event might borrow message data until it is pushed, now buffer can be reused for next message
+            read_buffer.consume(read_buffer.size());
+            listenMessageFrom(client_token); // Then listens next message from current client
+        } catch (const std::exception& err) { // Any error in message handling results into client disconnection
+            logger_.error("During {} message handling: {}", client_token, err.what());
+
+            // Client will be disconnect for thrown error reason
+            killClient(client_token, Utils::HandlingResult { err.what() });
+        }
     }
 
     /**
@@ -290,30 +732,38 @@ private:
         if (!disconnection_reason) {
             const std::string& error_message { disconnection_reason.errorMessage() };
 
-            websocket_close_reason.code = boost::beast::websocket::close_code::abnormal;
+            // Abnormal close code mustn't be sent inside close frame, clients would fail without closing handshake
+            websocket_close_reason.code = boost::beast::websocket::close_code::policy_error;
             websocket_close_reason.reason = error_message;
         }
 
         removeClient(client_token); // Once disconnection reason has been sent to client, it can be removed
 
         // Moves client stream entry as it will be closed and no more operation should be performed on
-        // Use of shared_ptr because stream must not be destroyed before Websocket closure was handled
-        const auto dead_client_stream {
-            std::make_shared<WebsocketStream>(std::move(clients_stream_.at(client_token)))
+        // Shared ownership kept because stream must not be destroyed before Websocket closure was handled
+        const std::shared_ptr<ClientStream> dead_client_stream {
+            std::move(clients_connection_.at(client_token).stream)
         };
 
-        const std::size_t removed_streams_count { clients_stream_.erase(client_token) };
-        // Must be sure that exactly ony client stream and messages queue entry have been removed
-        assert(removed_streams_count == 1);
+        // Pending messages will not be sent, but message currently sent is kept alive by write operation
+        // Buffer is kept alive by pending read operation, if any
+        const std::size_t removed_connections_count { clients_connection_.erase(client_token) };
+        // Must be sure that exactly ony client connection has been removed
+        assert(removed_connections_count == 1);
 
         // Does and handles Websocket closure for dead client
-        dead_client_stream->async_close(websocket_close_reason, [this, dead_client_stream, client_token](
-                const boost::system::error_code& err) {
-
-            // If for any reason clean Websocket closure failed, TCP connection will be closed anyways, but a warning
-            // message must be logged
-            if (err)
-                logger_.warn("Unclean disconnection with client {}: {}", client_token, err.message());
+        runOnStream(*dead_client_stream, [this, dead_client_stream, websocket_close_reason, client_token]() {
+            dead_client_stream->async_close(websocket_close_reason, [this, dead_client_stream, client_token](
+                    const boost::system::error_code& err) {
+
+                // If for any reason clean Websocket closure failed, TCP connection will be closed anyways, but a
+                // warning message must be logged
+                if (err) {
+                    runOnBackend([this, client_token, err]() {
+                        logger_.warn("Unclean disconnection with client {}: {}", client_token, err.message());
+                    });
+                }
+            });
         });
     }
 
@@ -323,19 +773,43 @@ protected:
      *
      * @param client_connection Client TCP to try go retrieve endpoint from
      *
-     * @return Socket remote endpoint string if successful, `"UNKNOWN"` otherwise
+     * @return Socket remote endpoint string if successful, `"UNNAMED"` for local client without path, `"UNKNOWN"`
+     * otherwise
      */
-    static std::string endpointFor(const boost::asio::ip::tcp::socket& client_connection) {
+    static std::string endpointFor(const Socket& client_connection) {
         try {
             std::ostringstream endpoint_output;
             endpoint_output << client_connection.remote_endpoint(); // remote_endpoint() may fail for some reasons
 
-            return endpoint_output.str();
+            std::string endpoint { endpoint_output.str() };
+            if (endpoint.empty()) // Local client sockets usually aren't bound to any path
+                return "UNNAMED";
+
+            return endpoint;
         } catch (const boost::system::system_error&) { // If it fails, returns fallback string representation
             return "UNKNOWN";
         }
     }
 
+    /**
+     * @brief Applies Websocket options shared by every client stream, must be called before Websocket handshake
+     *
+     * @param new_client_stream Client stream to configure
+     */
+    void configureWebsocketStream(ClientStream& new_client_stream) const {
+        new_client_stream.set_option(deflate_options_);
+        new_client_stream.set_option(handshake_timeouts_);
+    }
+
+    /**
+     * @brief Gets delay for handshakes performed by underlying stream, which Websocket stream doesn't time out
+     *
+     * @returns Handshake timeout, 0 if disabled
+     */
+    std::chrono::seconds handshakeTimeout() const {
+        return handshake_timeout_;
+    }
+
     /**
      * @brief Provides class logging features
      *
@@ -346,57 +820,239 @@ protected:
     }
 
     /**
-     * @brief Must asynchronously open Websocket stream using `addClientStream()` from given established TCP connection
+     * @brief Runs given handler from backend thread, the only one allowed to access `NetworkBackend` state and to log
+     *
+     * Must wrap any completion handler accessing backend state. If handler is already called from backend thread,
+     * which is the case when neither IO threads nor handshake threads are enabled, it is invoked immediately.
+     * Otherwise, it is queued into backend IO context, queue order being operations completion order.
+     *
+     * @param handler Callable object without argument
+     */
+    template<typename Handler>
+    void runOnBackend(Handler&& handler) {
+        if (async_io_context_.get_executor().running_in_this_thread())
+            handler();
+        else
+            boost::asio::post(async_io_context_, std::forward<Handler>(handler));
+    }
+
+    /**
+     * @brief Initiates operation on given stream from its strand, as streams are not thread-safe
+     *
+     * If IO threads are disabled, operation is immediately initiated.
+     *
+     * @param stream Stream to initiate operation on
+     * @param initiation Callable object without argument initiating operation
+     */
+    template<typename Initiation>
+    void runOnStream(ClientStream& stream, Initiation&& initiation) {
+        if (io_threads_pool_)
+            boost::asio::dispatch(stream.get_executor(), std::forward<Initiation>(initiation));
+        else
+            initiation();
+    }
+
+    /**
+     * @brief Must asynchronously open client stream using `addClientStream()` from given established TCP connection
+     *
+     * Whatever handshakes result is, implementation must call `endHandshake()` from backend thread once they're done.
+     * If client stream was open, `establishStream()` must be called before stream is passed to `addClientStream()`.
+     * Handshakes performed by underlying stream must be timed out by implementation, using `handshakeTimeout()`.
      *
      * @param new_client_connection TCP connection ready to handshake into upper protocols layer
      */
-    virtual void openWebsocketStream(boost::asio::ip::tcp::socket new_client_connection) = 0;
+    virtual void openClientStream(Socket new_client_connection) = 0;
 
+    /**
+     * @brief Prepares given open stream for established client IO operations, must be called from stream strand while
+     * no operation is pending on it
+     *
+     * Handshake timeouts are replaced by established client timeouts. Then, if handshake threads are enabled, stream
+     * is moved from handshake threads pool to its established client stream executor. An Asio socket cannot be moved
+     * between execution contexts, so underlying socket is assigned to a new socket using stream executor then
+     * released by handshake threads pool. TLS and Websocket states are kept as they live inside upper layers.
+     *
+     * @param new_client_stream Stream which Websocket handshake has just been done
+     *
+     * @returns Error if underlying socket couldn't be handed over, stream can then no longer be used
+     */
+    boost::system::error_code establishStream(ClientStream& new_client_stream) {
+        new_client_stream.set_option(established_timeouts_);
+
+        if (!handshake_threads_pool_) // Stream is already bound to executor used for established streams
+            return {};
+
+        Socket& handshake_socket { boost::beast::get_lowest_layer(new_client_stream).socket() };
+        boost::system::error_code err;
+
+        const Endpoint local_endpoint { handshake_socket.local_endpoint(err) };
+        if (err)
+            return err;
+
+        // Registered by stream executor context before being released, so it always has exactly one owner
+        Socket established_socket { nextStreamExecutor() };
+        established_socket.assign(local_endpoint.protocol(), handshake_socket.native_handle(), err);
+        if (err)
+            return err;
+
+        handshake_socket.release(err);
+        if (err) { // Not supported by every platform, socket cannot be used by both contexts so connection is closed
+            boost::system::error_code ignored_err;
+            established_socket.close(ignored_err);
+
+            return err;
+        }
+
+        handshake_socket = std::move(established_socket);
+
+        return {};
+    }
 
     /**
-     * @brief Inserts new client using server-defined token and given Websocket stream, should be called by
-     * `openWebsocketStream()` implementation
+     * @brief Marks one handshake as done, successful or not, resuming paused acceptors if pending handshakes are no
+     * longer limited
+     *
+     * Must be called from backend thread.
+     *
+     * @param err Handshakes result, counted as failed if set, unless operation was aborted because server stopped
+     */
+    void endHandshake(const boost::system::error_code& err) {
+        assert(pending_handshakes_ > 0);
+        pending_handshakes_--;
+
+        if (err && err != boost::asio::error::operation_aborted)
+            connection_counters_.handshakesFailed++;
+
+        if (paused_acceptors_.empty() || handshakesLimitReached() || closed())
+            return;
+
+        logger_.debug("{} handshakes in progress, resume accepting new connections.", pending_handshakes_);
+
+        // Every acceptor must be resumed, otherwise connections spread by kernel to a paused one would never be
+        // accepted
+        while (!paused_acceptors_.empty()) {
+            const std::size_t resumed_acceptor_index { paused_acceptors_.back() };
+            paused_acceptors_.pop_back();
+
+            waitNextClient(resumed_acceptor_index);
+        }
+    }
+
+    /**
+     * @brief Writes `NetworkBackend` metrics, then connections lifecycle, outbound queues and slow client policy
+     * families
+     *
+     * Outbound queues are aggregated over every client, so metrics cardinality doesn't depend on clients count.
+     *
+     * @param metrics Writer to format families with
+     */
+    void writeMetrics(Utils::PrometheusWriter& metrics) const override {
+        NetworkBackend::writeMetrics(metrics);
+
+        metrics.family("rpt_accepted_connections_total", Utils::MetricType::Counter,
+                       "Connections accepted by listening sockets.");
+        metrics.sample("rpt_accepted_connections_total", connection_counters_.accepted);
+
+        metrics.family("rpt_failed_handshakes_total", Utils::MetricType::Counter,
+                       "Accepted connections which handshakes failed or timed out.");
+        metrics.sample("rpt_failed_handshakes_total", connection_counters_.handshakesFailed);
+
+        metrics.family("rpt_pending_handshakes", Utils::MetricType::Gauge, "Handshakes currently in progress.");
+        metrics.sample("rpt_pending_handshakes", std::uint64_t { pending_handshakes_ });
+
+        std::uint64_t queued_messages { 0 };
+        std::uint64_t queued_bytes { 0 };
+        std::uint64_t max_queued_messages { 0 };
+        std::uint64_t max_queued_bytes { 0 };
+        clients_connection_.forEach([&](const std::uint64_t, const ClientConnection& connection) {
+            const OutboundQueue& sending_queue { connection.sendingQueue };
+
+            queued_messages += sending_queue.size();
+            queued_bytes += sending_queue.bytes();
+            max_queued_messages = std::max<std::uint64_t>(max_queued_messages, sending_queue.size());
+            max_queued_bytes = std::max<std::uint64_t>(max_queued_bytes, sending_queue.bytes());
+        });
+
+        metrics.family("rpt_outbound_queued_messages", Utils::MetricType::Gauge,
+                       "Messages waiting to be sent, summed over every client or for the most loaded client.");
+        metrics.sample("rpt_outbound_queued_messages", queued_messages, { { "aggregation", "sum" } });
+        metrics.sample("rpt_outbound_queued_messages", max_queued_messages, { { "aggregation", "max" } });
+
+        metrics.family("rpt_outbound_queued_bytes", Utils::MetricType::Gauge,
+                       "Bytes waiting to be sent, summed over every client or for the most loaded client.");
+        metrics.sample("rpt_outbound_queued_bytes", queued_bytes, { { "aggregation", "sum" } });
+        metrics.sample("rpt_outbound_queued_bytes", max_queued_bytes, { { "aggregation", "max" } });
+
+        metrics.family("rpt_write_errors_total", Utils::MetricType::Counter,
+                       "Messages which couldn't be written, killing their client.");
+        metrics.sample("rpt_write_errors_total", connection_counters_.writeErrors);
+
+        metrics.family("rpt_slow_clients_total", Utils::MetricType::Counter,
+                       "Times slow client policy fired, by action taken.");
+        metrics.sample("rpt_slow_clients_total", slow_client_counters_.disconnections, { { "action", "disconnect" } });
+        metrics.sample("rpt_slow_clients_total", slow_client_counters_.pauses, { { "action", "pause" } });
+
+        metrics.family("rpt_dropped_messages_total", Utils::MetricType::Counter,
+                       "Service Events discarded for slow clients.");
+        metrics.sample("rpt_dropped_messages_total", slow_client_counters_.droppedMessages);
+    }
+
+
+    /**
+     * @brief Inserts new client using server-defined token and given client stream, should be called by
+     * `openClientStream()` implementation from backend thread
      *
      * If any error occurres during client token insertion, stream will be closed
      *
      * @param new_client_connection Underlying TCP socket, required for debugging informations
-     * @param new_client_stream Produced Websocket stream from TCP connection
+     * @param new_client_stream Produced client stream from TCP connection
      */
-    void addClientStream(const boost::asio::ip::tcp::socket& new_client_connection, WebsocketStream new_client_stream) {
+    void addClientStream(const Socket& new_client_connection,
+                         std::shared_ptr<ClientStream> new_client_stream) {
+
         const std::string remote_endpoint { endpointFor(new_client_connection) };
 
         try {
-            const std::uint64_t new_client_token { tokens_count_++ };
+            // Token might reuse storage of a removed client, with another generation so it is still unique
+            const std::uint64_t new_client_token { nextClientToken() };
 
             logger_.debug("New token for {}: {}", remote_endpoint, new_client_token);
 
             // Add token into connected clients NetworkBackend registry
             addClient(new_client_token); // May throws if token insertion failed
-            // Move produced stream into clients stream registry
-            const auto insert_stream_result {
-                clients_stream_.insert({ new_client_token, std::move(new_client_stream) })
+            // Shares produced stream with clients connection registry, still owned here in case of insertion failure
+            // Client stream starts without any message to send, read buffer is allocated once for whole connection
+            const bool connection_inserted {
+                clients_connection_.insert(new_client_token, ClientConnection {
+                    new_client_stream, {}, std::make_shared<boost::beast::flat_buffer>()
+                })
             };
 
-            // Checks if client stream and messages queue insertions has been done
-            assert(insert_stream_result.second);
+            // Checks if client connection insertion has been done
+            assert(connection_inserted);
 
             listenMessageFrom(new_client_token); // Now client stream was added, it can be listened
         } catch (const std::exception& err) { // Any token insertion error must result in stream closure
             logger_.error("Unable to add client for {}: {}", remote_endpoint, err.what());
 
             // Directly closes Websocket stream as client hasn't been added yet
-            new_client_stream.async_close(boost::beast::websocket::internal_error,
-                                          [this, &remote_endpoint](const boost::system::error_code& closure_err) {
-
-                if (closure_err == boost::asio::error::operation_aborted) // Ignores if server execution stopped
-                    return;
-
-                if (closure_err)
-                    logger_.error("Client {} websocket closure: {}",
-                                  remote_endpoint, closure_err.message());
-                else
-                    logger_.debug("Client {} websocket closed prematurely: {}",
-                                  remote_endpoint, closure_err.message());
+            runOnStream(*new_client_stream, [this, new_client_stream, remote_endpoint]() {
+                new_client_stream->async_close(boost::beast::websocket::internal_error,
+                                               [this, new_client_stream, remote_endpoint](
+                                                       const boost::system::error_code& closure_err) {
+
+                    if (closure_err == boost::asio::error::operation_aborted) // Ignores if server execution stopped
+                        return;
+
+                    runOnBackend([this, remote_endpoint, closure_err]() {
+                        if (closure_err)
+                            logger_.error("Client {} websocket closure: {}",
+                                          remote_endpoint, closure_err.message());
+                        else
+                            logger_.debug("Client {} websocket closed prematurely: {}",
+                                          remote_endpoint, closure_err.message());
+                    });
+                });
             });
         }
     }
@@ -405,8 +1061,73 @@ protected:
     void syncClient(const std::uint64_t client_token,
                     std::queue<std::shared_ptr<std::string>> flushed_messages_queue) final {
 
-        if (!flushed_messages_queue.empty()) // Initiates recursive calls if there is any message to send
-            sendNextMessage(client_token, std::move(flushed_messages_queue));
+        OutboundQueue& sending_queue { clients_connection_.at(client_token).sendingQueue };
+        // If queue isn't empty, a message is currently being sent and recursive calls are already initiated
+        const bool sending_in_progress { !sending_queue.empty() };
+        const bool was_paused { sending_queue.paused() };
+
+        // Flushed messages are queued after messages not sent yet
+        while (!flushed_messages_queue.empty()) {
+            std::shared_ptr<std::string> next_message { std::move(flushed_messages_queue.front()) };
+            flushed_messages_queue.pop();
+
+            // Killed client is already disconnected, its last messages must not trip limits again
+            if (!isAlive(client_token)) {
+                sending_queue.pushFinal(std::move(next_message));
+
+                continue;
+            }
+
+            const bool droppable { isServiceEvent(*next_message) };
+            const bool limits_exceeded {
+                sending_queue.push(std::move(next_message), droppable, outbound_limits_, slow_client_counters_)
+            };
+
+            if (limits_exceeded) { // Slow client policy requires client to be disconnected
+                logger_.warn("Client {} exceeded outbound queue limits, disconnecting...", client_token);
+
+                // Remaining messages will not be sent, this is what queue bounding is for
+                sending_queue.discardPending();
+
+                // Client is alive, otherwise limits wouldn't have been enforced
+                killClient(client_token, Utils::HandlingResult { "Outbound queue limits exceeded" });
+
+                break;
+            }
+        }
+
+        if (!was_paused && sending_queue.paused())
+            logger_.warn("Client {} exceeded outbound queue limits, paused until caught up.", client_token);
+
+        if (!sending_in_progress && !sending_queue.empty()) // Initiates recursive calls if there is any message to send
+            sendNextMessage(client_token);
+    }
+
+    /**
+     * @brief Closes streams for dead clients which don't have any remaining message to send
+     *
+     * Only clients killed since last call or still waiting for their messages to be sent are checked, so cost
+     * doesn't depend on connected clients count.
+     */
+    void closeDeadStreams() {
+        // Newly dead connections must be closed once remaining messages like interrupt have been sent
+        for (const std::uint64_t dead_client_token : pollDeadClients())
+            clients_pending_close_.push_back(dead_client_token);
+
+        std::size_t i { 0 };
+        while (i < clients_pending_close_.size()) {
+            const std::uint64_t dead_client_token { clients_pending_close_[i] };
+
+            if (clients_connection_.at(dead_client_token).sendingQueue.empty()) {
+                closeStream(dead_client_token);
+
+                // Removes closed client by moving last pending client at its position, order doesn't matter
+                clients_pending_close_[i] = clients_pending_close_.back();
+                clients_pending_close_.pop_back();
+            } else { // Still waiting for messages to be sent, checks next pending client
+                i++;
+            }
+        }
     }
 
     /**
@@ -417,24 +1138,12 @@ protected:
         synchronize();
 
         while (!inputReady()) { // While input events queue is empty
-            std::vector<std::uint64_t> dead_clients;
-            // Max count of dead clients is count of actual clients
-            dead_clients.reserve(clients_stream_.size());
-
-            // Checks for all dead clients
-            for (const auto& client : clients_stream_) {
-                const std::uint64_t token { client.first }; // Retrieves token for current entry
-
-                if (!isAlive(token)) // If connection is dead, it must be closed
-                    dead_clients.push_back(token);
-            }
-
-            // As clients_stream_ elements must not be erased during iteration, closeStream() calls are deferred
-            for (const std::uint64_t dead_client_token : dead_clients)
-                closeStream(dead_client_token);
+            closeDeadStreams();
 
             // Wait for next asynchronous IO operation handler, it may triggers an input event
             async_io_context_.run_one();
+            // Then runs every other ready handler, so dead clients are checked once for a batch of handlers
+            async_io_context_.poll();
         }
     }
 
@@ -447,15 +1156,118 @@ public:
      *
      * @param local_endpoint Endpoint clients will connect to
      * @param logging_context Context for WS backend logging features
+     * @param io_threads_count Number of threads running clients streams IO operations, 0 to run them from the
+     * thread calling `waitForEvent()`
+     * @param outbound_limits Limits for each client sending queue, and policy applied to clients exceeding them
+     * @param deflate Websocket permessage-deflate extension options
+     * @param handshakes Handshake threads and pending handshakes limit
+     * @param accept Number of listening sockets and pending accept operations for each of them
+     * @param timeouts Handshake, idle and close timeouts for each client connection
+     *
+     * @throws std::invalid_argument if deflate window bits or memory level is out of range, or if there isn't at
+     * least one pending accept operation for one acceptor, or if several acceptors are required on a platform without
+     * SO_REUSEPORT or for a local endpoint, or if a timeout is negative
+     * @throws boost::system::system_error if a listening socket cannot be opened
      */
-    explicit BeastWebsocketBackendBase(const boost::asio::ip::tcp::endpoint& local_endpoint,
-                                       Utils::LoggingContext& logging_context)
+    explicit BeastWebsocketBackendBase(const Endpoint& local_endpoint,
+                                       Utils::LoggingContext& logging_context,
+                                       const std::size_t io_threads_count = 0,
+                                       const OutboundQueueLimits& outbound_limits = {},
+                                       const DeflateOptions& deflate = {},
+                                       const HandshakeOptions& handshakes = {},
+                                       const AcceptOptions& accept = {},
+                                       const TimeoutOptions& timeouts = {})
     : logger_ { "WS-Backend", logging_context },
+    outbound_limits_ { outbound_limits },
+    handshake_timeout_ { timeouts.handshake },
+    max_pending_handshakes_ { handshakes.maxPending },
+    pending_handshakes_ { 0 },
     stop_signals_handling_ { async_io_context_ },
-    tcp_acceptor_ { async_io_context_, local_endpoint },
-    tokens_count_ { 0 } {
+    dump_signal_handling_ { async_io_context_ } {
         Utils::LoggerView logger { getLogger() }; // Avoid to create LoggerView for each added signal
 
+        if (io_threads_count > 0) { // Clients streams IO operations are ran by the pool only if enabled
+            io_threads_pool_ = std::make_unique<boost::asio::thread_pool>(io_threads_count);
+
+            logger.info("Clients IO operations ran by {} threads.", io_threads_count);
+        }
+
+        if (handshakes.threadsCount > 0) { // Otherwise, handshakes are ran as any client stream IO operation
+            handshake_threads_pool_ = std::make_unique<boost::asio::thread_pool>(handshakes.threadsCount);
+
+            logger.info("Clients handshakes ran by {} threads.", handshakes.threadsCount);
+        }
+
+        if (max_pending_handshakes_ > 0)
+            logger.info("At most {} handshakes in progress.", max_pending_handshakes_);
+
+        if (accept.acceptorsCount == 0 || accept.pendingAccepts == 0)
+            throw std::invalid_argument { "At least one acceptor with one pending accept operation is required" };
+
+#if RPT_RUNTIME_PLATFORM != RPT_RUNTIME_UNIX
+        if (accept.acceptorsCount > 1)
+            throw std::invalid_argument { "Several acceptors require SO_REUSEPORT, only available on Unix" };
+#endif
+
+        if (!IP_TRANSPORT && accept.acceptorsCount > 1)
+            throw std::invalid_argument { "Several acceptors cannot share a local socket path" };
+
+        const bool shared_endpoint { accept.acceptorsCount > 1 };
+        acceptors_.reserve(accept.acceptorsCount); // Accept operations refer to acceptors, they mustn't be moved
+
+        // Acceptors run on their own strand like handshakes, port chosen for first acceptor is reused by the others so
+        // an ephemeral port might be requested
+        acceptors_.push_back(openAcceptor(nextHandshakeExecutor(), local_endpoint, shared_endpoint));
+        local_endpoint_ = acceptors_.front().local_endpoint();
+
+        while (acceptors_.size() < accept.acceptorsCount)
+            acceptors_.push_back(openAcceptor(nextHandshakeExecutor(), local_endpoint_, shared_endpoint));
+
+        if (shared_endpoint) {
+            logger.info("Connections spread among {} acceptors, with {} accept operations pending for each.",
+                        accept.acceptorsCount, accept.pendingAccepts);
+        }
+
+        if (deflate.enabled) { // Extension is offered to clients only if enabled
+            // zlib doesn't support 8 bits window for raw deflate streams
+            if (deflate.windowBits < 9 || deflate.windowBits > 15)
+                throw std::invalid_argument { "Deflate window bits must be between 9 and 15" };
+
+            if (deflate.memLevel < 1 || deflate.memLevel > 9)
+                throw std::invalid_argument { "Deflate memory level must be between 1 and 9" };
+
+            deflate_options_.server_enable = true;
+            deflate_options_.server_max_window_bits = deflate.windowBits;
+            deflate_options_.memLevel = deflate.memLevel;
+
+#if BOOST_VERSION >= 107500 // Threshold for uncompressed messages only available since Boost 1.75
+            deflate_options_.msg_size_threshold = deflate.minMessageSize;
+#else
+            if (deflate.minMessageSize > 0)
+                logger.warn("Messages size threshold for deflate requires Boost 1.75, every message is compressed.");
+#endif
+
+            logger.info("Permessage-deflate offered with {} window bits and memory level {}.",
+                        deflate.windowBits, deflate.memLevel);
+        }
+
+        if (timeouts.handshake.count() < 0 || timeouts.idle.count() < 0 || timeouts.close.count() < 0)
+            throw std::invalid_argument { "Timeouts must be positive, or 0 to be disabled" };
+
+        // Until Websocket stream is open, client cannot be idle
+        handshake_timeouts_.handshake_timeout = timeoutDelay(timeouts.handshake);
+        handshake_timeouts_.idle_timeout = boost::beast::websocket::stream_base::none();
+        handshake_timeouts_.keep_alive_pings = false;
+
+        // Websocket handshake timeout also applies to closing handshake
+        established_timeouts_.handshake_timeout = timeoutDelay(timeouts.close);
+        established_timeouts_.idle_timeout = timeoutDelay(timeouts.idle);
+        established_timeouts_.keep_alive_pings = timeouts.keepAlivePings;
+
+        logger.info("Handshakes timeout {}s, idle timeout {}s {} pings, close timeout {}s.",
+                    timeouts.handshake.count(), timeouts.idle.count(), timeouts.keepAlivePings ? "with" : "without",
+                    timeouts.close.count());
+
         // For each Posix signal that must be caught
         for (const int posix_signal : getCaughtSignals()) {
             boost::system::error_code err;
@@ -476,7 +1288,90 @@ public:
             }
         });
 
-        start(); // Required to start because there is no way to use polymorphism on template class
+#if RPT_RUNTIME_PLATFORM == RPT_RUNTIME_UNIX
+        boost::system::error_code dump_signal_err;
+        // SIGUSR1 only available for Unix runtime platform, latency trace is then dumped at shutdown only
+        dump_signal_handling_.add(SIGUSR1, dump_signal_err);
+
+        if (dump_signal_err)
+            logger.warn("Posix signal {} will not be caught: {}", SIGUSR1, dump_signal_err.message());
+        else
+            waitDumpSignal();
+#endif
+
+        start(accept.pendingAccepts); // Required to start because there is no way to use polymorphism on template class
+    }
+
+    /**
+     * @brief Gets endpoint clients connect to, with actual port if an ephemeral port was requested
+     *
+     * @returns Local endpoint shared by every acceptor
+     */
+    const Endpoint& localEndpoint() const {
+        return local_endpoint_;
+    }
+
+    /**
+     * @brief Gets how many times slow client policy fired since backend construction
+     *
+     * @returns Counters for slow client policy
+     */
+    const SlowClientCounters& slowClientCounters() const {
+        return slow_client_counters_;
+    }
+
+    /**
+     * @brief Gets accepted connections, failed handshakes and failed writes since backend construction
+     *
+     * @returns Counters for connections lifecycle
+     */
+    const ConnectionCounters& connectionCounters() const {
+        return connection_counters_;
+    }
+
+    /**
+     * @brief Serves metrics on given local endpoint from backend IO context, so they're formatted from backend thread
+     *
+     * @param local_endpoint Endpoint for scrapers to connect to, port 0 for an ephemeral port
+     *
+     * @throws std::logic_error if metrics are already exposed
+     * @throws boost::system::system_error if listening socket cannot be opened
+     */
+    void exposeMetrics(const boost::asio::ip::tcp::endpoint& local_endpoint) final {
+        if (metrics_endpoint_)
+            throw std::logic_error { "Metrics are already exposed" };
+
+        metrics_endpoint_ = std::make_unique<MetricsEndpoint>(
+                async_io_context_, local_endpoint, [this]() { return formatMetrics(); }, logger_);
+    }
+
+    /**
+     * @brief Gets endpoint metrics are served on
+     *
+     * @returns Metrics endpoint local endpoint, with actual port if an ephemeral port was requested
+     *
+     * @throws std::logic_error if metrics aren't exposed
+     */
+    boost::asio::ip::tcp::endpoint metricsEndpoint() const {
+        if (!metrics_endpoint_)
+            throw std::logic_error { "Metrics aren't exposed" };
+
+        return metrics_endpoint_->localEndpoint();
+    }
+
+    /**
+     * @brief Stops IO threads and handshake threads if enabled, so no more handler is ran while backend is destroyed
+     */
+    ~BeastWebsocketBackendBase() override {
+        if (handshake_threads_pool_) {
+            handshake_threads_pool_->stop();
+            handshake_threads_pool_->join();
+        }
+
+        if (io_threads_pool_) {
+            io_threads_pool_->stop();
+            io_threads_pool_->join();
+        }
     }
 
     /**
@@ -486,27 +1381,45 @@ public:
     void close() final {
         std::vector<std::uint64_t> client_tokens;
         // One token for each client
-        client_tokens.reserve(clients_stream_.size());
+        client_tokens.reserve(clients_connection_.size());
 
         // Each client must be disocnnected
-        for (const auto& client : clients_stream_) {
-            const std::uint64_t token { client.first }; // Retrieves token for current entry
-
+        clients_connection_.forEach([this, &client_tokens](const std::uint64_t token, ClientConnection&) {
             client_tokens.push_back(token);
             // Client must be unregistered before being removed
             killClient(token); // No error, server closed
-        }
+        });
 
         synchronize(); // Sends interrupt messages to clients before disconnection
 
-        // As clients_stream_ elements must not be erased during iteration, closeStream() calls are deferred
+        // As clients_connection_ elements must not be erased during iteration, closeStream() calls are deferred
         for (const std::uint64_t dead_client_token : client_tokens)
             closeStream(dead_client_token);
 
+        // Every stream was closed, even the ones pending for close
+        pollDeadClients();
+        clients_pending_close_.clear();
+
         // A null event must be pushed so waitForEvent() can properly return
         // None event must not be handled by Executor so actor UID doesn't matter
         pushInputEvent(Core::NoneEvent { 0 });
 
+        // No more connection is accepted, closed from strands acceptors might be bound to
+        for (Acceptor& acceptor : acceptors_) {
+            boost::asio::dispatch(acceptor.get_executor(), [&acceptor]() {
+                boost::system::error_code ignored_err; // Server is stopping anyway
+                acceptor.close(ignored_err);
+            });
+        }
+
+        if (metrics_endpoint_) // Scrapers can no longer connect, already connected ones are closed with IO context
+            metrics_endpoint_->close();
+
+        if constexpr (!IP_TRANSPORT) { // Nobody will connect to socket file again
+            std::error_code ignored_err;
+            std::filesystem::remove(local_endpoint_.path(), ignored_err);
+        }
+
         // As all players will be disconnected, don't care about syncing server state with LOGGED_OUT broadcast message
         // Handlers execution can be stopped right now
         async_io_context_.stop();
@@ -0,0 +1,241 @@
+#ifndef RPTOGETHER_SERVER_CLIENTSSLOTMAP_HPP
+#define RPTOGETHER_SERVER_CLIENTSSLOTMAP_HPP
+
+#include <cstdint>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * @file ClientsSlotMap.hpp
+ */
+
+
+namespace RpT::Network {
+
+
+/**
+ * @brief Thrown by `ClientsSlotMap::at()` if given token doesn't address any record, or if its slot has been reused
+ * since
+ */
+class StaleClientToken : public std::out_of_range {
+public:
+    /**
+     * @brief Constructs error for given unknown or stale token
+     *
+     * @param token Token which doesn't address any record
+     */
+    explicit StaleClientToken(const std::uint64_t token)
+    : std::out_of_range { "No record for client token " + std::to_string(token) } {}
+};
+
+
+/**
+ * @brief Dense storage for clients records, addressed by tokens encoding record slot index and slot generation
+ *
+ * Lower 32 bits of a token are the slot index inside records vector, higher 32 bits are the slot generation. Each
+ * time a record is erased, its slot generation is incremented, so a token kept by a pending operation for an erased
+ * record will never address the record reusing this slot. Every lookup is an index access, no hashing is performed.
+ *
+ * Tokens can either be chosen by caller, or retrieved by `nextToken()` which reuses freed slots first so records
+ * vector remains as dense as possible. A caller-chosen token must address an existing slot or the one right after
+ * the last slot, and mustn't have a generation lower than its slot current generation, so records vector cannot grow
+ * unbounded and an erased record token can never be reused.
+ *
+ * @tparam Record Type of data stored for each client
+ *
+ * @author ThisALV, https://github.com/ThisALV
+ */
+template<typename Record>
+class ClientsSlotMap {
+private:
+    /// Storage unit for one record, empty if no record currently uses this slot
+    struct Slot {
+        std::uint32_t generation { 0 };
+        std::optional<Record> record;
+    };
+
+    std::vector<Slot> slots_;
+    // Slots which record was erased, most recently freed at back
+    std::vector<std::uint32_t> free_slots_;
+    std::size_t records_count_;
+
+    /// Retrieves slot index part for given token
+    static std::uint32_t slotOf(const std::uint64_t token) {
+        return static_cast<std::uint32_t>(token);
+    }
+
+    /// Retrieves slot generation part for given token
+    static std::uint32_t generationOf(const std::uint64_t token) {
+        return static_cast<std::uint32_t>(token >> 32);
+    }
+
+    /// Retrieves token addressing given slot with given generation
+    static std::uint64_t tokenFor(const std::uint32_t slot, const std::uint32_t generation) {
+        return (static_cast<std::uint64_t>(generation) << 32) | slot;
+    }
+
+public:
+    /**
+     * @brief Constructs slot map without any record
+     */
+    ClientsSlotMap() : records_count_ { 0 } {}
+
+    /**
+     * @brief Checks if given token addresses a record
+     *
+     * @param token Token to check for
+     *
+     * @returns `true` if slot is used by a record with the same generation, `false` otherwise
+     */
+    bool contains(const std::uint64_t token) const {
+        const std::uint32_t slot { slotOf(token) };
+
+        return slot < slots_.size()
+            && slots_[slot].record.has_value()
+            && slots_[slot].generation == generationOf(token);
+    }
+
+    /**
+     * @brief Retrieves record addressed by given token
+     *
+     * @param token Token for record to retrieve
+     *
+     * @returns Record stored inside token slot
+     *
+     * @throws StaleClientToken if token doesn't address any record
+     */
+    Record& at(const std::uint64_t token) {
+        if (!contains(token))
+            throw StaleClientToken { token };
+
+        return *slots_[slotOf(token)].record;
+    }
+
+    /// @copydoc at(std::uint64_t)
+    const Record& at(const std::uint64_t token) const {
+        if (!contains(token))
+            throw StaleClientToken { token };
+
+        return *slots_[slotOf(token)].record;
+    }
+
+    /**
+     * @brief Inserts given record so it is addressed by given token
+     *
+     * @param token Token for new record, its slot generation replaces the previous one
+     * @param record Record to insert
+     *
+     * @returns `true` if record was inserted, `false` if slot is already used by any record, if slot is beyond the
+     * one right after the last slot or if token generation is lower than slot current generation
+     */
+    bool insert(const std::uint64_t token, Record record) {
+        const std::uint32_t slot { slotOf(token) };
+
+        if (slot > slots_.size()) // Slots are appended one by one, so any slot index doesn't allocate up to it
+            return false;
+
+        if (slot == slots_.size()) {
+            slots_.emplace_back();
+        } else if (slots_[slot].record.has_value()) {
+            return false;
+        } else if (generationOf(token) < slots_[slot].generation) { // Token for a record erased from this slot
+            return false;
+        }
+
+        // Skipped later by nextToken() if it is still listed as free but not at back
+        if (!free_slots_.empty() && free_slots_.back() == slot)
+            free_slots_.pop_back();
+
+        slots_[slot].generation = generationOf(token);
+        slots_[slot].record.emplace(std::move(record));
+        records_count_++;
+
+        return true;
+    }
+
+    /**
+     * @brief Erases record addressed by given token, its slot generation is incremented
+     *
+     * @param token Token for record to erase
+     *
+     * @returns Count of erased records, 0 if token doesn't address any record, 1 otherwise
+     */
+    std::size_t erase(const std::uint64_t token) {
+        if (!contains(token))
+            return 0;
+
+        const std::uint32_t slot { slotOf(token) };
+
+        slots_[slot].record.reset();
+        slots_[slot].generation++; // Token used by erased record is now stale
+        free_slots_.push_back(slot);
+        records_count_--;
+
+        return 1;
+    }
+
+    /**
+     * @brief Retrieves a token which isn't used by any record, reusing a freed slot if any
+     *
+     * @returns Token which can be inserted
+     */
+    std::uint64_t nextToken() {
+        // Freed slots might have been used since by a caller-chosen token
+        while (!free_slots_.empty() && slots_[free_slots_.back()].record.has_value())
+            free_slots_.pop_back();
+
+        if (!free_slots_.empty()) {
+            const std::uint32_t slot { free_slots_.back() };
+
+            return tokenFor(slot, slots_[slot].generation);
+        }
+
+        return tokenFor(static_cast<std::uint32_t>(slots_.size()), 0);
+    }
+
+    /**
+     * @brief Calls given visitor for each record, in slots order
+     *
+     * Records mustn't be inserted or erased by visitor.
+     *
+     * @param visitor Callable object taking record token and record reference as arguments
+     */
+    template<typename Visitor>
+    void forEach(Visitor&& visitor) {
+        for (std::size_t slot { 0 }; slot < slots_.size(); slot++) {
+            if (slots_[slot].record.has_value())
+                visitor(tokenFor(static_cast<std::uint32_t>(slot), slots_[slot].generation), *slots_[slot].record);
+        }
+    }
+
+    /**
+     * @brief Calls given visitor with each stored record and its token, without modifying them
+     *
+     * @param visitor Callable object taking record token and record const reference as arguments
+     */
+    template<typename Visitor>
+    void forEach(Visitor&& visitor) const {
+        for (std::size_t slot { 0 }; slot < slots_.size(); slot++) {
+            if (slots_[slot].record.has_value())
+                visitor(tokenFor(static_cast<std::uint32_t>(slot), slots_[slot].generation), *slots_[slot].record);
+        }
+    }
+
+    /**
+     * @brief Gets count of stored records
+     *
+     * @returns Count of tokens addressing a record
+     */
+    std::size_t size() const {
+        return records_count_;
+    }
+};
+
+
+}
+
+
+#endif //RPTOGETHER_SERVER_CLIENTSSLOTMAP_HPP
@@ -0,0 +1,341 @@
+#ifndef RPTOGETHER_SERVER_LENGTHPREFIXEDSTREAM_HPP
+#define RPTOGETHER_SERVER_LENGTHPREFIXEDSTREAM_HPP
+
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <boost/asio/compose.hpp>
+#include <boost/asio/post.hpp>
+#include <boost/asio/read.hpp>
+#include <boost/asio/steady_timer.hpp>
+#include <boost/asio/write.hpp>
+#include <boost/beast/core/bind_handler.hpp>
+#include <boost/beast/core/stream_traits.hpp>
+#include <boost/beast/websocket/rfc6455.hpp>
+#include <boost/beast/websocket/stream_base.hpp>
+
+/**
+ * @file LengthPrefixedStream.hpp
+ */
+
+
+namespace RpT::Network {
+
+
+/**
+ * @brief Messages stream over underlying byte stream, each message being prefixed by its size in bytes as a 32 bits
+ * big-endian unsigned integer
+ *
+ * Provides the subset of `boost::beast::websocket::stream` interface used by `BeastWebsocketBackendBase`, so trusted
+ * clients can exchange RPTL messages without HTTP upgrade, Websocket framing nor UTF-8 validation.
+ *
+ * There isn't any closing handshake. Closing stream shuts down its sending side, so peer receives every message
+ * already sent then end of stream. Connection is closed once a pending read operation sees peer closing it too, or
+ * once close timeout expired. Close reason isn't sent, RPTL `INTERRUPT` message already carries it.
+ *
+ * As for Websocket stream, at most one read operation and one write operation might be pending at a time. Stream
+ * state is shared with pending operations, so stream can be destroyed while they're pending.
+ *
+ * @tparam NextLayer Underlying stream which lowest layer is a `boost::beast::basic_stream`, providing timeouts
+ *
+ * @author ThisALV, https://github.com/ThisALV
+ */
+template<typename NextLayer>
+class LengthPrefixedStream {
+public:
+    /// Executor running stream operations, the same as underlying stream
+    using executor_type = typename NextLayer::executor_type;
+
+    /// Size in bytes for each message prefix
+    static constexpr std::size_t PREFIX_SIZE { 4 };
+    /// Default maximum size for received messages, the same as Websocket stream
+    static constexpr std::size_t DEFAULT_READ_MESSAGE_MAX { 16 * 1024 * 1024 };
+
+private:
+    using Prefix = std::array<unsigned char, PREFIX_SIZE>;
+    using Duration = boost::beast::websocket::stream_base::duration;
+
+    /// Stream state shared with pending operations, so it outlives stream until they complete
+    struct State {
+        NextLayer nextLayer;
+        // Only one read and one write operation pending at a time, so one buffer for each prefix is enough
+        Prefix readPrefix;
+        Prefix writePrefix;
+        std::size_t readMessageMax;
+        // Delay for each message to be received, none if disabled
+        Duration idleTimeout;
+        // Delay for peer to close connection once sending side was shut down, none if disabled
+        Duration closeTimeout;
+        boost::asio::steady_timer closeTimer;
+        bool closing;
+
+        template<typename NextLayerArg>
+        explicit State(NextLayerArg&& next_layer_arg)
+        : nextLayer { std::forward<NextLayerArg>(next_layer_arg) }, readPrefix {}, writePrefix {},
+        readMessageMax { DEFAULT_READ_MESSAGE_MAX }, idleTimeout { boost::beast::websocket::stream_base::none() },
+        closeTimeout { boost::beast::websocket::stream_base::none() }, closeTimer { nextLayer.get_executor() },
+        closing { false } {}
+
+        /// Closes underlying connection, cancelling any pending operation
+        void closeConnection() {
+            closeTimer.cancel();
+            boost::beast::get_lowest_layer(nextLayer).close();
+        }
+    };
+
+    /// Reads prefix then message into dynamic buffer
+    template<typename DynamicBuffer>
+    class ReadOperation {
+    private:
+        std::shared_ptr<State> state_;
+        DynamicBuffer& buffer_;
+        bool prefix_read_;
+
+    public:
+        ReadOperation(std::shared_ptr<State> state, DynamicBuffer& buffer)
+        : state_ { std::move(state) }, buffer_ { buffer }, prefix_read_ { false } {}
+
+        /// Initiates prefix read, timed out if stream has an idle timeout
+        template<typename Self>
+        void operator()(Self& self) {
+            auto& lowest_layer { boost::beast::get_lowest_layer(state_->nextLayer) };
+
+            if (state_->idleTimeout == boost::beast::websocket::stream_base::none())
+                lowest_layer.expires_never();
+            else
+                lowest_layer.expires_after(state_->idleTimeout);
+
+            boost::asio::async_read(state_->nextLayer, boost::asio::buffer(state_->readPrefix), std::move(self));
+        }
+
+        /// Reads message once its prefix was read, then completes with message size
+        template<typename Self>
+        void operator()(Self& self, const boost::system::error_code& err, const std::size_t bytes_read) {
+            if (err) {
+                if (state_->closing) // Peer closed connection or sent nothing until close timeout expired
+                    state_->closeConnection();
+
+                self.complete(err, 0);
+                return;
+            }
+
+            if (prefix_read_) {
+                buffer_.commit(bytes_read);
+                self.complete(err, bytes_read);
+                return;
+            }
+
+            prefix_read_ = true;
+
+            std::size_t message_size { 0 };
+            for (const unsigned char prefix_byte : state_->readPrefix)
+                message_size = (message_size << 8) | prefix_byte;
+
+            // Checked before any allocation, so invalid prefix cannot make server allocate up to 4 GiB
+            if (message_size > state_->readMessageMax || message_size > buffer_.max_size() - buffer_.size()) {
+                self.complete(boost::asio::error::message_size, 0);
+                return;
+            }
+
+            boost::asio::async_read(state_->nextLayer, buffer_.prepare(message_size), std::move(self));
+        }
+    };
+
+    /// Writes prefix and message with one gathering write operation
+    class WriteOperation {
+    private:
+        std::shared_ptr<State> state_;
+        boost::asio::const_buffer message_;
+
+    public:
+        WriteOperation(std::shared_ptr<State> state, const boost::asio::const_buffer& message)
+        : state_ { std::move(state) }, message_ { message } {}
+
+        /// Initiates write operation for prefix and message
+        template<typename Self>
+        void operator()(Self& self) {
+            if (message_.size() > std::numeric_limits<std::uint32_t>::max()) { // Size cannot be encoded by prefix
+                // Retrieved before operation state is moved into bound handler
+                const executor_type executor { state_->nextLayer.get_executor() };
+
+                boost::asio::post(executor, boost::beast::bind_front_handler(
+                        std::move(self), boost::asio::error::message_size, std::size_t { 0 }));
+
+                return;
+            }
+
+            const auto message_size { static_cast<std::uint32_t>(message_.size()) };
+            for (std::size_t i { 0 }; i < PREFIX_SIZE; i++)
+                state_->writePrefix[i] = static_cast<unsigned char>(message_size >> (8 * (PREFIX_SIZE - 1 - i)));
+
+            const std::array<boost::asio::const_buffer, 2> buffers {
+                boost::asio::buffer(state_->writePrefix), message_
+            };
+
+            boost::asio::async_write(state_->nextLayer, buffers, std::move(self));
+        }
+
+        /// Completes with message size, without prefix
+        template<typename Self>
+        void operator()(Self& self, const boost::system::error_code& err, const std::size_t bytes_written) {
+            self.complete(err, err ? 0 : bytes_written - PREFIX_SIZE);
+        }
+    };
+
+    /// Shuts down sending side, then waits for peer to close connection until close timeout
+    class CloseOperation {
+    private:
+        std::shared_ptr<State> state_;
+
+    public:
+        explicit CloseOperation(std::shared_ptr<State> state) : state_ { std::move(state) } {}
+
+        /// Shuts down sending side then completes, connection is closed later
+        template<typename Self>
+        void operator()(Self& self) {
+            state_->closing = true;
+
+            boost::system::error_code err;
+            boost::beast::get_lowest_layer(state_->nextLayer).socket().shutdown(
+                    boost::asio::socket_base::shutdown_send, err);
+
+            if (err) { // Connection is already broken, nothing to wait for
+                state_->closeConnection();
+            } else if (state_->closeTimeout != boost::beast::websocket::stream_base::none()) {
+                // Timer keeps state alive until connection is closed, pending read might never see end of stream
+                state_->closeTimer.expires_after(state_->closeTimeout);
+                state_->closeTimer.async_wait([state { state_ }](const boost::system::error_code& timer_err) {
+                    if (timer_err != boost::asio::error::operation_aborted)
+                        boost::beast::get_lowest_layer(state->nextLayer).close();
+                });
+            }
+
+            // Completion handler mustn't be invoked from initiating function, executor retrieved before operation state
+            // is moved into bound handler
+            const executor_type executor { state_->nextLayer.get_executor() };
+            boost::asio::post(executor, boost::beast::bind_front_handler(std::move(self), err));
+        }
+
+        /// Completes with shut down result
+        template<typename Self>
+        void operator()(Self& self, const boost::system::error_code& err) {
+            self.complete(err);
+        }
+    };
+
+    std::shared_ptr<State> state_;
+
+public:
+    /**
+     * @brief Constructs stream with underlying stream constructed from given argument
+     *
+     * @param next_layer_arg Argument forwarded to underlying stream constructor, like a connected socket
+     */
+    template<typename NextLayerArg>
+    explicit LengthPrefixedStream(NextLayerArg&& next_layer_arg)
+    : state_ { std::make_shared<State>(std::forward<NextLayerArg>(next_layer_arg)) } {}
+
+    /**
+     * @brief Closes underlying connection if stream wasn't closed, otherwise lets connection be closed by pending
+     * operations
+     */
+    ~LengthPrefixedStream() {
+        if (state_ && !state_->closing)
+            boost::beast::get_lowest_layer(state_->nextLayer).close();
+    }
+
+    // Pending operations refer to shared state, so stream can be moved but not copied
+
+    LengthPrefixedStream(LengthPrefixedStream&&) noexcept = default;
+    LengthPrefixedStream& operator=(LengthPrefixedStream&&) noexcept = default;
+
+    /// Gets executor running stream operations
+    executor_type get_executor() noexcept {
+        return state_->nextLayer.get_executor();
+    }
+
+    /// Gets underlying stream
+    NextLayer& next_layer() noexcept {
+        return state_->nextLayer;
+    }
+
+    /// @copydoc next_layer()
+    const NextLayer& next_layer() const noexcept {
+        return state_->nextLayer;
+    }
+
+    /**
+     * @brief Sets maximum size for received messages, larger messages fail read operation with `message_size` error
+     *
+     * @param max_size Maximum message size in bytes
+     */
+    void read_message_max(const std::size_t max_size) {
+        state_->readMessageMax = max_size;
+    }
+
+    /**
+     * @brief Does nothing, as messages framing is the same for text and binary messages
+     *
+     * Provided so stream can be used as Websocket stream.
+     */
+    void binary(bool) {}
+
+    /**
+     * @brief Applies timeouts options as for Websocket stream
+     *
+     * Idle timeout applies to each message reception, and handshake timeout applies to closure as Websocket closing
+     * handshake. There isn't any ping frame, so keep alive pings are ignored.
+     *
+     * @param timeouts Timeouts options
+     */
+    void set_option(const boost::beast::websocket::stream_base::timeout& timeouts) {
+        state_->idleTimeout = timeouts.idle_timeout;
+        state_->closeTimeout = timeouts.handshake_timeout;
+    }
+
+    /**
+     * @brief Reads next message into given buffer
+     *
+     * @param buffer Dynamic buffer which message is appended to, must outlive operation
+     * @param handler Completion handler with signature `void(boost::system::error_code, std::size_t)`, called with
+     * read message size
+     */
+    template<typename DynamicBuffer, typename ReadHandler>
+    auto async_read(DynamicBuffer& buffer, ReadHandler&& handler) {
+        return boost::asio::async_compose<ReadHandler, void(boost::system::error_code, std::size_t)>(
+                ReadOperation<DynamicBuffer> { state_, buffer }, handler, state_->nextLayer);
+    }
+
+    /**
+     * @brief Writes given message prefixed by its size
+     *
+     * @param message Message to write, data must be valid until operation completes
+     * @param handler Completion handler with signature `void(boost::system::error_code, std::size_t)`, called with
+     * written message size
+     */
+    template<typename WriteHandler>
+    auto async_write(const boost::asio::const_buffer& message, WriteHandler&& handler) {
+        return boost::asio::async_compose<WriteHandler, void(boost::system::error_code, std::size_t)>(
+                WriteOperation { state_, message }, handler, state_->nextLayer);
+    }
+
+    /**
+     * @brief Shuts down stream sending side, connection being closed once peer closed it or close timeout expired
+     *
+     * @param handler Completion handler with signature `void(boost::system::error_code)`
+     */
+    template<typename CloseHandler>
+    auto async_close(const boost::beast::websocket::close_reason&, CloseHandler&& handler) {
+        return boost::asio::async_compose<CloseHandler, void(boost::system::error_code)>(
+                CloseOperation { state_ }, handler, state_->nextLayer);
+    }
+};
+
+
+}
+
+
+#endif //RPTOGETHER_SERVER_LENGTHPREFIXEDSTREAM_HPP
@@ -0,0 +1,58 @@
+#ifndef RPTOGETHER_SERVER_LENGTHPREFIXEDTCPBACKEND_HPP
+#define RPTOGETHER_SERVER_LENGTHPREFIXEDTCPBACKEND_HPP
+
+#include <RpT-Network/BeastWebsocketBackendBase.inl>
+#include <RpT-Network/LengthPrefixedStream.hpp>
+
+/**
+ * @file LengthPrefixedTcpBackend.hpp
+ */
+
+
+namespace RpT::Network {
+
+
+/**
+ * @brief `BeastWebsocketBackendBase` implementation for trusted clients on private networks, exchanging length-prefixed
+ * RPTL messages over plain TCP
+ *
+ * There isn't any handshake, client is added as soon as its connection is accepted. Without HTTP upgrade, Websocket
+ * framing and UTF-8 validation, each message costs only its 4 bytes prefix. This backend must never be exposed to
+ * untrusted networks, as there isn't any encryption.
+ *
+ * As there is no ping message, idle timeout is disabled by default so clients only receiving messages aren't killed,
+ * and close timeout bounds time waited for client to close connection once server closed it.
+ *
+ * @author ThisALV, https://github.com/ThisALV
+ */
+class LengthPrefixedTcpBackend
+        : public BeastWebsocketBackendBase<boost::beast::tcp_stream, LengthPrefixedStream<boost::beast::tcp_stream>> {
+protected:
+    /// Implementation takes base TCP socket to build length-prefixed stream, then immediately adds it
+    void openClientStream(boost::asio::ip::tcp::socket new_client_connection) final;
+
+public:
+    /**
+     * @brief Calls superclass constructor without any Websocket or handshake option
+     *
+     * @param local_endpoint Local server endpoint to be listening on
+     * @param logging_context Context providing logging features
+     * @param io_threads_count Number of threads running clients IO operations, see `BeastWebsocketBackendBase`
+     * @param outbound_limits Limits for clients sending queues, see `BeastWebsocketBackendBase`
+     * @param accept Listening sockets and pending accept operations, see `BeastWebsocketBackendBase`
+     * @param timeouts Idle and close timeouts, handshake timeout is ignored, idle timeout disabled by default
+     *
+     * @throws boost::system::system_error if a listening socket cannot be opened
+     * @throws std::invalid_argument if accept options or timeouts are invalid
+     */
+    LengthPrefixedTcpBackend(const boost::asio::ip::tcp::endpoint& local_endpoint,
+                             Utils::LoggingContext& logging_context, std::size_t io_threads_count = 0,
+                             const OutboundQueueLimits& outbound_limits = {}, const AcceptOptions& accept = {},
+                             const TimeoutOptions& timeouts = lengthPrefixedTimeouts());
+};
+
+
+}
+
+
+#endif //RPTOGETHER_SERVER_LENGTHPREFIXEDTCPBACKEND_HPP
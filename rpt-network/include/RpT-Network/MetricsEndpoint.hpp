@@ -0,0 +1,82 @@
+#ifndef RPTOGETHER_SERVER_METRICSENDPOINT_HPP
+#define RPTOGETHER_SERVER_METRICSENDPOINT_HPP
+
+#include <chrono>
+#include <functional>
+#include <string>
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/ip/tcp.hpp>
+#include <RpT-Utils/LoggerView.hpp>
+
+/**
+ * @file MetricsEndpoint.hpp
+ */
+
+
+namespace RpT::Network {
+
+
+/**
+ * @brief Minimal HTTP server exposing Prometheus metrics on `GET /metrics`, any other request being answered with an
+ * error status
+ *
+ * Connections are kept alive between scrapes if client asks for it, and are closed if no request is received before
+ * timeout. Every operation is ran by given IO context, so metrics formatter is called from the thread running it,
+ * and no lock is required for formatter to read state owned by that thread.
+ *
+ * @author ThisALV, https://github.com/ThisALV
+ */
+class MetricsEndpoint {
+private:
+    /// Delay for a scrape request to be received, then for its response to be sent
+    static constexpr std::chrono::seconds SCRAPE_TIMEOUT { 10 };
+
+    /// HTTP connection with a scraper, defined by implementation as it only requires Beast there
+    class Session;
+
+    Utils::LoggerView logger_;
+    std::function<std::string()> metrics_formatter_;
+    boost::asio::ip::tcp::acceptor acceptor_;
+
+    /**
+     * @brief Accepts next scraper connection, then waits for next connection again
+     */
+    void waitNextScraper();
+
+public:
+    /**
+     * @brief Starts listening for scrapers on given local endpoint
+     *
+     * @param io_context Context running every HTTP operation, must outlive endpoint
+     * @param local_endpoint Endpoint to listen on, port 0 for an ephemeral port
+     * @param metrics_formatter Retrieves metrics using Prometheus text exposition format, for each scrape
+     * @param logger Logger for endpoint errors
+     *
+     * @throws boost::system::system_error if listening socket cannot be opened
+     */
+    MetricsEndpoint(boost::asio::io_context& io_context, const boost::asio::ip::tcp::endpoint& local_endpoint,
+                    std::function<std::string()> metrics_formatter, Utils::LoggerView logger);
+
+    // Entity class semantic :
+
+    MetricsEndpoint(const MetricsEndpoint&) = delete;
+    MetricsEndpoint& operator=(const MetricsEndpoint&) = delete;
+
+    /**
+     * @brief Gets endpoint scrapers connect to, with actual port if an ephemeral port was requested
+     *
+     * @returns Listening socket local endpoint
+     */
+    boost::asio::ip::tcp::endpoint localEndpoint() const;
+
+    /**
+     * @brief Stops accepting scrapers connections, connections already accepted are closed once IO context stops
+     */
+    void close();
+};
+
+
+}
+
+
+#endif //RPTOGETHER_SERVER_METRICSENDPOINT_HPP
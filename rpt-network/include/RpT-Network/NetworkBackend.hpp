@@ -7,10 +7,16 @@
 #include <queue>
 #include <stdexcept>
 #include <string>
+#include <string_view>
 #include <unordered_map>
+#include <vector>
+#include <boost/asio/ip/tcp.hpp>
+#include <RpT-Core/InputEventQueue.hpp>
 #include <RpT-Core/InputOutputInterface.hpp>
 #include <RpT-Utils/HandlingResult.hpp>
+#include <RpT-Utils/PrometheusWriter.hpp>
 #include <RpT-Utils/TextProtocolParser.hpp>
+#include <RpT-Network/ClientsSlotMap.hpp>
 
 /**
  * @file NetworkBackend.hpp
@@ -101,7 +107,7 @@ public:
 
 
 /**
- * @brief Thrown by `NetworkBackend::addClient()` if given token is already in use
+ * @brief Thrown by `NetworkBackend::addClient()` if given token is already in use, or cannot be used
  *
  * @author ThisALV, https://github.com/ThisALV
  */
@@ -110,10 +116,10 @@ public:
     /**
      * @brief Constructs basic error message for given token
      *
-     * @param used_token Token used by another connected client
+     * @param used_token Token used by another connected client, stale or too far from any used token
      */
     explicit UnavailableClientToken(const std::uint64_t used_token)
-    : std::logic_error { "Client token " + std::to_string(used_token) + " is already in use" } {}
+    : std::logic_error { "Client token " + std::to_string(used_token) + " is unavailable" } {}
 };
 
 
@@ -134,6 +140,23 @@ public:
 };
 
 
+/**
+ * @brief Thrown by `NetworkBackend` in-process clients methods if given client is connected by implementation
+ *
+ * @author ThisALV, https://github.com/ThisALV
+ */
+class NotInProcessClient : public std::logic_error {
+public:
+    /**
+     * @brief Constructs basic error message for given token
+     *
+     * @param client_token Token used by a client connected by implementation
+     */
+    explicit NotInProcessClient(const std::uint64_t client_token)
+    : std::logic_error { "Client " + std::to_string(client_token) + " isn't an in-process client" } {}
+};
+
+
 /**
  * @brief Thrown by `NetworkBackend::closePipelineWith()` if given toke is already in use
  *
@@ -151,6 +174,21 @@ public:
 };
 
 
+/**
+ * @brief Messages received from clients since backend construction, by RPTL command, either text or binary encoded
+ */
+struct InboundMessagesCounters {
+    /// `LOGIN` handshakes which registered an actor
+    std::uint64_t login { 0 };
+    /// `LOGOUT` commands
+    std::uint64_t logout { 0 };
+    /// `SERVICE` commands carrying a Service Request
+    std::uint64_t service { 0 };
+    /// Ill-formed messages or messages which couldn't be handled, each one disconnecting its client
+    std::uint64_t rejected { 0 };
+};
+
+
 /**
  * @brief Base class for `RpT::Core::InputOutputInterface` implementations based on networking protocol.
  *
@@ -165,7 +203,8 @@ public:
  *
  * Every triggered input event is pushed into an events queue checked each time `waitForInput()` is called. If queue
  * is empty, `waitForEvent()` (defined by implementation) waits for IO operations handled to push at least one input
- * event into queue.
+ * event into queue. Queued events payload is copied into recycled buffers, so events retrieved by `waitForInput()` or
+ * `waitForInputs()` might borrow these buffers and must not be used after next call to one of these methods.
  *
  * Each time interaction from clients is expected, call to `syncClient()` (defined by implementation) if performed to
  * ensure clients are aware about server and game state before doing any interaction.
@@ -196,10 +235,34 @@ public:
  * Messages from server to clients can take two forms : private message or broadcast message. Private messages are
  * sent to a specific registered or not client token while broadcast messages are sent to all registered clients.
  *
+ * At handshake, client might opt into batched messages by appending `BATCH` flag to its command. Then, each time
+ * more than one message is flushed for that client by a single `synchronize()` call, these messages are gathered
+ * inside one `BATCH` message so they're sent by a single IO operation. Each gathered message is prefixed by its size
+ * in bytes, so messages containing spaces or newlines are still delimited without ambiguity. A client which opted
+ * into batched messages must still handle non-batched messages, as a single flushed message isn't batched.
+ *
+ * At handshake, client might also opt into binary encoding by appending `BINARY` flag to its command. Service
+ * Requests and logout can then be sent as binary messages, decoded straight into input events without any text
+ * parsing, and Service Request Responses and Service Events are sent as binary messages to that client. Binary message
+ * begins with its opcode byte, which is never an ASCII character, so text messages like `REGISTRATION` or `INTERRUPT`
+ * are still sent to and received from a client with binary encoding. Integers are unsigned LEB128 varints, and strings
+ * are prefixed by their size in bytes as varint. Over Websocket, messages for binary encoding clients are sent
+ * inside binary frames.
+ *
+ * Clients running inside server process, like scripted NPCs, can be connected with `connectInProcess()`. They use the
+ * same clients and actors registries than clients connected by implementation, but they push input events directly
+ * instead of sending RPTL messages, and they poll their messages queue as shared buffers instead of being synced by
+ * implementation. So no IO operation nor RPTL parsing is done for them. As any other backend operation, in-process
+ * clients methods must be called from the thread calling `waitForInput()`.
+ *
+ * Backend state can be formatted as Prometheus metrics by `formatMetrics()`, along with main loop metrics attached
+ * to interface. Implementation might expose them with `exposeMetrics()`, and add its own metrics by overriding
+ * `writeMetrics()`.
+ *
  * Commands summary:
  *
  * Client to server:
- * - Handshake: `LOGIN <uid> <name>`, must NOT be registered
+ * - Handshake: `LOGIN <uid> <name> [BATCH] [BINARY]`, must NOT be registered
  * - Log out (clean way): `LOGOUT`, must BE registered
  * - Send Service Request command: `SERVICE <SR_command>` (see `Core::ServiceEventRequestProtocol`), must BE registered
  *
@@ -207,12 +270,19 @@ public:
  * - Registration confirmation: `REGISTRATION [<uid_1> <actor_1>]...`, must NOT be registered
  * - Connection closed: `INTERRUPT [ERR_MSG]`, must BE registered
  * - Service Request Response: `SERVICE <SRR>`, must BE registered, see `Core::ServiceEventRequestProtocol` for SRR doc
+ * - Batched messages: `BATCH [<size_1> <message_1>]...`, only if client opted into batched messages at handshake
  *
  * Server to clients, broadcast, must BE registered:
  * - Logged in actor: `LOGGED_IN <uid> <name>`
  * - Logged out actor: `LOGGED_OUT <uid>`
  * - Service Event command: `SERVICE <SE_command>`
  *
+ * Binary messages, only if client opted into binary encoding at handshake:
+ * - Client to server, Service Request: `0x80 <RUID> <service_name> <command_data>`
+ * - Client to server, log out: `0x81`
+ * - Server to client, Service Request Response: `0x82 <RUID> 0x00` for OK, `0x82 <RUID> 0x01 <ERR_MSG>` for KO
+ * - Server to clients, Service Event: `0x83 <service_name> <event_data>`
+ *
  * @author ThisALV, https://github.com/ThisALV
  */
 class NetworkBackend : public Core::InputOutputInterface {
@@ -233,6 +303,19 @@ private:
     static constexpr std::string_view INTERRUPT_COMMAND { "INTERRUPT" };
     static constexpr std::string_view LOGGED_IN_COMMAND { "LOGGED_IN" };
     static constexpr std::string_view LOGGED_OUT_COMMAND { "LOGGED_OUT" };
+    static constexpr std::string_view BATCH_COMMAND { "BATCH" };
+
+    /// Handshake flag for client opting into binary encoding
+    static constexpr std::string_view BINARY_FLAG { "BINARY" };
+
+    /*
+     * Opcodes for binary encoding, all of them are outside ASCII range so text messages cannot be mistaken for them
+     */
+
+    static constexpr std::uint8_t BINARY_SERVICE_REQUEST { 0x80 };
+    static constexpr std::uint8_t BINARY_LOGOUT { 0x81 };
+    static constexpr std::uint8_t BINARY_SERVICE_RESPONSE { 0x82 };
+    static constexpr std::uint8_t BINARY_SERVICE_EVENT { 0x83 };
 
     /// Parser for RPTL Protocol command, only parsing command name
     class RptlCommandParser : public Utils::TextProtocolParser {
@@ -253,6 +336,8 @@ private:
     class HandshakeParser : public Utils::TextProtocolParser {
     private:
         std::uint64_t parsed_actor_uid_;
+        bool batched_messages_;
+        bool binary_messages_;
 
     public:
         /**
@@ -261,7 +346,7 @@ private:
          * @param parsed_rptl_command Parsed RPTL `LOGIN` command
          *
          * @throws BadClientMessage if parsed actor UID isn't a valid unsigned integer of 64bits, or if extra args
-         * are given
+         * other than `BATCH` and `BINARY` flags are given, or if a flag is given twice
          * @throws NotEnoughWords if arguments are missing
          */
         explicit HandshakeParser(const RptlCommandParser& parsed_rptl_command);
@@ -271,6 +356,12 @@ private:
 
         /// Retrieves new actor name
         std::string_view actorName() const;
+
+        /// Checks if client opted into batched messages with `BATCH` flag
+        bool batchedMessages() const;
+
+        /// Checks if client opted into binary encoding with `BINARY` flag
+        bool binaryMessages() const;
     };
 
     /// Parser for RPTL `SERVICE` command arguments
@@ -287,10 +378,53 @@ private:
         std::string_view serviceRequest() const;
     };
 
+    /// Reads fields from a binary message one after the other, without any copy
+    class BinaryMessageReader {
+    private:
+        std::string_view remaining_;
+
+    public:
+        /// Constructs reader for given binary message, beginning with opcode
+        explicit BinaryMessageReader(std::string_view binary_message);
+
+        /**
+         * @brief Reads next unsigned LEB128 varint
+         *
+         * @throws BadClientMessage if message ends before varint, or if varint doesn't fit into 64 bits
+         */
+        std::uint64_t readVarint();
+
+        /**
+         * @brief Reads next single byte
+         *
+         * @throws BadClientMessage if message ends before byte
+         */
+        std::uint8_t readByte();
+
+        /**
+         * @brief Reads next string prefixed by its size as varint
+         *
+         * @throws BadClientMessage if message ends before string
+         */
+        std::string_view readString();
+
+        /**
+         * @brief Checks that every field of given binary command has been read
+         *
+         * @throws TooManyArguments if message continues
+         */
+        void checkEnd(std::string_view command) const;
+    };
+
     /// Connected client status, providing alive/dead status and disconnection reason, if no longer alive
     struct ClientStatus {
         bool alive;
         Utils::HandlingResult disconnectionReason;
+        bool batchedMessages;
+        // Opted into binary encoding for Service Requests, Responses and Events
+        bool binaryMessages;
+        // Connected by connectInProcess() instead of implementation
+        bool inProcess;
     };
 
     /// Registered client actor has an UID and a name
@@ -299,24 +433,104 @@ private:
         std::string name;
     };
 
-    // First value for client alive or not status; Second value uninitialized if unregistered
-    std::unordered_map<std::uint64_t, std::pair<ClientStatus, std::optional<Actor>>> connected_clients_;
-    // Actor UID with its owner client token
-    std::unordered_map<std::uint64_t, std::uint64_t> actors_registry_;
-    // Each client stream remaining messages to send, same message might be sent to many clients, so using sharde_ptr
-    std::unordered_map<std::uint64_t, std::queue<std::shared_ptr<std::string>>> clients_remaining_messages_;
+    /// Connected client state, stored inside one record so a single lookup is required for each client
+    struct Client {
+        ClientStatus status;
+        // Uninitialized if unregistered
+        std::optional<Actor> actor;
+        // Remaining messages to send, same message might be sent to many clients, so using shared_ptr
+        std::queue<std::shared_ptr<std::string>> remainingMessages;
+    };
+
+    /// Registered actor owner client, with its entry index inside registration entries
+    struct RegisteredActor {
+        std::uint64_t ownerClient;
+        std::size_t registrationEntry;
+    };
+
+    /// Actor ` <uid> <name>` entry inside serialized registry, marked as removed when unregistered until compaction
+    struct RegistrationEntry {
+        std::uint64_t uid;
+        std::size_t offset;
+        std::size_t length;
+        bool removed;
+    };
+
+    // Each connected client state, addressed by its token
+    ClientsSlotMap<Client> connected_clients_;
+    // Actor UID with its owner client token and registration entry
+    std::unordered_map<std::uint64_t, RegisteredActor> actors_registry_;
+    // Actor name with its UID, for each actor inside registry
+    std::unordered_map<std::string, std::uint64_t> actors_names_;
+    // Entries in registration order, removed ones are compacted when serialized registry is retrieved
+    std::vector<RegistrationEntry> registration_entries_;
+    // Serialized actors registry, appended at each actor registration and compacted on demand after unregistrations
+    std::string registration_message_ { REGISTRATION_COMMAND };
+    // Index of first entry marked as removed, entries count if there isn't any
+    std::size_t first_removed_entry_ { 0 };
+    // Clients which had an empty messages queue before a message was pushed, so only them are synced
+    std::vector<std::uint64_t> clients_to_sync_;
+    // Clients which are no longer alive since last pollDeadClients() call
+    std::vector<std::uint64_t> dead_clients_;
     // Input events emitted waiting to be handled
-    std::queue<Core::AnyInputEvent> input_events_queue_;
+    Core::InputEventQueue input_events_queue_;
+    // Messages received from clients connected by implementation
+    InboundMessagesCounters inbound_messages_counters_;
 
     /**
      * @brief If input events queue isn't empty, take and retrive next event to handle
      *
      * Called at `waitForInput()` beginning to poll any queued event before waiting for another to be triggered.
+     * Service Requests sent by actors which are no longer registered are dropped, as they cannot be replied.
      *
      * @returns Next triggered input event if any, uninitialized otherwise
      */
     std::optional<Core::AnyInputEvent> pollInputEvent();
 
+    /**
+     * @brief Retrieves request traced by `Core::LatencyTracer` for given input event
+     *
+     * @param input_event Input event to retrieve request for
+     *
+     * @returns Client token and RUID if event is a Service Request with valid RUID from a registered actor,
+     * uninitialized otherwise
+     */
+    std::optional<Core::LatencyTracer::TraceKey> traceKeyOf(const Core::AnyInputEvent& input_event) const;
+
+    /**
+     * @brief Registers new actor for given client, queueing registration and logged in messages
+     *
+     * @param client_token Client to be passed into registered mode
+     * @param actor_uid New actor UID
+     * @param actor_name New actor name
+     *
+     * @returns Input triggered by actor registration
+     *
+     * @throws InternalError if registration hasn't been done (example: unavailable UID)
+     */
+    Core::JoinedEvent login(std::uint64_t client_token, std::uint64_t actor_uid, std::string actor_name);
+
+    /**
+     * @brief Unregisters given actor for its client, queueing interrupt and logged out messages
+     *
+     * @param actor_uid UID for registered actor to logout
+     *
+     * @returns Input triggered by clean actor disconnection
+     */
+    Core::LeftEvent logout(std::uint64_t actor_uid);
+
+    /**
+     * @brief Retrieves given in-process client
+     *
+     * @param client_token Token for in-process client
+     *
+     * @returns Client state
+     *
+     * @throws UnknownClientToken if no client is connected using given token
+     * @throws NotInProcessClient if client is connected by implementation
+     */
+    Client& inProcessClient(std::uint64_t client_token);
+
     /**
      * @brief Initializes alive actor associated with given client using UID and name parameters
      *
@@ -328,6 +542,16 @@ private:
      */
     void registerActor(std::uint64_t client_token, std::uint64_t actor_uid, std::string name);
 
+    /**
+     * @brief Marks given client as no longer alive, listing it as dead client if it was alive before
+     *
+     * In-process clients aren't listed, as implementation has no connection to close for them.
+     *
+     * @param client_token Token for dying client
+     * @param client_status Status for dying client
+     */
+    void markDead(std::uint64_t client_token, ClientStatus& client_status);
+
     /**
      * @brief Remove actor using given UID, making associated client no longer alive
      *
@@ -335,6 +559,63 @@ private:
      */
     void unregisterActor(std::uint64_t actor_uid);
 
+    /**
+     * @brief Formats RPTL `BATCH` message gathering every message inside given queue, which is flushed
+     *
+     * @param messages_queue Queue for messages to gather
+     *
+     * @returns RPTL BATCH message
+     */
+    static std::string formatBatchMessage(std::queue<std::shared_ptr<std::string>>& messages_queue);
+
+    /**
+     * @brief Formats RPTL message transmitting given SER protocol message with SERVICE command
+     *
+     * @param ser_message SER protocol message to transmit
+     *
+     * @returns RPTL SERVICE message
+     */
+    static std::string formatServiceMessage(const std::string& ser_message);
+
+    /// Appends given integer as unsigned LEB128 varint to given binary message
+    static void appendVarint(std::string& binary_message, std::uint64_t value);
+
+    /// Appends given string prefixed by its size as varint to given binary message
+    static void appendString(std::string& binary_message, std::string_view value);
+
+    /**
+     * @brief Formats binary message transmitting given SER protocol message, SRR or SE command
+     *
+     * SER command is split into its fields, each one being encoded without being copied into an intermediate string.
+     *
+     * @param ser_message SER protocol message to transmit
+     *
+     * @returns Binary Service Request Response or Service Event message, or RPTL SERVICE message if given SER
+     * message isn't a SRR nor a SE command
+     */
+    static std::string formatBinaryServiceMessage(std::string_view ser_message);
+
+    /**
+     * @brief Formats message transmitting given SER protocol message with encoding used by given client
+     *
+     * @param client Client to send message to
+     * @param ser_message SER protocol message to transmit
+     *
+     * @returns Binary message if client opted into binary encoding, RPTL SERVICE message otherwise
+     */
+    static std::string formatServiceMessageFor(const Client& client, const std::string& ser_message);
+
+    /**
+     * @brief Pushes given shared message into queue for given client, marking client as requiring sync if its queue
+     * was empty
+     *
+     * @param client_token Client owning queue
+     * @param messages_queue Clients queue to be pushed
+     * @param message_owner Message to push into queue, might be shared with other clients queues
+     */
+    void queueMessage(std::uint64_t client_token, std::queue<std::shared_ptr<std::string>>& messages_queue,
+                      std::shared_ptr<std::string> message_owner);
+
     /**
      * @brief Pushes given message into queue for given client
      *
@@ -362,7 +643,7 @@ private:
      * @throws InternalError if invoked command is valid connection handshake but registration hasn't been done
      * (server internal state fault, example: unavailable UID)
      */
-    Core::JoinedEvent handleHandshake(std::uint64_t client_token, const std::string& message_handshake);
+    Core::JoinedEvent handleHandshake(std::uint64_t client_token, std::string_view message_handshake);
 
     /**
      * @brief Parses given received RPTL message from client with associated registered actor UID and retrieves
@@ -372,20 +653,38 @@ private:
      * @param regular_message Received client message (received network data) to handle
      *
      * @returns Event triggered by message, must be `Core::LeftEvent` or `Core::ServiceRequestEvent`, as only these
-     * events can be triggered by a registered actor
+     * events can be triggered by a registered actor. Service Request borrows given message, so message must outlive it.
      *
      * @throws BadClientMessage if given client message is ill-formed (missing args, unknown command...)
      */
-    Core::AnyInputEvent handleRegular(std::uint64_t client_actor, const std::string& regular_message);
+    Core::AnyInputEvent handleRegular(std::uint64_t client_actor, std::string_view regular_message);
 
     /**
-     * @brief Generates RPTL Registration command message from current server state
+     * @brief Decodes given received binary message from client with associated registered actor UID and retrieves
+     * triggered input event
+     *
+     * @param client_actor UID for actor representing this client
+     * @param binary_message Received client message, beginning with binary opcode
      *
-     * @returns Formatted RPTL message using `REGISTRATION` command
+     * @returns Event triggered by message, must be `Core::LeftEvent` or `Core::ServiceRequestEvent` already decoded,
+     * borrowing given message so message must outlive it
+     *
+     * @throws BadClientMessage if given client message is ill-formed (truncated fields, unknown opcode...)
      */
-    std::string formatRegistrationMessage() const;
+    Core::AnyInputEvent handleBinary(std::uint64_t client_actor, std::string_view binary_message);
 
 protected:
+    /**
+     * @brief Retrieves RPTL Registration command message from current server state
+     *
+     * Message is kept serialized, registered actors are appended to it. Unregistered actors are only marked as removed,
+     * so message is compacted once by next call, whichever count of actors were unregistered in the meantime. Only
+     * entries after first removed one are moved back.
+     *
+     * @returns Formatted RPTL message using `REGISTRATION` command, valid until registry is modified
+     */
+    const std::string& formatRegistrationMessage();
+
     /**
      * @brief Parses given RPTL message from given client and retrieves triggered input event. Messages required to
      * sync clients with new server state pushed into corresponding messages queues.
@@ -394,7 +693,8 @@ protected:
      * unregistered/registered).
      *
      * @param client_token
-     * @param client_message
+     * @param client_message Received message, triggered Service Request borrows it so it must outlive event until
+     * event is pushed
      *
      * @returns Event triggered by message, type must be `Core::LeftEvent`, `Core::ServiceRequestEvent` or
      * `Core::JoinedEvent` as only these events can be triggered by a client RPTL message
@@ -403,7 +703,7 @@ protected:
      * @throws InternalError if invoked command is valid but server state makes it unable to propery handles command
      * (example: unavailable new actor UID for handshake command)
      */
-    Core::AnyInputEvent handleMessage(std::uint64_t client_token, const std::string& client_message);
+    Core::AnyInputEvent handleMessage(std::uint64_t client_token, std::string_view client_message);
 
     /**
      * @brief Checks if given actor UID is available or not, called before `registerActor()` to check for
@@ -418,9 +718,23 @@ protected:
     /**
      * @brief Push given triggered input event into queue
      *
+     * Event payload is copied into a recycled buffer, so buffers borrowed by given event can be reused once it is
+     * pushed.
+     *
      * @param input_event Triggered input event to push
      */
-    void pushInputEvent(Core::AnyInputEvent input_event);
+    void pushInputEvent(const Core::AnyInputEvent& input_event);
+
+    /**
+     * @brief Begins latency trace for given input event if it is a Service Request and if latency is traced, must be
+     * called by implementation before triggered event is pushed
+     *
+     * @param client_token Client which sent message triggering input event
+     * @param input_event Input event triggered by message
+     * @param read_at When message was read from client connection
+     */
+    void traceReceived(std::uint64_t client_token, const Core::AnyInputEvent& input_event,
+                       Core::LatencyTracer::Clock::time_point read_at);
 
     /**
      * @brief Wait for external input event to happen and to be queued by running implementation asynchronous events
@@ -431,21 +745,68 @@ protected:
      */
     virtual void waitForEvent() = 0;
 
+    /**
+     * @brief Retrieves clients which are no longer alive since previous call, so implementation doesn't have to check
+     * for each connected client if it is alive
+     *
+     * @returns Tokens for each client killed since previous call, each token retrieved exactly once
+     */
+    std::vector<std::uint64_t> pollDeadClients();
+
     /**
      * @brief Ensures clients state are same than current server state by calling implementation-defined `syncClient
      * ()` method
      *
      * This method must be called by implementation. It is recommended to put call inside `waitForEvent()`
      * implementation, so it will be called each time interaction with clients might occurres.
+     *
+     * Only clients which received messages since previous call are synced, so cost doesn't depend on connected
+     * clients count. Messages queued by `syncClient()` implementation, for example if it kills a client, are synced
+     * by the same call.
      */
     void synchronize();
 
+    /**
+     * @brief Checks if given RPTL message is transmitting a Service Event command
+     *
+     * A client missing some Service Events will not be desynced at RPTL level, so it is the only kind of messages
+     * which might be dropped by implementation.
+     *
+     * @param rptl_message Formatted RPTL message
+     *
+     * @returns `true` if message is a `SERVICE` command transmitting a SE command, or a binary Service Event,
+     * `false` otherwise
+     */
+    static bool isServiceEvent(std::string_view rptl_message);
+
+    /**
+     * @brief Checks if given message is a binary message, beginning with binary opcode
+     *
+     * @param message Received or formatted message
+     *
+     * @returns `true` if first byte is outside ASCII range, `false` otherwise
+     */
+    static bool isBinaryMessage(std::string_view message);
+
+    /**
+     * @brief Checks if given client opted into binary encoding, so messages must be sent as binary data by
+     * implementation
+     *
+     * @param client_token Client to check encoding for
+     *
+     * @returns `true` if client handshake had `BINARY` flag, `false` otherwise
+     *
+     * @throws UnknownClientToken if given client doesn't exist
+     */
+    bool binaryMessages(std::uint64_t client_token) const;
+
     /**
      * @brief Flushes messages queue in argument queue, must sends asynchronously all messages in flushed queue to
      * corresponding client
      *
      * Called by `synchronize()` to sync each client after messages queue has been flushed, must be overridden by
-     * `NetworkBackend` implementations, but not called.
+     * `NetworkBackend` implementations, but not called. Clients without any message to send aren't synced, so
+     * flushed queue is never empty.
      */
     virtual void syncClient(std::uint64_t client_token,
                             std::queue<std::shared_ptr<std::string>> flushed_messages_queue) = 0;
@@ -459,12 +820,22 @@ protected:
      */
     bool inputReady() const;
 
+    /**
+     * @brief Retrieves a token which isn't used by any connected client, reusing freed clients storage if possible
+     *
+     * Token is only reserved once client has been added with it.
+     *
+     * @returns Token available for `addClient()`
+     */
+    std::uint64_t nextClientToken();
+
     /**
      * @brief Add new connected client with given token, alive and unregistered
      *
-     * @param new_token Token used by new client
+     * @param new_token Token used by new client, should be retrieved by `nextClientToken()`
      *
-     * @throws UnavailableClientToken if `new_token` is already used by another connected client
+     * @throws UnavailableClientToken if `new_token` is already used by another connected client, was used by a removed
+     * client or is too far from any used token
      */
     void addClient(std::uint64_t new_token);
 
@@ -513,6 +884,16 @@ protected:
      */
     const Utils::HandlingResult& disconnectionReason(std::uint64_t client_token) const;
 
+    /**
+     * @brief Writes connected clients, registered actors and inbound messages families, then main loop metrics
+     * families if any metrics are attached to interface
+     *
+     * Implementation overriding it must call this method so common metrics are still written.
+     *
+     * @param metrics Writer to format families with
+     */
+    virtual void writeMetrics(Utils::PrometheusWriter& metrics) const;
+
 public:
     /**
      * @brief If any, poll input event inside queue. If queue is empty, wait until input event is triggered.
@@ -523,6 +904,20 @@ public:
      */
     Core::AnyInputEvent waitForInput() final;
 
+    /**
+     * @brief Synchronizes clients with messages queued since previous call, then retrieves every queued input event
+     * within given count. If queue is empty, waits until input event is triggered as `waitForInput()` does.
+     *
+     * Clients are synchronized at each call, so messages queued while a batch is handled are flushed once for the
+     * whole batch, and clients aren't starved if input events are triggered faster than they're handled.
+     *
+     * @param input_events Cleared then filled with retrieved events in the order they were triggered, at least one
+     * @param max_count Maximum count of events to retrieve
+     *
+     * @throws std::invalid_argument if `max_count` is 0
+     */
+    void waitForInputs(std::vector<Core::AnyInputEvent>& input_events, std::size_t max_count) final;
+
     /**
      * @brief Unregisters actor using given UID, emits input event for player disconnection and syncs clients about
      * player disconnection sending appropriate messages
@@ -550,6 +945,104 @@ public:
      * @param event Service Event command formatted as SER command (see `Core::ServiceEventRequestProtocol`)
      */
     void outputEvent(const std::string &event) final;
+
+    /**
+     * @brief Connects new client running inside server process, alive and unregistered
+     *
+     * @returns Token for in-process client
+     */
+    std::uint64_t connectInProcess();
+
+    /**
+     * @brief Registers actor for given in-process client, as `LOGIN` command would, then pushes triggered input event
+     *
+     * @param client_token Token for in-process client
+     * @param actor_uid New actor UID
+     * @param actor_name New actor name
+     *
+     * @throws UnknownClientToken if no client is connected using given token
+     * @throws NotInProcessClient if client is connected by implementation
+     * @throws BadClientMessage if client is already registered
+     * @throws InternalError if client isn't alive, or if actor UID or name is unavailable
+     */
+    void loginInProcess(std::uint64_t client_token, std::uint64_t actor_uid, std::string actor_name);
+
+    /**
+     * @brief Pushes Service Request input event for given in-process client actor, as `SERVICE` command would
+     *
+     * @param client_token Token for in-process client
+     * @param sr_command Service Request command (see `Core::ServiceEventRequestProtocol`)
+     *
+     * @throws UnknownClientToken if no client is connected using given token
+     * @throws NotInProcessClient if client is connected by implementation
+     * @throws BadClientMessage if client isn't registered
+     */
+    void requestInProcess(std::uint64_t client_token, std::string sr_command);
+
+    /**
+     * @brief Unregisters given in-process client actor, as `LOGOUT` command would, then pushes triggered input event
+     *
+     * Client is no longer alive, it must still be disconnected.
+     *
+     * @param client_token Token for in-process client
+     *
+     * @throws UnknownClientToken if no client is connected using given token
+     * @throws NotInProcessClient if client is connected by implementation
+     * @throws BadClientMessage if client isn't registered
+     */
+    void logoutInProcess(std::uint64_t client_token);
+
+    /**
+     * @brief Flushes messages queued for given in-process client, as implementation would send them
+     *
+     * Same message might be shared with other clients queues, so messages aren't copied. Messages are never
+     * batched.
+     *
+     * @param client_token Token for in-process client
+     *
+     * @returns Messages queued since previous call, in queuing order
+     *
+     * @throws UnknownClientToken if no client is connected using given token
+     * @throws NotInProcessClient if client is connected by implementation
+     */
+    std::queue<std::shared_ptr<std::string>> pollInProcessMessages(std::uint64_t client_token);
+
+    /**
+     * @brief Removes given in-process client, actor being disconnected without error if it is still registered
+     *
+     * @param client_token Token for in-process client, will be available after method call
+     *
+     * @throws UnknownClientToken if no client is connected using given token
+     * @throws NotInProcessClient if client is connected by implementation
+     */
+    void disconnectInProcess(std::uint64_t client_token);
+
+    /**
+     * @brief Gets how many messages were received from clients connected by implementation, for each RPTL command
+     *
+     * @returns Counters for inbound messages
+     */
+    const InboundMessagesCounters& inboundMessagesCounters() const;
+
+    /**
+     * @brief Formats every metric written by `writeMetrics()`
+     *
+     * @returns Metrics using Prometheus text exposition format
+     */
+    std::string formatMetrics() const;
+
+    /**
+     * @brief Serves metrics formatted by `formatMetrics()` over HTTP on given local endpoint, from the thread calling
+     * `waitForInput()`
+     *
+     * Default implementation throws, as there isn't any IO context to serve metrics from.
+     *
+     * @param local_endpoint Endpoint to listen on for metrics scrapes
+     *
+     * @throws std::logic_error if implementation cannot expose metrics
+     * @throws boost::system::system_error if listening socket cannot be opened
+     */
+    virtual void exposeMetrics(const boost::asio::ip::tcp::endpoint& local_endpoint);
 };
 
 
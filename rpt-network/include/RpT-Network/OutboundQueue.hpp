@@ -0,0 +1,164 @@
+#ifndef RPTOGETHER_SERVER_OUTBOUNDQUEUE_HPP
+#define RPTOGETHER_SERVER_OUTBOUNDQUEUE_HPP
+
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <string>
+
+/**
+ * @file OutboundQueue.hpp
+ */
+
+
+namespace RpT::Network {
+
+
+/**
+ * @brief Policy applied to a client which outbound queue exceeds configured limits
+ */
+enum struct SlowClientPolicy {
+    /// Client is killed, its pending messages are discarded
+    Disconnect,
+    /// Oldest droppable messages are discarded until limits are respected, client is killed if not possible
+    DropOldest,
+    /// Droppable messages are no longer queued for client until it has been caught up with every queued message
+    Pause
+};
+
+
+/**
+ * @brief Limits for each client outbound queue, and policy applied for clients exceeding them
+ *
+ * A limit of 0 means no limit at all.
+ */
+struct OutboundQueueLimits {
+    std::size_t maxMessages { 0 };
+    std::size_t maxBytes { 0 };
+    SlowClientPolicy policy { SlowClientPolicy::Disconnect };
+};
+
+
+/**
+ * @brief How many times slow client policies fired, for all clients
+ */
+struct SlowClientCounters {
+    /// Clients killed because of limits exceeded
+    std::uint64_t disconnections { 0 };
+    /// Messages discarded, either dropped by `SlowClientPolicy::DropOldest` or not queued for a paused client
+    std::uint64_t droppedMessages { 0 };
+    /// Clients paused by `SlowClientPolicy::Pause`
+    std::uint64_t pauses { 0 };
+};
+
+
+/**
+ * @brief Messages queue waiting to be sent to a client, bounded by given limits
+ *
+ * Queue front message is the one currently being sent, if queue isn't empty. As it might be used by a pending IO
+ * operation, this message is never discarded by slow client policies.
+ *
+ * Only messages pushed as droppable might be discarded without client disconnection: messages which would let
+ * client state diverge from server state if missed (like RPTL actors list updates or SRR) mustn't be droppable. As a
+ * consequence, a paused client queue can still grow with non-droppable messages.
+ *
+ * @author ThisALV, https://github.com/ThisALV
+ */
+class OutboundQueue {
+private:
+    /// Queued message, with droppable or not property
+    struct QueuedMessage {
+        std::shared_ptr<std::string> data;
+        bool droppable;
+    };
+
+    std::deque<QueuedMessage> messages_;
+    std::size_t bytes_count_;
+    bool paused_;
+
+    /// Checks if any of given limits is exceeded by current queue content
+    bool exceeds(const OutboundQueueLimits& limits) const;
+
+    /// Discards oldest droppable message, front excepted, returns `false` if there isn't any to discard
+    bool dropOldest();
+
+public:
+    /**
+     * @brief Constructs empty queue, not paused
+     */
+    OutboundQueue();
+
+    /**
+     * @brief Checks if there is any message to send
+     *
+     * @returns `true` if queue is empty, `false` otherwise
+     */
+    bool empty() const;
+
+    /**
+     * @brief Gets count of queued messages
+     *
+     * @returns Count of queued messages, including the one being sent
+     */
+    std::size_t size() const;
+
+    /**
+     * @brief Gets total size of queued messages
+     *
+     * @returns Sum of queued messages size in bytes, including the one being sent
+     */
+    std::size_t bytes() const;
+
+    /**
+     * @brief Checks if client was paused by `SlowClientPolicy::Pause`
+     *
+     * @returns `true` if droppable messages are currently discarded, `false` otherwise
+     */
+    bool paused() const;
+
+    /**
+     * @brief Gets message to send next, or being sent
+     *
+     * @returns Queue front message
+     */
+    const std::shared_ptr<std::string>& front() const;
+
+    /**
+     * @brief Removes front message after it has been sent, resuming client if paused and queue is now empty
+     */
+    void pop();
+
+    /**
+     * @brief Discards every message except front one, as it might be currently sent
+     */
+    void discardPending();
+
+    /**
+     * @brief Queues given message then applies slow client policy if limits are exceeded
+     *
+     * @param message Message to queue
+     * @param droppable Can message be discarded without desyncing client state
+     * @param limits Limits and policy to enforce
+     * @param counters Counters to increment for each time policy fires
+     *
+     * @returns `true` if client must be disconnected, `false` otherwise
+     */
+    bool push(std::shared_ptr<std::string> message, bool droppable, const OutboundQueueLimits& limits,
+              SlowClientCounters& counters);
+
+    /**
+     * @brief Queues given message for a client which is already killed, without enforcing any limit
+     *
+     * Client is already being disconnected, so its last messages (like the INTERRUPT command explaining why) must be
+     * sent even if queue was trimmed because limits were exceeded, and no policy must fire again.
+     *
+     * @param message Message to queue
+     */
+    void pushFinal(std::shared_ptr<std::string> message);
+};
+
+
+}
+
+
+#endif //RPTOGETHER_SERVER_OUTBOUNDQUEUE_HPP
@@ -3,6 +3,7 @@
 
 #include <boost/beast/ssl.hpp>
 #include <RpT-Network/BeastWebsocketBackendBase.inl>
+#include <RpT-Network/TlsSessionResumption.hpp>
 
 /**
  * @file SafeBeastWebsocketBackend.hpp
@@ -15,24 +16,34 @@ namespace RpT::Network {
 /**
  * @brief Implementation for secure HTTPS using SSL TCP underlying stream
  *
+ * Reconnecting clients can resume their previous TLS session instead of performing a full handshake, as configured
+ * by `TlsSessionOptions`.
+ *
  * @author ThisALV, https://github.com/ThisALV
  */
 class SafeBeastWebsocketBackend : public BeastWebsocketBackendBase<boost::beast::ssl_stream<boost::beast::tcp_stream>> {
 private:
     // Context providing crypto TLS features
     boost::asio::ssl::context tls_context_;
+    // Sessions cache and tickets keys for context, must be destroyed before context
+    TlsSessionResumption tls_session_resumption_;
+    // How many TLS handshakes resumed a session
+    TlsSessionCounters tls_session_counters_;
 
-    /// Takes Websocket stream from `openWebsocketStream()` implementation to call `openSafeWebsocketLayer()` with open
+    /// Takes Websocket stream from `openClientStream()` implementation to call `openSafeWebsocketLayer()` with open
     /// SSL layer
-    void openSecureLayer(WebsocketStream new_client_stream);
+    void openSecureLayer(ClientStream new_client_stream);
 
     /// Takes Websocket stream from `openSecureLayer()` to call `addClientStream()` with open WSS layer
-    void openSafeWebsocketLayer(WebsocketStream new_client_stream);
+    void openSafeWebsocketLayer(ClientStream new_client_stream);
 
 protected:
     /// Takes base TCP socket to build TCP stream, then build SSL stream using TLS features and uses it to open
     /// Websocket stream
-    void openWebsocketStream(boost::asio::ip::tcp::socket new_client_connection) final;
+    void openClientStream(boost::asio::ip::tcp::socket new_client_connection) final;
+
+    /// Writes base backend metrics, then TLS sessions resumption family
+    void writeMetrics(Utils::PrometheusWriter& metrics) const final;
 
 public:
     /**
@@ -42,12 +53,31 @@ public:
      * @param private_key_file Path to PEM private key file
      * @param local_endpoint Local server endpoint to be listening on
      * @param logging_context Context providing logging features
+     * @param io_threads_count Number of threads running clients IO operations, see `BeastWebsocketBackendBase`
+     * @param outbound_limits Limits for clients sending queues, see `BeastWebsocketBackendBase`
+     * @param deflate Websocket permessage-deflate extension options, see `BeastWebsocketBackendBase`
+     * @param tls_sessions TLS sessions resumption options
+     * @param handshakes Handshake threads and pending handshakes limit, see `BeastWebsocketBackendBase`
+     * @param accept Listening sockets and pending accept operations, see `BeastWebsocketBackendBase`
+     * @param timeouts Handshake, idle and close timeouts, handshake timeout also applies to TLS handshake
      *
-     * @throws boost::system::system_error Error thrown by TLS features initialization
+     * @throws boost::system::system_error Error thrown by TLS features initialization or listening sockets opening
+     * @throws std::invalid_argument if deflate options, accept options, timeouts or TLS sessions options are invalid
      */
     SafeBeastWebsocketBackend(const std::string& certificate_file, const std::string& private_key_file,
                               const boost::asio::ip::tcp::endpoint& local_endpoint,
-                              Utils::LoggingContext& logging_context);
+                              Utils::LoggingContext& logging_context, std::size_t io_threads_count = 0,
+                              const OutboundQueueLimits& outbound_limits = {},
+                              const DeflateOptions& deflate = {}, const TlsSessionOptions& tls_sessions = {},
+                              const HandshakeOptions& handshakes = {}, const AcceptOptions& accept = {},
+                              const TimeoutOptions& timeouts = {});
+
+    /**
+     * @brief Gets how many TLS handshakes resumed a session since backend construction
+     *
+     * @returns Counters for TLS sessions resumption
+     */
+    const TlsSessionCounters& tlsSessionCounters() const;
 };
 
 
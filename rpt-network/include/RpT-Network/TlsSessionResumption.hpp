@@ -0,0 +1,126 @@
+#ifndef RPTOGETHER_SERVER_TLSSESSIONRESUMPTION_HPP
+#define RPTOGETHER_SERVER_TLSSESSIONRESUMPTION_HPP
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <boost/asio/ssl/context.hpp>
+#include <openssl/ssl.h>
+
+/**
+ * @file TlsSessionResumption.hpp
+ */
+
+
+namespace RpT::Network {
+
+
+/**
+ * @brief Options for TLS sessions resumption, so reconnecting clients don't perform a full handshake
+ */
+struct TlsSessionOptions {
+    /// Are sessions resumable, using both server-side sessions cache and session tickets
+    bool enabled { true };
+    /// How long a session can be resumed after its full handshake
+    std::chrono::seconds lifetime { 7200 };
+    /// Maximum count of sessions inside server-side cache, used by clients which don't support tickets
+    std::size_t cacheSize { 20480 };
+    /// Delay before session tickets encryption key is replaced, previous key still decrypts tickets for this delay
+    std::chrono::seconds ticketKeysRotation { 3600 };
+};
+
+
+/**
+ * @brief How many handshakes resumed a previous session or not
+ */
+struct TlsSessionCounters {
+    /// Handshakes which resumed a session, either from cache or from ticket
+    std::uint64_t hits { 0 };
+    /// Full handshakes, session wasn't provided by client, was expired or unknown
+    std::uint64_t misses { 0 };
+};
+
+
+/**
+ * @brief Configures sessions resumption for given TLS server context, and provides rotating session tickets keys
+ *
+ * Tickets are encrypted with AES-256-CBC and authenticated with HMAC-SHA256, using a random key replaced at each
+ * rotation period. Previous key is kept for another rotation period, so tickets issued just before rotation can
+ * still be used, then renewed with current key.
+ *
+ * As handshakes might be ran concurrently by IO threads, tickets keys are accessed under mutual exclusion. Instance
+ * must outlive every handshake done with configured context, it is unregistered from context when destroyed.
+ *
+ * @author ThisALV, https://github.com/ThisALV
+ */
+class TlsSessionResumption {
+private:
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+    using TicketMacContext = EVP_MAC_CTX;
+#else
+    using TicketMacContext = HMAC_CTX;
+#endif
+
+    /// Secrets protecting session tickets, identified by a random name sent inside each ticket
+    struct TicketKey {
+        std::array<unsigned char, 16> name;
+        std::array<unsigned char, 32> hmacSecret;
+        std::array<unsigned char, 32> aesKey;
+        std::chrono::steady_clock::time_point creation;
+    };
+
+    SSL_CTX* tls_context_;
+    const std::chrono::seconds rotation_period_;
+    // Tickets callback might be called concurrently from IO threads
+    std::mutex ticket_keys_mutex_;
+    TicketKey current_key_;
+    std::optional<TicketKey> previous_key_;
+
+    /// Index for context extra data pointing to instance, allocated once for all contexts
+    static int contextDataIndex();
+
+    /// Generates new random key, throws `std::runtime_error` if random generator failed
+    static TicketKey generateKey();
+
+    /// Sets given key HMAC secret for given tickets MAC context, returns `false` if it failed
+    static bool initMac(TicketMacContext* mac_context, const TicketKey& key);
+
+    /// Called by OpenSSL to encrypt a new ticket, or to decrypt a ticket provided by client
+    static int handleTicketKey(SSL* tls_session, unsigned char* key_name, unsigned char* iv,
+                               EVP_CIPHER_CTX* cipher_context, TicketMacContext* mac_context, int encrypt);
+
+    /// Replaces current key if rotation period expired, must be called with tickets keys locked
+    void rotateKeys();
+
+public:
+    /**
+     * @brief Configures sessions cache, sessions lifetime and tickets for given context
+     *
+     * If resumption is disabled, both sessions cache and tickets are disabled for context.
+     *
+     * @param tls_context TLS server context to configure, must outlive constructed instance
+     * @param options Sessions resumption options
+     *
+     * @throws std::invalid_argument if sessions lifetime or tickets keys rotation period isn't positive
+     * @throws std::runtime_error if first tickets key cannot be generated
+     */
+    TlsSessionResumption(boost::asio::ssl::context& tls_context, const TlsSessionOptions& options);
+
+    /**
+     * @brief Unregisters instance from configured context, so no ticket can be issued or resumed after that
+     */
+    ~TlsSessionResumption();
+
+    // Context keeps pointer to instance, so it cannot be copied nor moved
+
+    TlsSessionResumption(const TlsSessionResumption&) = delete;
+    TlsSessionResumption& operator=(const TlsSessionResumption&) = delete;
+};
+
+
+}
+
+
+#endif //RPTOGETHER_SERVER_TLSSESSIONRESUMPTION_HPP
@@ -0,0 +1,63 @@
+#ifndef RPTOGETHER_SERVER_UNIXLENGTHPREFIXEDBACKEND_HPP
+#define RPTOGETHER_SERVER_UNIXLENGTHPREFIXEDBACKEND_HPP
+
+#include <RpT-Network/BeastWebsocketBackendBase.inl>
+#include <RpT-Network/LengthPrefixedStream.hpp>
+
+/**
+ * @file UnixLengthPrefixedBackend.hpp
+ */
+
+
+#if RPT_RUNTIME_PLATFORM == RPT_RUNTIME_UNIX // Unix domain sockets aren't available for other platforms
+
+
+namespace RpT::Network {
+
+
+/**
+ * @brief `BeastWebsocketBackendBase` implementation exchanging length-prefixed RPTL messages over a Unix domain socket
+ *
+ * Intended for a sidecar on the same host terminating TLS and Websocket, then forwarding each message with the same
+ * framing than `LengthPrefixedTcpBackend`. Neither TCP/IP stack nor Websocket framing is involved, so it is the
+ * cheapest way for local clients to reach server. Anyone allowed to connect to socket file by its permissions is
+ * trusted.
+ *
+ * Like `LengthPrefixedTcpBackend`, idle timeout is disabled by default as there is no ping message.
+ *
+ * @author ThisALV, https://github.com/ThisALV
+ */
+class UnixLengthPrefixedBackend
+        : public BeastWebsocketBackendBase<UnixStream, LengthPrefixedStream<UnixStream>> {
+protected:
+    /// Implementation takes base local socket to build length-prefixed stream, then immediately adds it
+    void openClientStream(boost::asio::local::stream_protocol::socket new_client_connection) final;
+
+public:
+    /**
+     * @brief Calls superclass constructor without any Websocket or handshake option, with only one acceptor allowed
+     *
+     * @param local_endpoint Path for socket file to be listening on
+     * @param logging_context Context providing logging features
+     * @param io_threads_count Number of threads running clients IO operations, see `BeastWebsocketBackendBase`
+     * @param outbound_limits Limits for clients sending queues, see `BeastWebsocketBackendBase`
+     * @param accept Pending accept operations, acceptors count must be 1
+     * @param timeouts Idle and close timeouts, handshake timeout is ignored, idle timeout disabled by default
+     *
+     * @throws boost::system::system_error if socket file cannot be listened on
+     * @throws std::invalid_argument if accept options or timeouts are invalid
+     */
+    UnixLengthPrefixedBackend(const boost::asio::local::stream_protocol::endpoint& local_endpoint,
+                              Utils::LoggingContext& logging_context, std::size_t io_threads_count = 0,
+                              const OutboundQueueLimits& outbound_limits = {}, const AcceptOptions& accept = {},
+                              const TimeoutOptions& timeouts = lengthPrefixedTimeouts());
+};
+
+
+}
+
+
+#endif
+
+
+#endif //RPTOGETHER_SERVER_UNIXLENGTHPREFIXEDBACKEND_HPP
@@ -0,0 +1,61 @@
+#ifndef RPTOGETHER_SERVER_UNIXWEBSOCKETBACKEND_HPP
+#define RPTOGETHER_SERVER_UNIXWEBSOCKETBACKEND_HPP
+
+#include <RpT-Network/BeastWebsocketBackendBase.inl>
+
+/**
+ * @file UnixWebsocketBackend.hpp
+ */
+
+
+#if RPT_RUNTIME_PLATFORM == RPT_RUNTIME_UNIX // Unix domain sockets aren't available for other platforms
+
+
+namespace RpT::Network {
+
+
+/**
+ * @brief `BeastWebsocketBackendBase` implementation for Websocket clients connecting over a Unix domain socket
+ *
+ * Intended for a sidecar on the same host terminating TLS then forwarding Websocket connections, so messages don't go
+ * through loopback TCP. Anyone allowed to connect to socket file by its permissions is trusted, as for unsafe
+ * Websocket backend.
+ *
+ * @author ThisALV, https://github.com/ThisALV
+ */
+class UnixWebsocketBackend : public BeastWebsocketBackendBase<UnixStream> {
+protected:
+    /// Implementation takes base local socket to build Unix stream then uses it raw to build Websocket stream
+    void openClientStream(boost::asio::local::stream_protocol::socket new_client_connection) final;
+
+public:
+    /**
+     * @brief Calls superclass constructor, with only one acceptor allowed
+     *
+     * @param local_endpoint Path for socket file to be listening on
+     * @param logging_context Context providing logging features
+     * @param io_threads_count Number of threads running clients IO operations, see `BeastWebsocketBackendBase`
+     * @param outbound_limits Limits for clients sending queues, see `BeastWebsocketBackendBase`
+     * @param deflate Websocket permessage-deflate extension options, see `BeastWebsocketBackendBase`
+     * @param handshakes Handshake threads and pending handshakes limit, see `BeastWebsocketBackendBase`
+     * @param accept Pending accept operations, acceptors count must be 1
+     * @param timeouts Handshake, idle and close timeouts, see `BeastWebsocketBackendBase`
+     *
+     * @throws boost::system::system_error if socket file cannot be listened on
+     * @throws std::invalid_argument if options are invalid
+     */
+    UnixWebsocketBackend(const boost::asio::local::stream_protocol::endpoint& local_endpoint,
+                         Utils::LoggingContext& logging_context, std::size_t io_threads_count = 0,
+                         const OutboundQueueLimits& outbound_limits = {}, const DeflateOptions& deflate = {},
+                         const HandshakeOptions& handshakes = {}, const AcceptOptions& accept = {},
+                         const TimeoutOptions& timeouts = {});
+};
+
+
+}
+
+
+#endif
+
+
+#endif //RPTOGETHER_SERVER_UNIXWEBSOCKETBACKEND_HPP
@@ -19,12 +19,15 @@ namespace RpT::Network {
 class UnsafeBeastWebsocketBackend : public BeastWebsocketBackendBase<boost::beast::tcp_stream> {
 protected:
     /// Implementation takes base TCP socket to build TCP stream then uses it raw to build Websocket stream
-    void openWebsocketStream(boost::asio::ip::tcp::socket new_client_connection) final;
+    void openClientStream(boost::asio::ip::tcp::socket new_client_connection) final;
 
 public:
     /// Calls superclass constructor
     UnsafeBeastWebsocketBackend(const boost::asio::ip::tcp::endpoint& local_endpoint,
-                                Utils::LoggingContext& logging_context);
+                                Utils::LoggingContext& logging_context, std::size_t io_threads_count = 0,
+                                const OutboundQueueLimits& outbound_limits = {}, const DeflateOptions& deflate = {},
+                                const HandshakeOptions& handshakes = {}, const AcceptOptions& accept = {},
+                                const TimeoutOptions& timeouts = {});
 };
 
 
@@ -0,0 +1,33 @@
+#include <RpT-Network/LengthPrefixedTcpBackend.hpp>
+
+namespace RpT::Network {
+
+
+LengthPrefixedTcpBackend::LengthPrefixedTcpBackend(
+        const boost::asio::ip::tcp::endpoint& local_endpoint, Utils::LoggingContext& logging_context,
+        const std::size_t io_threads_count, const OutboundQueueLimits& outbound_limits, const AcceptOptions& accept,
+        const TimeoutOptions& timeouts)
+        : BeastWebsocketBackendBase<boost::beast::tcp_stream, LengthPrefixedStream<boost::beast::tcp_stream>> {
+    local_endpoint, logging_context, io_threads_count, outbound_limits, {}, {}, accept, timeouts
+} {}
+
+void LengthPrefixedTcpBackend::openClientStream(boost::asio::ip::tcp::socket new_client_connection) {
+    const auto new_client_stream { std::make_shared<ClientStream>(std::move(new_client_connection)) };
+
+    // No handshake to perform, and no operation is pending yet, so stream is established from backend thread
+    const boost::system::error_code err { establishStream(*new_client_stream) };
+    endHandshake(err);
+
+    boost::asio::ip::tcp::socket& underlying_socket { new_client_stream->next_layer().socket() };
+
+    if (err) {
+        getLogger().error("Opening stream with {}: {}", endpointFor(underlying_socket), err.message());
+
+        return;
+    }
+
+    addClientStream(underlying_socket, new_client_stream);
+}
+
+
+}
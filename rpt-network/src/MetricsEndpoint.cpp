@@ -0,0 +1,153 @@
+#include <RpT-Network/MetricsEndpoint.hpp>
+
+#include <memory>
+#include <string_view>
+#include <boost/beast/core/flat_buffer.hpp>
+#include <boost/beast/core/tcp_stream.hpp>
+#include <boost/beast/http.hpp>
+
+
+namespace RpT::Network {
+
+
+class MetricsEndpoint::Session : public std::enable_shared_from_this<Session> {
+private:
+    /// Path metrics are served on, query string excluded
+    static constexpr std::string_view METRICS_TARGET { "/metrics" };
+    /// Content type for Prometheus text exposition format
+    static constexpr std::string_view METRICS_CONTENT_TYPE { "text/plain; version=0.0.4; charset=utf-8" };
+
+    MetricsEndpoint& endpoint_;
+    boost::beast::tcp_stream stream_;
+    // Reused for each request received from scraper
+    boost::beast::flat_buffer buffer_;
+    boost::beast::http::request<boost::beast::http::empty_body> request_;
+    // Kept alive until it has been written
+    boost::beast::http::response<boost::beast::http::string_body> response_;
+
+    /// Prepares response for current request, metrics are formatted only if request is a valid scrape
+    void respond() {
+        using boost::beast::http::status;
+
+        const std::string_view target { request_.target().data(), request_.target().size() };
+        const std::string_view path { target.substr(0, target.find('?')) };
+
+        response_ = {};
+        response_.version(request_.version());
+        response_.keep_alive(request_.keep_alive());
+        response_.set(boost::beast::http::field::content_type, METRICS_CONTENT_TYPE.data());
+
+        if (path != METRICS_TARGET) {
+            response_.result(status::not_found);
+            response_.body() = "Metrics are served on " + std::string { METRICS_TARGET } + '\n';
+        } else if (request_.method() != boost::beast::http::verb::get) {
+            response_.result(status::method_not_allowed);
+            response_.set(boost::beast::http::field::allow, "GET");
+            response_.body() = "Metrics can only be retrieved with GET\n";
+        } else {
+            response_.result(status::ok);
+            response_.body() = endpoint_.metrics_formatter_();
+        }
+
+        response_.prepare_payload();
+    }
+
+    /// Writes response for current request, then reads next request if connection is kept alive
+    void writeResponse() {
+        stream_.expires_after(SCRAPE_TIMEOUT);
+
+        boost::beast::http::async_write(stream_, response_, [self { shared_from_this() }](
+                const boost::system::error_code& err, std::size_t) {
+
+            if (err) { // Scraper will retry at next scrape interval
+                self->endpoint_.logger_.debug("Unable to send metrics: {}", err.message());
+                return;
+            }
+
+            if (self->response_.keep_alive())
+                self->readRequest();
+            else
+                self->close();
+        });
+    }
+
+    /// Gracefully closes connection with scraper
+    void close() {
+        boost::system::error_code ignored_err; // Connection is dropped anyway
+        stream_.socket().shutdown(boost::asio::ip::tcp::socket::shutdown_send, ignored_err);
+    }
+
+public:
+    /**
+     * @brief Constructs session for given accepted scraper connection
+     *
+     * @param endpoint Endpoint which accepted connection
+     * @param connection Scraper connection
+     */
+    Session(MetricsEndpoint& endpoint, boost::asio::ip::tcp::socket connection)
+    : endpoint_ { endpoint }, stream_ { std::move(connection) } {}
+
+    /// Reads next request from scraper, then responds to it
+    void readRequest() {
+        request_ = {};
+        stream_.expires_after(SCRAPE_TIMEOUT);
+
+        boost::beast::http::async_read(stream_, buffer_, request_, [self { shared_from_this() }](
+                const boost::system::error_code& err, std::size_t) {
+
+            if (err == boost::beast::http::error::end_of_stream) { // Scraper closed kept alive connection
+                self->close();
+                return;
+            }
+
+            if (err) {
+                if (err != boost::asio::error::operation_aborted) // Silent if server was stopped
+                    self->endpoint_.logger_.debug("Unable to read scrape request: {}", err.message());
+
+                return;
+            }
+
+            self->respond();
+            self->writeResponse();
+        });
+    }
+};
+
+
+void MetricsEndpoint::waitNextScraper() {
+    acceptor_.async_accept([this](const boost::system::error_code& err, boost::asio::ip::tcp::socket connection) {
+        if (err == boost::asio::error::operation_aborted) // Ignores if endpoint was closed
+            return;
+
+        if (err)
+            logger_.error("Unable to accept scraper connection: {}", err.message());
+        else
+            std::make_shared<Session>(*this, std::move(connection))->readRequest();
+
+        waitNextScraper();
+    });
+}
+
+MetricsEndpoint::MetricsEndpoint(boost::asio::io_context& io_context,
+                                 const boost::asio::ip::tcp::endpoint& local_endpoint,
+                                 std::function<std::string()> metrics_formatter, Utils::LoggerView logger)
+: logger_ { std::move(logger) }, metrics_formatter_ { std::move(metrics_formatter) },
+acceptor_ { io_context, local_endpoint } {
+
+    logger_.info("Metrics exposed on {}:{}.", acceptor_.local_endpoint().address().to_string(),
+                 acceptor_.local_endpoint().port());
+
+    waitNextScraper();
+}
+
+boost::asio::ip::tcp::endpoint MetricsEndpoint::localEndpoint() const {
+    return acceptor_.local_endpoint();
+}
+
+void MetricsEndpoint::close() {
+    boost::system::error_code ignored_err; // Server is stopping anyway
+    acceptor_.close(ignored_err);
+}
+
+
+}
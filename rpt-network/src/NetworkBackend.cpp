@@ -2,6 +2,7 @@
 
 #include <algorithm>
 #include <cassert>
+#include <charconv>
 
 
 namespace RpT::Network {
@@ -28,8 +29,22 @@ NetworkBackend::HandshakeParser::HandshakeParser(const NetworkBackend::RptlComma
 
     assert(parsed_rptl_command.isHandshake()); // Parsed handshake must be an handshake command
 
-    if (!unparsedWords().empty()) // Checks for syntax, there must NOT be any remaining argument
-        throw TooManyArguments { HANDSHAKE_COMMAND };
+    batched_messages_ = false;
+    binary_messages_ = false;
+
+    // Checks for syntax, only optional remaining arguments are batched messages and binary encoding flags
+    std::string_view flags { unparsedWords() };
+    while (!flags.empty()) {
+        const std::size_t flag_end { std::min(flags.find(' '), flags.size()) };
+        const std::string_view flag { flags.substr(0, flag_end) };
+
+        bool& flag_enabled { flag == BATCH_COMMAND ? batched_messages_ : binary_messages_ };
+        if ((flag != BATCH_COMMAND && flag != BINARY_FLAG) || flag_enabled)
+            throw TooManyArguments { HANDSHAKE_COMMAND };
+
+        flag_enabled = true;
+        flags.remove_prefix(std::min(flag_end + 1, flags.size())); // Skips separator after flag, if any
+    }
 
     try {
         const std::string actor_uid_copy { getParsedWord(0) }; // Required for conversion to unsigned integer
@@ -50,6 +65,14 @@ std::string_view NetworkBackend::HandshakeParser::actorName() const {
     return getParsedWord(1);
 }
 
+bool NetworkBackend::HandshakeParser::batchedMessages() const {
+    return batched_messages_;
+}
+
+bool NetworkBackend::HandshakeParser::binaryMessages() const {
+    return binary_messages_;
+}
+
 
 NetworkBackend::ServiceCommandParser::ServiceCommandParser(
         const NetworkBackend::RptlCommandParser& parsed_rptl_command)
@@ -63,8 +86,59 @@ std::string_view NetworkBackend::ServiceCommandParser::serviceRequest() const {
 }
 
 
+NetworkBackend::BinaryMessageReader::BinaryMessageReader(const std::string_view binary_message)
+: remaining_ { binary_message } {}
+
+std::uint64_t NetworkBackend::BinaryMessageReader::readVarint() {
+    std::uint64_t value { 0 };
+
+    // Each byte gives 7 bits, lowest first, and has its highest bit set if another byte follows
+    for (unsigned int shift { 0 }; shift < 64; shift += 7) {
+        const std::uint8_t next_byte { readByte() };
+        const std::uint64_t next_bits { next_byte & 0x7fu };
+
+        // Last byte of a 64 bits integer only has 1 significant bit
+        if (shift == 63 && next_bits > 1)
+            throw BadClientMessage { "Binary varint overflows 64 bits" };
+
+        value |= next_bits << shift;
+
+        if ((next_byte & 0x80u) == 0)
+            return value;
+    }
+
+    throw BadClientMessage { "Binary varint overflows 64 bits" };
+}
+
+std::uint8_t NetworkBackend::BinaryMessageReader::readByte() {
+    if (remaining_.empty())
+        throw BadClientMessage { "Binary message truncated" };
+
+    const auto next_byte { static_cast<std::uint8_t>(remaining_.front()) };
+    remaining_.remove_prefix(1);
+
+    return next_byte;
+}
+
+std::string_view NetworkBackend::BinaryMessageReader::readString() {
+    const std::uint64_t size { readVarint() };
+    if (size > remaining_.size())
+        throw BadClientMessage { "Binary message truncated" };
+
+    const std::string_view value { remaining_.substr(0, size) };
+    remaining_.remove_prefix(size);
+
+    return value;
+}
+
+void NetworkBackend::BinaryMessageReader::checkEnd(const std::string_view command) const {
+    if (!remaining_.empty())
+        throw TooManyArguments { command };
+}
+
+
 Core::JoinedEvent NetworkBackend::handleHandshake(const std::uint64_t client_token,
-                                                  const std::string& message_handshake) {
+                                                  const std::string_view message_handshake) {
 
     try { // Tries to parse received RPTL command, will fail if command is empty
         const RptlCommandParser command_parser { message_handshake };
@@ -73,46 +147,24 @@ Core::JoinedEvent NetworkBackend::handleHandshake(const std::uint64_t client_tok
             throw BadClientMessage { "Invoked command for connection handshaking must be \"HANDSHAKE\"" };
 
         const HandshakeParser handshake_parser { command_parser };
-        const std::uint64_t new_actor_uid { handshake_parser.actorUID() };
 
-        if (isRegistered(new_actor_uid)) // Checks if new actor UID is available
-            throw InternalError { "Player UID \"" + std::to_string(new_actor_uid) + "\" is not available" };
+        Core::JoinedEvent registration {
+            login(client_token, handshake_parser.actorUID(), std::string { handshake_parser.actorName() })
+        };
 
-        std::string new_actor_name { handshake_parser.actorName() };
+        ClientStatus& client_status { connected_clients_.at(client_token).status };
+        // Client messages will be gathered at synchronization if it asked for it
+        client_status.batchedMessages = handshake_parser.batchedMessages();
+        client_status.binaryMessages = handshake_parser.binaryMessages();
 
-        try { // Tries to register actor, implementation registration may fail
-            registerActor(client_token, new_actor_uid, new_actor_name);
-
-            // If registration hasn't been done at this point, this is an implementation error
-            assert(isRegistered(new_actor_uid));
-
-            // Client must be synced about its own registration
-            privateMessage(client_token, formatRegistrationMessage());
-
-            // Formats message to notify actors that player joined server
-            std::string logged_in_message {
-                    std::string { LOGGED_IN_COMMAND }
-                    + ' ' + std::to_string(new_actor_uid) + ' ' + new_actor_name
-            };
-            // All players should be aware about new registered player
-            broadcastMessage(std::move(logged_in_message));
-        } catch (const std::exception& err) { // It it fails, then registration must NOT have been done
-            // If registration is still active at this point, this is an implementation error and server must stop
-            assert(!isRegistered(new_actor_uid));
-
-            // Handshaking is valid, but server is currently unable to register actor
-            throw InternalError { err.what() };
-        }
-
-        // Returns event triggered by actor registration, takes reference to actor's name, no copy done on string
-        return Core::JoinedEvent { new_actor_uid, std::move(new_actor_name) };
+        return registration;
     } catch (const Utils::NotEnoughWords&) { // If command is empty, unable to parse invoked command name
         throw EmptyRptlCommand {};
     }
 }
 
 Core::AnyInputEvent RpT::Network::NetworkBackend::handleRegular(const std::uint64_t client_actor,
-                                                                const std::string& regular_message) {
+                                                                const std::string_view regular_message) {
 
     try { // Tries to parse received RPTL command, will fail if command is empty
         const RptlCommandParser command_parser { regular_message };
@@ -123,31 +175,14 @@ Core::AnyInputEvent RpT::Network::NetworkBackend::handleRegular(const std::uint6
         if (invoked_command_name == SERVICE_COMMAND) {
             const ServiceCommandParser service_command_parser { command_parser }; // Parse specific SERVICE command
 
-            // Copy required to be moved as string inside emitted event
-            std::string sr_command_copy { service_command_parser.serviceRequest() };
-
-            // Returns input event triggered by received Service Request command from given actor with new SR command
-            return Core::ServiceRequestEvent { client_actor, std::move(sr_command_copy) };
+            // No copy, SR command will be copied by events queue when event is pushed
+            return Core::ServiceRequestEvent::borrowing(client_actor, service_command_parser.serviceRequest());
         } else if (invoked_command_name == LOGOUT_COMMAND) {
             if (!command_parser.invokedCommandArgs().empty()) // If any extra arg detected, command call is ill-formed
                 throw TooManyArguments { LOGOUT_COMMAND };
 
-            // Saves token for client owning current actor before it will be unregister
-            const std::uint64_t owner_client { actors_registry_.at(client_actor) };
-
-            unregisterActor(client_actor);
-
-            // If actor is still registered, it is an implementation error
-            assert(!isRegistered(client_actor));
-
-            // Client must be aware it has been logged out properly
-            privateMessage(owner_client, std::string { INTERRUPT_COMMAND });
-            // Players must be notified about current player disconnection
-            broadcastMessage(std::string { LOGGED_OUT_COMMAND } + ' ' + std::to_string(client_actor));
-
-            // Returns input event triggered by player disconnection (or unregistration)
             // RPTL command way disconnection, clean
-            return Core::LeftEvent { client_actor };
+            return logout(client_actor);
         } else { // If none of available commands is being invoked, then invoked command is unknown
             throw BadClientMessage { "Unknown RPTL command: " + std::string { invoked_command_name } };
         }
@@ -156,121 +191,493 @@ Core::AnyInputEvent RpT::Network::NetworkBackend::handleRegular(const std::uint6
     }
 }
 
-Core::AnyInputEvent NetworkBackend::handleMessage(const std::uint64_t client_token, const std::string& client_message) {
-    // RPTL message source potential registered actor
-    const std::optional<Actor> client_actor { connected_clients_.at(client_token).second };
+Core::AnyInputEvent NetworkBackend::handleBinary(const std::uint64_t client_actor,
+                                                const std::string_view binary_message) {
+
+    BinaryMessageReader message_reader { binary_message };
+
+    const std::uint8_t opcode { message_reader.readByte() };
+    if (opcode == BINARY_SERVICE_REQUEST) {
+        const std::uint64_t ruid { message_reader.readVarint() };
+        const std::string_view service_name { message_reader.readString() };
+        const std::string_view command_data { message_reader.readString() };
+        message_reader.checkEnd(SERVICE_COMMAND);
+
+        // SER Protocol will not have to parse anything
+        return Core::ServiceRequestEvent::borrowing(client_actor, ruid, service_name, command_data);
+    } else if (opcode == BINARY_LOGOUT) {
+        message_reader.checkEnd(LOGOUT_COMMAND);
 
-    if (!client_actor.has_value()) // If no actor is registered for RPTL message client
-        return handleHandshake(client_token, client_message);
-    else // If any actor is actually registered for RPTL message client
-        return handleRegular(client_actor->uid, client_message); // Handle command for registered actor
+        return logout(client_actor);
+    } else {
+        throw BadClientMessage { "Unknown binary RPTL opcode: " + std::to_string(opcode) };
+    }
 }
 
-void NetworkBackend::pushInputEvent(Core::AnyInputEvent input_event) {
-    input_events_queue_.push(std::move(input_event)); // Move triggered input event into queue
+Core::JoinedEvent NetworkBackend::login(const std::uint64_t client_token, const std::uint64_t actor_uid,
+                                        std::string actor_name) {
+
+    if (isRegistered(actor_uid)) // Checks if new actor UID is available
+        throw InternalError { "Player UID \"" + std::to_string(actor_uid) + "\" is not available" };
+
+    try { // Tries to register actor, implementation registration may fail
+        registerActor(client_token, actor_uid, actor_name);
+
+        // If registration hasn't been done at this point, this is an implementation error
+        assert(isRegistered(actor_uid));
+
+        // Client must be synced about its own registration, serialized registry copied once into shared message
+        queueMessage(client_token, connected_clients_.at(client_token).remainingMessages,
+                     std::make_shared<std::string>(formatRegistrationMessage()));
+
+        // Formats message to notify actors that player joined server
+        std::string logged_in_message {
+                std::string { LOGGED_IN_COMMAND }
+                + ' ' + std::to_string(actor_uid) + ' ' + actor_name
+        };
+        // All players should be aware about new registered player
+        broadcastMessage(std::move(logged_in_message));
+    } catch (const std::exception& err) { // It it fails, then registration must NOT have been done
+        // If registration is still active at this point, this is an implementation error and server must stop
+        assert(!isRegistered(actor_uid));
+
+        // Handshaking is valid, but server is currently unable to register actor
+        throw InternalError { err.what() };
+    }
+
+    // Returns event triggered by actor registration, takes reference to actor's name, no copy done on string
+    return Core::JoinedEvent { actor_uid, std::move(actor_name) };
 }
 
-std::optional<Core::AnyInputEvent> NetworkBackend::pollInputEvent() {
-    if (input_events_queue_.empty()) // If events queue is empty, returns uninitialized value
+Core::LeftEvent NetworkBackend::logout(const std::uint64_t actor_uid) {
+    // Saves token for client owning current actor before it will be unregister
+    const std::uint64_t owner_client { actors_registry_.at(actor_uid).ownerClient };
+
+    unregisterActor(actor_uid);
+
+    // If actor is still registered, it is an implementation error
+    assert(!isRegistered(actor_uid));
+
+    // Client must be aware it has been logged out properly
+    privateMessage(owner_client, std::string { INTERRUPT_COMMAND });
+    // Players must be notified about current player disconnection
+    broadcastMessage(std::string { LOGGED_OUT_COMMAND } + ' ' + std::to_string(actor_uid));
+
+    // Returns input event triggered by player disconnection (or unregistration)
+    return Core::LeftEvent { actor_uid };
+}
+
+NetworkBackend::Client& NetworkBackend::inProcessClient(const std::uint64_t client_token) {
+    if (!connected_clients_.contains(client_token)) // Checks for client to exist
+        throw UnknownClientToken { client_token };
+
+    Client& client { connected_clients_.at(client_token) };
+
+    if (!client.status.inProcess) // Connection is owned by implementation, it mustn't be driven from here
+        throw NotInProcessClient { client_token };
+
+    return client;
+}
+
+Core::AnyInputEvent NetworkBackend::handleMessage(const std::uint64_t client_token,
+                                                  const std::string_view client_message) {
+
+    const Client& client { connected_clients_.at(client_token) };
+    // RPTL message source potential registered actor, actor UID is copied before it might be unregistered by handling
+    const std::optional<Actor>& client_actor { client.actor };
+
+    try { // Message is counted once it has been handled, whatever command it invoked
+        if (!client_actor.has_value()) { // If no actor is registered for RPTL message client
+            Core::JoinedEvent registration { handleHandshake(client_token, client_message) };
+            inbound_messages_counters_.login++;
+
+            return registration;
+        }
+
+        // Registered actor can only invoke commands triggering a logout or a Service Request
+        Core::AnyInputEvent triggered_event {
+            client.status.binaryMessages && isBinaryMessage(client_message) // Text commands are still available
+            ? handleBinary(client_actor->uid, client_message)
+            : handleRegular(client_actor->uid, client_message) // Handle command for registered actor
+        };
+
+        if (boost::get<Core::LeftEvent>(&triggered_event))
+            inbound_messages_counters_.logout++;
+        else
+            inbound_messages_counters_.service++;
+
+        return triggered_event;
+    } catch (const std::exception&) { // Client will be disconnected by implementation
+        inbound_messages_counters_.rejected++;
+
+        throw;
+    }
+}
+
+void NetworkBackend::pushInputEvent(const Core::AnyInputEvent& input_event) {
+    Core::LatencyTracer* const latency_tracer { latencyTracer() };
+    if (latency_tracer) {
+        const std::optional<Core::LatencyTracer::TraceKey> traced_request { traceKeyOf(input_event) };
+
+        if (traced_request.has_value())
+            latency_tracer->record(traced_request->clientToken, traced_request->ruid, Core::PipelineStage::Queued);
+    }
+
+    input_events_queue_.push(input_event); // Copy triggered input event payload into queue
+}
+
+void NetworkBackend::traceReceived(const std::uint64_t client_token, const Core::AnyInputEvent& input_event,
+                                   const Core::LatencyTracer::Clock::time_point read_at) {
+
+    Core::LatencyTracer* const latency_tracer { latencyTracer() };
+    const auto service_request { boost::get<Core::ServiceRequestEvent>(&input_event) };
+    if (!latency_tracer || !service_request) // Only Service Requests are traced
+        return;
+
+    const std::optional<std::uint64_t> ruid { Core::LatencyTracer::requestUid(*service_request) };
+    if (ruid.has_value())
+        latency_tracer->received(client_token, *ruid, read_at);
+}
+
+std::optional<Core::LatencyTracer::TraceKey> NetworkBackend::traceKeyOf(const Core::AnyInputEvent& input_event) const {
+    const auto service_request { boost::get<Core::ServiceRequestEvent>(&input_event) };
+    if (!service_request)
         return {};
 
-    /*
-     * Else, moves polled event, removes it from queue and retrieves it
-     */
+    // Actor might have been unregistered since request was received
+    const auto actor_entry { actors_registry_.find(service_request->actor()) };
+    if (actor_entry == actors_registry_.end())
+        return {};
+
+    const std::optional<std::uint64_t> ruid { Core::LatencyTracer::requestUid(*service_request) };
+    if (!ruid.has_value())
+        return {};
+
+    return Core::LatencyTracer::TraceKey { actor_entry->second.ownerClient, *ruid };
+}
+
+std::optional<Core::AnyInputEvent> NetworkBackend::pollInputEvent() {
+    while (!input_events_queue_.empty()) {
+        Core::AnyInputEvent polled_event { input_events_queue_.poll() };
 
-    Core::AnyInputEvent polled_event { std::move(input_events_queue_.front()) };
-    input_events_queue_.pop();
+        // Actor might have left or have been kicked since request was received, it can no longer be replied
+        const auto service_request { boost::get<Core::ServiceRequestEvent>(&polled_event) };
+        if (service_request && !isRegistered(service_request->actor()))
+            continue;
 
-    return polled_event;
+        return polled_event;
+    }
+
+    return {}; // If events queue is empty, returns uninitialized value
 }
 
 bool NetworkBackend::inputReady() const {
     return !input_events_queue_.empty();
 }
 
+std::vector<std::uint64_t> NetworkBackend::pollDeadClients() {
+    std::vector<std::uint64_t> dead_clients;
+    dead_clients.swap(dead_clients_); // Retrieved clients are no longer listed
+
+    return dead_clients;
+}
+
 void NetworkBackend::synchronize() {
-    // For each client messages queue
-    for (auto& [client_token, messages_queue] : clients_remaining_messages_) {
-        // Queue provided for implementation to send remaining messages
+    // For each client which received messages since last sync, other clients queues are known to be empty
+    // Indexed loop as syncClient() might queue messages, so clients might be appended during iteration
+    for (std::size_t i { 0 }; i < clients_to_sync_.size(); i++) {
+        const std::uint64_t client_token { clients_to_sync_[i] };
+
+        // Client might have been removed since messages were queued
+        if (!connected_clients_.contains(client_token))
+            continue;
+
+        Client& client { connected_clients_.at(client_token) };
+
+        // In-process clients poll their queue themselves, messages are kept until then
+        if (client.status.inProcess)
+            continue;
+
+        // Queue provided for implementation to send remaining messages, swapped so whole queue is flushed at once
         std::queue<std::shared_ptr<std::string>> messages_to_send;
+        messages_to_send.swap(client.remainingMessages);
 
-        // Flushes queue, message by message
-        while (!messages_queue.empty()) {
-            messages_to_send.push(messages_queue.front());
-            messages_queue.pop();
+        // If client opted into batched messages, gathers them so they will be sent by one IO operation
+        const std::string* batch_message { nullptr };
+        if (messages_to_send.size() > 1 && client.status.batchedMessages) {
+            messages_to_send.push(std::make_shared<std::string>(formatBatchMessage(messages_to_send)));
+            batch_message = messages_to_send.back().get();
         }
 
+        Core::LatencyTracer* const latency_tracer { latencyTracer() };
+        if (latency_tracer) // Responses queued for client are now carried by flushed messages
+            latency_tracer->synchronized(client_token, batch_message);
+
         // Syncs current client
         syncClient(client_token, std::move(messages_to_send)); // Moves pointers to queue provided for implementation
     }
+
+    clients_to_sync_.clear();
 }
 
 Core::AnyInputEvent NetworkBackend::waitForInput() {
+    // Previously retrieved event has been handled, its payload buffer can be reused
+    input_events_queue_.releasePolled();
+
     // Checks for events inside queue before waiting for new input events
     std::optional<Core::AnyInputEvent> last_input_event { pollInputEvent() };
-    if (last_input_event.has_value())
-        return *last_input_event;
+    while (!last_input_event.has_value()) {
+        // If queue is empty, new input event must be waited for by NetworkBackend implementation
+        waitForEvent();
+
+        // If events queue isn't yet ready, it is an implementation error
+        assert(inputReady());
 
-    // If queue is empty, new input event must be waited for by NetworkBackend implementation
-    waitForEvent();
+        // Then waited for event must be retrieved, unless every queued event was a dropped request
+        last_input_event = pollInputEvent();
+    }
 
-    // If events queue isn't yet ready, it is an implementation error
-    assert(inputReady());
+    // Polled event is the one main loop is about to handle
+    Core::LatencyTracer* const latency_tracer { latencyTracer() };
+    if (latency_tracer)
+        latency_tracer->dequeued(traceKeyOf(*last_input_event));
 
-    // Then waited for event must be retrieved
-    return *pollInputEvent();
+    return std::move(*last_input_event);
 }
 
-void NetworkBackend::registerActor(const std::uint64_t client_token, const std::uint64_t actor_uid, std::string name) {
-    // Checks over all alive actors for UID availability, it must already exists inside actors registry
-    for (const auto& client : connected_clients_) {
-        const std::optional<Actor>& client_actor { client.second.second };  // Second value of client status, actor
+void NetworkBackend::waitForInputs(std::vector<Core::AnyInputEvent>& input_events, const std::size_t max_count) {
+    if (max_count == 0)
+        throw std::invalid_argument { "At least one input event must be retrieved" };
+
+    input_events.clear();
+    // Previously retrieved batch has been handled, payload buffers can be reused
+    input_events_queue_.releasePolled();
+
+    // Messages queued by previous batch handling are flushed once for the whole batch, even if events are still queued
+    synchronize();
+
+    Core::LatencyTracer* const latency_tracer { latencyTracer() };
+    while (input_events.empty()) {
+        // New input events are waited for only if none is ready, as for waitForInput()
+        if (!inputReady()) {
+            waitForEvent();
+            assert(inputReady());
+        }
+
+        // Retrieves every ready event, within given count
+        std::optional<Core::AnyInputEvent> next_input_event { pollInputEvent() };
+        while (next_input_event.has_value()) {
+            if (latency_tracer) // Handled by main loop once every previously retrieved event has been handled
+                latency_tracer->dequeuedInBatch(traceKeyOf(*next_input_event));
 
-        // Only checks for initialized actor (only alive actors can have initialized actor)
-        if (client_actor.has_value()) {
-            if (client_actor->uid == actor_uid) // First, checks for UID
-                throw std::invalid_argument { "Actor UID " + std::to_string(actor_uid) + " unavailable" };
+            input_events.push_back(std::move(*next_input_event));
 
-            if (client_actor->name == name) // Then, checks for name
-                throw std::invalid_argument { "Actor name \"" + name + "\" unavailable" };
+            if (input_events.size() == max_count)
+                break;
+
+            next_input_event = pollInputEvent();
         }
     }
+}
+
+void NetworkBackend::registerActor(const std::uint64_t client_token, const std::uint64_t actor_uid, std::string name) {
+    // Only alive actors are registered, so registries are enough to check for UID and name availability
+    if (actors_registry_.count(actor_uid) == 1) // First, checks for UID
+        throw std::invalid_argument { "Actor UID " + std::to_string(actor_uid) + " unavailable" };
+
+    if (actors_names_.count(name) == 1) // Then, checks for name
+        throw std::invalid_argument { "Actor name \"" + name + "\" unavailable" };
 
     // Checks for client to exists
-    if (connected_clients_.count(client_token) == 0)
+    if (!connected_clients_.contains(client_token))
         throw UnknownClientToken { client_token };
 
-    auto& [client_status, client_actor] { connected_clients_.at(client_token) };
+    Client& client { connected_clients_.at(client_token) };
 
     // Checks for client to have alive connection
-    if (!client_status.alive)
+    if (!client.status.alive)
         throw std::invalid_argument { "Client with token " + std::to_string(client_token) + " is no longer alive" };
 
+    // Inserts actor name into names registry, before name is moved into actor
+    const auto name_insert_result { actors_names_.insert({ name, actor_uid }) };
     // Initializes actor for given client
-    client_actor = { actor_uid, std::move(name) };
-    // Inserts initialized actor UID into registry
-    const auto uid_insert_result { actors_registry_.insert({ actor_uid, client_token }) };
+    client.actor = { actor_uid, std::move(name) };
+    // Inserts initialized actor UID into registry, with its entry at registration entries end
+    const RegisteredActor registered_actor { client_token, registration_entries_.size() };
+    const auto uid_insert_result { actors_registry_.insert({ actor_uid, registered_actor }) };
+
+    assert(uid_insert_result.second && name_insert_result.second); // Checks for UID and name insertion
+
+    // Appends actor entry at serialized registry end, so previous entries offset doesn't change
+    const std::size_t entry_offset { registration_message_.size() };
+    registration_message_ += ' ';
+    registration_message_ += std::to_string(actor_uid);
+    registration_message_ += ' ';
+    registration_message_ += client.actor->name;
 
-    assert(uid_insert_result.second); // Checks for UID insertion
+    const bool entries_compacted { first_removed_entry_ == registration_entries_.size() };
+    registration_entries_.push_back({ actor_uid, entry_offset, registration_message_.size() - entry_offset, false });
+
+    if (entries_compacted) // New entry isn't removed, so first removed entry is still past the end
+        first_removed_entry_ = registration_entries_.size();
 }
 
-void NetworkBackend::privateMessage(const std::uint64_t client_token, std::string new_message) {
-    const auto new_message_owner { std::make_shared<std::string>(std::move(new_message)) };
+bool NetworkBackend::isServiceEvent(const std::string_view rptl_message) {
+    if (isBinaryMessage(rptl_message))
+        return static_cast<std::uint8_t>(rptl_message.front()) == BINARY_SERVICE_EVENT;
+
+    // SE commands are transmitted using SERVICE command with EVENT prefix
+    constexpr std::string_view SE_COMMAND_PREFIX { "EVENT " };
+    const std::size_t se_command_begin { SERVICE_COMMAND.size() + 1 }; // RPTL command name followed by separator
+
+    return rptl_message.size() > se_command_begin
+        && rptl_message.substr(0, SERVICE_COMMAND.size()) == SERVICE_COMMAND
+        && rptl_message[SERVICE_COMMAND.size()] == ' '
+        && rptl_message.substr(se_command_begin, SE_COMMAND_PREFIX.size()) == SE_COMMAND_PREFIX;
+}
+
+bool NetworkBackend::isBinaryMessage(const std::string_view message) {
+    return !message.empty() && static_cast<std::uint8_t>(message.front()) >= BINARY_SERVICE_REQUEST;
+}
+
+bool NetworkBackend::binaryMessages(const std::uint64_t client_token) const {
+    if (!connected_clients_.contains(client_token))
+        throw UnknownClientToken { client_token };
+
+    return connected_clients_.at(client_token).status.binaryMessages;
+}
+
+std::string NetworkBackend::formatBatchMessage(std::queue<std::shared_ptr<std::string>>& messages_queue) {
+    std::string batch_message { BATCH_COMMAND };
+
+    while (!messages_queue.empty()) {
+        const std::string& next_message { *messages_queue.front() };
+
+        // Each message is prefixed with its size, so its end can be found even if it contains any separator
+        batch_message += ' ';
+        batch_message += std::to_string(next_message.size());
+        batch_message += ' ';
+        batch_message += next_message;
+
+        messages_queue.pop();
+    }
+
+    return batch_message;
+}
+
+std::string NetworkBackend::formatServiceMessage(const std::string& ser_message) {
+    std::string rptl_message;
+    // Exactly one allocation for SERVICE command, separator and SER message
+    rptl_message.reserve(SERVICE_COMMAND.size() + 1 + ser_message.size());
+
+    rptl_message += SERVICE_COMMAND;
+    rptl_message += ' ';
+    rptl_message += ser_message;
 
-    clients_remaining_messages_.at(client_token).push(new_message_owner);
+    return rptl_message;
+}
+
+void NetworkBackend::appendVarint(std::string& binary_message, std::uint64_t value) {
+    // 7 bits for each byte, lowest first, highest bit set for each byte but the last one
+    while (value >= 0x80) {
+        binary_message += static_cast<char>((value & 0x7fu) | 0x80u);
+        value >>= 7;
+    }
+
+    binary_message += static_cast<char>(value);
+}
+
+void NetworkBackend::appendString(std::string& binary_message, const std::string_view value) {
+    appendVarint(binary_message, value.size());
+    binary_message += value;
+}
+
+std::string NetworkBackend::formatBinaryServiceMessage(const std::string_view ser_message) {
+    // SER commands formats are `RESPONSE <RUID> OK`, `RESPONSE <RUID> KO <ERR_MSG>` and `EVENT <SERVICE_NAME> <data>`
+    constexpr std::string_view SRR_COMMAND_PREFIX { "RESPONSE " };
+    constexpr std::string_view SE_COMMAND_PREFIX { "EVENT " };
+
+    std::string binary_message;
+    // Varints and prefixes are always shorter than the text they replace
+    binary_message.reserve(ser_message.size());
+
+    if (ser_message.substr(0, SRR_COMMAND_PREFIX.size()) == SRR_COMMAND_PREFIX) {
+        const std::string_view srr_args { ser_message.substr(SRR_COMMAND_PREFIX.size()) };
+        const char* const srr_args_end { srr_args.data() + srr_args.size() };
+
+        // RUID is read straight from SRR, without being copied
+        std::uint64_t ruid;
+        const auto [ruid_end, parsing_err] { std::from_chars(srr_args.data(), srr_args_end, ruid) };
+        const std::string_view status { ruid_end, static_cast<std::size_t>(srr_args_end - ruid_end) };
+
+        const bool succeeded { status == " OK" };
+        const bool failed { status.substr(0, 4) == " KO " };
+
+        if (parsing_err == std::errc {} && (succeeded || failed)) {
+            binary_message += static_cast<char>(BINARY_SERVICE_RESPONSE);
+            appendVarint(binary_message, ruid);
+            binary_message += succeeded ? '\x00' : '\x01';
+
+            if (failed)
+                appendString(binary_message, status.substr(4));
+
+            return binary_message;
+        }
+    } else if (ser_message.substr(0, SE_COMMAND_PREFIX.size()) == SE_COMMAND_PREFIX) {
+        const std::string_view se_args { ser_message.substr(SE_COMMAND_PREFIX.size()) };
+        const std::size_t service_name_end { std::min(se_args.find(' '), se_args.size()) };
+
+        binary_message += static_cast<char>(BINARY_SERVICE_EVENT);
+        appendString(binary_message, se_args.substr(0, service_name_end));
+        // Separator after service name is skipped, if any
+        appendString(binary_message, se_args.substr(std::min(service_name_end + 1, se_args.size())));
+
+        return binary_message;
+    }
+
+    // Not a SER command known to binary encoding, transmitted as text which client must handle anyway
+    return formatServiceMessage(std::string { ser_message });
+}
+
+std::string NetworkBackend::formatServiceMessageFor(const Client& client, const std::string& ser_message) {
+    if (client.status.binaryMessages)
+        return formatBinaryServiceMessage(ser_message);
+    else
+        return formatServiceMessage(ser_message);
+}
+
+void NetworkBackend::queueMessage(const std::uint64_t client_token,
+                                  std::queue<std::shared_ptr<std::string>>& messages_queue,
+                                  std::shared_ptr<std::string> message_owner) {
+
+    // If queue was empty, then client isn't yet listed as requiring sync
+    if (messages_queue.empty())
+        clients_to_sync_.push_back(client_token);
+
+    messages_queue.push(std::move(message_owner));
+}
+
+void NetworkBackend::privateMessage(const std::uint64_t client_token, std::string new_message) {
+    queueMessage(client_token, connected_clients_.at(client_token).remainingMessages,
+                 std::make_shared<std::string>(std::move(new_message)));
 }
 
 void NetworkBackend::broadcastMessage(std::string new_message) {
     const auto new_message_owner { std::make_shared<std::string>(std::move(new_message)) };
 
-    // For each actor, owner is a registered client
-    for (const auto actor : actors_registry_) {
-        // Retrieves registered client token for current actor UID
-        const std::uint64_t actor_owner { actor.second };
+    // Clients are iterated densely, only registered ones receive broadcast messages
+    connected_clients_.forEach([this, &new_message_owner](const std::uint64_t client_token, Client& client) {
+        if (client.actor.has_value()) // Actors queue will share the same data for a broadcast message
+            queueMessage(client_token, client.remainingMessages, new_message_owner);
+    });
+}
 
-        // Actors queue will share the same data for a broadcast message
-        clients_remaining_messages_.at(actor_owner).push(new_message_owner);
-    }
+void NetworkBackend::markDead(const std::uint64_t client_token, ClientStatus& client_status) {
+    // Client must be listed only once, when it dies, and only if implementation has a connection to close
+    if (client_status.alive && !client_status.inProcess)
+        dead_clients_.push_back(client_token);
+
+    client_status.alive = false;
 }
 
 void NetworkBackend::unregisterActor(const std::uint64_t actor_uid) {
@@ -278,27 +685,53 @@ void NetworkBackend::unregisterActor(const std::uint64_t actor_uid) {
     const auto uid_entry { actors_registry_.find(actor_uid) };
 
     // Reset actor object to uninitialized associated with owner client token and set status status to false
-    auto& [status, actor] { connected_clients_.at(uid_entry->second) };
+    Client& owner { connected_clients_.at(uid_entry->second.ownerClient) };
+    std::optional<Actor>& actor { owner.actor };
+    // Name is available again once actor is unregistered
+    const std::size_t removed_names_count { actors_names_.erase(actor->name) };
+    assert(removed_names_count == 1); // Registered actor name must be inside names registry
+
+    // Entry is only marked, so many actors leaving at once don't compact serialized registry each time
+    const std::size_t removed_entry { uid_entry->second.registrationEntry };
+    registration_entries_[removed_entry].removed = true;
+    first_removed_entry_ = std::min(first_removed_entry_, removed_entry);
+
     actor.reset();
     // Sets status as no longer alive, doesn't care about disconnection reason
-    status.alive = false;
+    markDead(uid_entry->second.ownerClient, owner.status);
 
     // Remove actor UID from registry, as it is no longer owned by any client
     actors_registry_.erase(uid_entry);
 }
 
-std::string NetworkBackend::formatRegistrationMessage() const {
-    std::string registration_message { REGISTRATION_COMMAND };
+const std::string& NetworkBackend::formatRegistrationMessage() {
+    if (first_removed_entry_ < registration_entries_.size()) { // Remaining entries after first removed one moved back
+        std::size_t remaining_entries { first_removed_entry_ };
+        std::size_t message_size { registration_entries_[first_removed_entry_].offset };
 
-    for (const auto& client : connected_clients_) { // Checks for each connected client
-        // Get potential Actor from client value inside clients dictionary entry
-        const std::optional<Actor>& potential_actor { client.second.second };
+        for (std::size_t i { first_removed_entry_ + 1 }; i < registration_entries_.size(); i++) {
+            RegistrationEntry entry { registration_entries_[i] };
+            if (entry.removed)
+                continue;
 
-        if (potential_actor.has_value()) // If client is registered with actor, append to sync registration message
-            registration_message += ' ' + std::to_string(potential_actor->uid) + ' ' + potential_actor->name;
+            // Destination is before source, so entry can be copied forward inside the same buffer
+            const auto entry_begin { registration_message_.begin() + static_cast<std::ptrdiff_t>(entry.offset) };
+            std::copy(entry_begin, entry_begin + static_cast<std::ptrdiff_t>(entry.length),
+                      registration_message_.begin() + static_cast<std::ptrdiff_t>(message_size));
+
+            entry.offset = message_size;
+            message_size += entry.length;
+
+            actors_registry_.at(entry.uid).registrationEntry = remaining_entries;
+            registration_entries_[remaining_entries++] = entry;
+        }
+
+        registration_message_.resize(message_size);
+        registration_entries_.resize(remaining_entries);
+        first_removed_entry_ = remaining_entries;
     }
 
-    return registration_message;
+    return registration_message_;
 }
 
 bool NetworkBackend::isRegistered(const std::uint64_t actor_uid) const {
@@ -307,68 +740,91 @@ bool NetworkBackend::isRegistered(const std::uint64_t actor_uid) const {
 
 bool NetworkBackend::isAlive(std::uint64_t client_token) const {
     // Checks for client to exist
-    if (connected_clients_.count(client_token) == 0)
+    if (!connected_clients_.contains(client_token))
         throw UnknownClientToken { client_token };
 
-    return connected_clients_.at(client_token).first.alive;
+    return connected_clients_.at(client_token).status.alive;
 }
 
 const Utils::HandlingResult& NetworkBackend::disconnectionReason(const std::uint64_t client_token) const {
     if (isAlive(client_token)) // Will throws if no connected client uses this token
         throw AliveClient { client_token };
 
-    return connected_clients_.at(client_token).first.disconnectionReason;
+    return connected_clients_.at(client_token).status.disconnectionReason;
 }
 
-void NetworkBackend::addClient(const std::uint64_t new_token) {
-    // Checks for token availability
-    if (connected_clients_.count(new_token) == 1)
-        throw UnavailableClientToken { new_token };
+void NetworkBackend::writeMetrics(Utils::PrometheusWriter& metrics) const {
+    metrics.family("rpt_connected_clients", Utils::MetricType::Gauge,
+                   "Clients currently connected, registered or not.");
+    metrics.sample("rpt_connected_clients", std::uint64_t { connected_clients_.size() });
+
+    metrics.family("rpt_registered_actors", Utils::MetricType::Gauge, "Actors currently registered.");
+    metrics.sample("rpt_registered_actors", std::uint64_t { actors_registry_.size() });
 
-    // Inserts client alive and unregistered
-    const auto insert_client_result {
-        connected_clients_.insert({ // Insert new client with alive status and no disconnection error reason
-            new_token, std::make_pair<ClientStatus, std::optional<Actor>>({ true, {} }, {})
-        })
-    };
-    // Needs empty messages queue for new client
-    const auto insert_queue_result {
-        clients_remaining_messages_.insert({ new_token, {} })
-    };
+    const InboundMessagesCounters& inbound { inbound_messages_counters_ };
+    metrics.family("rpt_inbound_messages_total", Utils::MetricType::Counter,
+                   "Messages received from clients, by RPTL command.");
+    metrics.sample("rpt_inbound_messages_total", inbound.login, { { "command", HANDSHAKE_COMMAND } });
+    metrics.sample("rpt_inbound_messages_total", inbound.logout, { { "command", LOGOUT_COMMAND } });
+    metrics.sample("rpt_inbound_messages_total", inbound.service, { { "command", SERVICE_COMMAND } });
 
-    assert(insert_client_result.second && insert_queue_result.second); // Checks for insertion to be successfully done
+    metrics.family("rpt_inbound_messages_rejected_total", Utils::MetricType::Counter,
+                   "Messages received from clients which were ill-formed or couldn't be handled.");
+    metrics.sample("rpt_inbound_messages_rejected_total", inbound_messages_counters_.rejected);
+
+    const Core::MainLoopMetrics* const main_loop_metrics { mainLoopMetrics() };
+    if (main_loop_metrics)
+        main_loop_metrics->writeTo(metrics);
+}
+
+std::uint64_t NetworkBackend::nextClientToken() {
+    return connected_clients_.nextToken();
+}
+
+void NetworkBackend::addClient(const std::uint64_t new_token) {
+    // Inserts client alive, unregistered, with no disconnection error reason and empty messages queue
+    // Fails if token slot is already used, even by a token with another generation, or if token is stale or too far
+    if (!connected_clients_.insert(new_token, Client { { true, {}, false, false, false }, {}, {} }))
+        throw UnavailableClientToken { new_token };
 }
 
 void NetworkBackend::killClient(const std::uint64_t client_token, const Utils::HandlingResult& disconnection_reason) {
-    if (connected_clients_.count(client_token) == 0) // Checks for client to exist
+    if (!connected_clients_.contains(client_token)) // Checks for client to exist
         throw UnknownClientToken { client_token };
 
-    auto& [status, actor] { connected_clients_.at(client_token) }; // Retrieves status property and potential actor
+    Client& client { connected_clients_.at(client_token) }; // Retrieves status property and potential actor
+    ClientStatus& status { client.status };
+    const std::optional<Actor>& actor { client.actor };
 
     if (actor.has_value()) { // If associated actor exists and is registered
         // Then pipeline must be closed, unregistering actor and making client to no longer be status
         closePipelineWith(actor->uid, disconnection_reason);
     } else { // Else, only marks it as no longer alive status with given disconnection reason (error or not)
-        status = { false, disconnection_reason };
+        markDead(client_token, status);
+        status.disconnectionReason = disconnection_reason;
     }
 }
 
 void NetworkBackend::removeClient(const std::uint64_t old_token) {
-    if (connected_clients_.count(old_token) == 0) // Checks for client to exist
+    if (!connected_clients_.contains(old_token)) // Checks for client to exist
         throw UnknownClientToken { old_token };
 
-    const bool alive_client { connected_clients_.at(old_token).first.alive }; // Retrieves alive client property
+    const bool alive_client { connected_clients_.at(old_token).status.alive }; // Retrieves alive client property
 
     // Checks for client to no longer be alive
     if (alive_client)
         throw AliveClient { old_token };
 
-    // Removes client from connected clients and removes its messages queue
+    // Removes client from connected clients with its messages queue, token is now stale
     const std::size_t removed_clients_count { connected_clients_.erase(old_token) };
-    const std::size_t removed_queues_count { clients_remaining_messages_.erase(old_token) };
 
-    // Must have removed exactly one connected client and one messages queue
-    assert(removed_clients_count == 1 && removed_queues_count);
+    // Remaining responses for client will never be sent
+    Core::LatencyTracer* const latency_tracer { latencyTracer() };
+    if (latency_tracer)
+        latency_tracer->discard(old_token);
+
+    // Must have removed exactly one connected client
+    assert(removed_clients_count == 1);
 }
 
 void NetworkBackend::closePipelineWith(const std::uint64_t actor, const Utils::HandlingResult& clean_shutdown) {
@@ -383,7 +839,7 @@ void NetworkBackend::closePipelineWith(const std::uint64_t actor, const Utils::H
         throw UnknownActorUID { actor };
 
     // Saves owner from UID before removing actor entry
-    const std::uint64_t owner_client { actors_registry_.at(actor) };
+    const std::uint64_t owner_client { actors_registry_.at(actor).ownerClient };
 
     // Actor is no longer connected, removes it from register and marks it as no longer alive
     unregisterActor(actor);
@@ -400,22 +856,107 @@ void NetworkBackend::closePipelineWith(const std::uint64_t actor, const Utils::H
     broadcastMessage(std::string { LOGGED_OUT_COMMAND } + ' ' + std::to_string(actor));
 
     // Set appropriate disconnection reason property to client status
-    connected_clients_.at(owner_client).first.disconnectionReason = clean_shutdown;
+    connected_clients_.at(owner_client).status.disconnectionReason = clean_shutdown;
 }
 
 void NetworkBackend::replyTo(const std::uint64_t sr_actor, const std::string& sr_response) {
     if (!isRegistered(sr_actor)) // Checks for given SR command author to exist
         throw UnknownActorUID { sr_actor };
 
-    const std::uint64_t owner_client { actors_registry_.at(sr_actor) }; // Fetches client owning given actor
+    const std::uint64_t owner_client { actors_registry_.at(sr_actor).ownerClient }; // Fetches client owning actor
+    Client& owner { connected_clients_.at(owner_client) };
+
+    // Formats message for RPTL protocol using SERVICE command, or binary message, and pushes it into queue
+    privateMessage(owner_client, formatServiceMessageFor(owner, sr_response));
 
-    // Formats message for RPTL protocol using SERVICE command and pushes it into queue
-    privateMessage(owner_client, std::string { SERVICE_COMMAND } + ' ' + sr_response);
+    Core::LatencyTracer* const latency_tracer { latencyTracer() };
+    if (latency_tracer) // Response is the message just queued
+        latency_tracer->replied(owner_client, owner.remainingMessages.back().get());
 }
 
 void NetworkBackend::outputEvent(const std::string& event) {
-    // Formats message for RPTL protocol using SERVICE command
-    broadcastMessage(std::string { SERVICE_COMMAND } + ' ' + event);
+    // Formatted once for all text clients and once for all binary clients, only if any of them is registered
+    std::shared_ptr<std::string> text_message;
+    std::shared_ptr<std::string> binary_message;
+
+    connected_clients_.forEach([this, &event, &text_message, &binary_message](const std::uint64_t client_token,
+                                                                             Client& client) {
+        if (!client.actor.has_value()) // Only registered clients receive broadcast messages
+            return;
+
+        std::shared_ptr<std::string>& encoded_message { client.status.binaryMessages ? binary_message : text_message };
+        if (!encoded_message)
+            encoded_message = std::make_shared<std::string>(formatServiceMessageFor(client, event));
+
+        queueMessage(client_token, client.remainingMessages, encoded_message);
+    });
+}
+
+std::uint64_t NetworkBackend::connectInProcess() {
+    const std::uint64_t new_token { nextClientToken() };
+
+    // Inserts client alive, unregistered, with no disconnection error reason and messages never batched
+    const bool inserted { connected_clients_.insert(new_token, Client { { true, {}, false, false, true }, {}, {} }) };
+    assert(inserted); // Token retrieved from slot map is always available
+
+    return new_token;
+}
+
+void NetworkBackend::loginInProcess(const std::uint64_t client_token, const std::uint64_t actor_uid,
+                                    std::string actor_name) {
+
+    if (inProcessClient(client_token).actor.has_value()) // Same as handshaking when already in registered mode
+        throw BadClientMessage { "Client " + std::to_string(client_token) + " is already registered" };
+
+    pushInputEvent(login(client_token, actor_uid, std::move(actor_name)));
+}
+
+void NetworkBackend::requestInProcess(const std::uint64_t client_token, std::string sr_command) {
+    const std::optional<Actor>& client_actor { inProcessClient(client_token).actor };
+
+    if (!client_actor.has_value()) // Only registered actors can send Service Requests
+        throw BadClientMessage { "Client " + std::to_string(client_token) + " must be registered" };
+
+    pushInputEvent(Core::ServiceRequestEvent::borrowing(client_actor->uid, sr_command));
+}
+
+void NetworkBackend::logoutInProcess(const std::uint64_t client_token) {
+    const std::optional<Actor>& client_actor { inProcessClient(client_token).actor };
+
+    if (!client_actor.has_value()) // Only registered actors can be logged out
+        throw BadClientMessage { "Client " + std::to_string(client_token) + " must be registered" };
+
+    pushInputEvent(logout(client_actor->uid));
+}
+
+std::queue<std::shared_ptr<std::string>> NetworkBackend::pollInProcessMessages(const std::uint64_t client_token) {
+    std::queue<std::shared_ptr<std::string>> queued_messages;
+    queued_messages.swap(inProcessClient(client_token).remainingMessages); // Whole queue is flushed at once
+
+    return queued_messages;
+}
+
+void NetworkBackend::disconnectInProcess(const std::uint64_t client_token) {
+    // Connection is closed cleanly, as client can only be closed by server itself
+    if (inProcessClient(client_token).status.alive)
+        killClient(client_token, {});
+
+    removeClient(client_token);
+}
+
+const InboundMessagesCounters& NetworkBackend::inboundMessagesCounters() const {
+    return inbound_messages_counters_;
+}
+
+std::string NetworkBackend::formatMetrics() const {
+    Utils::PrometheusWriter metrics;
+    writeMetrics(metrics);
+
+    return metrics.str();
+}
+
+void NetworkBackend::exposeMetrics(const boost::asio::ip::tcp::endpoint&) {
+    throw std::logic_error { "Backend doesn't have any IO context to serve metrics from" };
 }
 
 
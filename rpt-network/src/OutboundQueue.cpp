@@ -0,0 +1,122 @@
+#include <RpT-Network/OutboundQueue.hpp>
+
+#include <cassert>
+
+
+namespace RpT::Network {
+
+
+OutboundQueue::OutboundQueue() : bytes_count_ { 0 }, paused_ { false } {}
+
+bool OutboundQueue::exceeds(const OutboundQueueLimits& limits) const {
+    const bool too_many_messages { limits.maxMessages != 0 && messages_.size() > limits.maxMessages };
+    const bool too_many_bytes { limits.maxBytes != 0 && bytes_count_ > limits.maxBytes };
+
+    return too_many_messages || too_many_bytes;
+}
+
+bool OutboundQueue::dropOldest() {
+    // Front message might be currently sent, so it is skipped
+    for (auto message { messages_.begin() + 1 }; message < messages_.end(); message++) {
+        if (message->droppable) {
+            bytes_count_ -= message->data->size();
+            messages_.erase(message);
+
+            return true;
+        }
+    }
+
+    return false; // No droppable message found
+}
+
+bool OutboundQueue::empty() const {
+    return messages_.empty();
+}
+
+std::size_t OutboundQueue::size() const {
+    return messages_.size();
+}
+
+std::size_t OutboundQueue::bytes() const {
+    return bytes_count_;
+}
+
+bool OutboundQueue::paused() const {
+    return paused_;
+}
+
+const std::shared_ptr<std::string>& OutboundQueue::front() const {
+    return messages_.front().data;
+}
+
+void OutboundQueue::pop() {
+    bytes_count_ -= messages_.front().data->size();
+    messages_.pop_front();
+
+    if (messages_.empty()) // Client has been caught up with all queued messages, it can receive events again
+        paused_ = false;
+}
+
+void OutboundQueue::discardPending() {
+    if (messages_.empty()) // No front message to keep
+        return;
+
+    QueuedMessage front_message { std::move(messages_.front()) };
+
+    messages_.clear();
+    bytes_count_ = front_message.data->size();
+    messages_.push_back(std::move(front_message));
+}
+
+bool OutboundQueue::push(std::shared_ptr<std::string> message, const bool droppable,
+                         const OutboundQueueLimits& limits, SlowClientCounters& counters) {
+
+    if (paused_ && droppable) { // Paused client doesn't receive droppable messages
+        counters.droppedMessages++;
+
+        return false;
+    }
+
+    bytes_count_ += message->size();
+    messages_.push_back({ std::move(message), droppable });
+
+    if (!exceeds(limits)) // Nothing to do if limits are respected
+        return false;
+
+    switch (limits.policy) {
+    case SlowClientPolicy::Disconnect:
+        counters.disconnections++;
+
+        return true;
+    case SlowClientPolicy::DropOldest:
+        // Drops as many droppable messages as required to respect limits
+        while (exceeds(limits) && dropOldest())
+            counters.droppedMessages++;
+
+        if (exceeds(limits)) { // If every droppable message was dropped but limits are still exceeded
+            counters.disconnections++;
+
+            return true;
+        }
+
+        return false;
+    case SlowClientPolicy::Pause:
+        if (!paused_) { // Counts only when client is paused, not for each message queued while paused
+            paused_ = true;
+            counters.pauses++;
+        }
+
+        return false;
+    }
+
+    assert(false); // Every policy must be handled
+    return false;
+}
+
+void OutboundQueue::pushFinal(std::shared_ptr<std::string> message) {
+    bytes_count_ += message->size();
+    messages_.push_back({ std::move(message), false });
+}
+
+
+}
@@ -6,10 +6,14 @@ namespace RpT::Network {
 
 SafeBeastWebsocketBackend::SafeBeastWebsocketBackend(
         const std::string& certificate_file, const std::string& private_key_file,
-        const boost::asio::ip::tcp::endpoint& local_endpoint, Utils::LoggingContext& logging_context)
+        const boost::asio::ip::tcp::endpoint& local_endpoint, Utils::LoggingContext& logging_context,
+        const std::size_t io_threads_count, const OutboundQueueLimits& outbound_limits,
+        const DeflateOptions& deflate, const TlsSessionOptions& tls_sessions, const HandshakeOptions& handshakes,
+        const AcceptOptions& accept, const TimeoutOptions& timeouts)
         : BeastWebsocketBackendBase<boost::beast::ssl_stream<boost::beast::tcp_stream>> {
-    local_endpoint,logging_context },
-    tls_context_ { boost::asio::ssl::context::tls_server } {
+    local_endpoint, logging_context, io_threads_count, outbound_limits, deflate, handshakes, accept, timeouts },
+    tls_context_ { boost::asio::ssl::context::tls_server },
+    tls_session_resumption_ { tls_context_, tls_sessions } {
 
     auto logger { getLogger() };
 
@@ -20,63 +24,113 @@ SafeBeastWebsocketBackend::SafeBeastWebsocketBackend(
     tls_context_.use_certificate_file(certificate_file, boost::asio::ssl::context::pem);
     tls_context_.use_private_key_file(private_key_file, boost::asio::ssl::context::pem);
 
-    logger.info("Enabled TLS context.");
+    if (tls_sessions.enabled) {
+        logger.info("Enabled TLS context, sessions resumable for {}s with tickets keys rotated every {}s.",
+                    tls_sessions.lifetime.count(), tls_sessions.ticketKeysRotation.count());
+    } else {
+        logger.info("Enabled TLS context, sessions resumption disabled.");
+    }
 }
 
-void SafeBeastWebsocketBackend::openSecureLayer(SafeBeastWebsocketBackend::WebsocketStream new_client_stream) {
+void SafeBeastWebsocketBackend::writeMetrics(Utils::PrometheusWriter& metrics) const {
+    BeastWebsocketBackendBase::writeMetrics(metrics);
+
+    metrics.family("rpt_tls_handshakes_total", Utils::MetricType::Counter,
+                   "Successful TLS handshakes, by whether they resumed a session.");
+    metrics.sample("rpt_tls_handshakes_total", tls_session_counters_.hits, { { "session", "resumed" } });
+    metrics.sample("rpt_tls_handshakes_total", tls_session_counters_.misses, { { "session", "full" } });
+}
+
+const TlsSessionCounters& SafeBeastWebsocketBackend::tlsSessionCounters() const {
+    return tls_session_counters_;
+}
+
+void SafeBeastWebsocketBackend::openSecureLayer(SafeBeastWebsocketBackend::ClientStream new_client_stream) {
     // Websocket stream should be alive until TLS layer has been open
-    const auto new_client_stream_owner { std::make_shared<WebsocketStream>(std::move(new_client_stream)) };
+    const auto new_client_stream_owner { std::make_shared<ClientStream>(std::move(new_client_stream)) };
 
     // Get TLS layer from shared Websocket stream
     boost::beast::ssl_stream<boost::beast::tcp_stream>& tls_layer { new_client_stream_owner->next_layer() };
 
+    // Websocket stream timeouts don't apply to TLS layer, stalled TLS handshake is timed out by TCP stream
+    if (handshakeTimeout().count() > 0)
+        boost::beast::get_lowest_layer(tls_layer).expires_after(handshakeTimeout());
+
     // Next layer after TCP stream should be TLS layer
     tls_layer.async_handshake(boost::asio::ssl::stream_base::server,
                               [this, new_client_stream_owner](const boost::system::error_code& err) {
 
         if (err) {
-            if (err != boost::asio::error::operation_aborted) {
+            // Handshake end and logging are done from backend thread
+            runOnBackend([this, new_client_stream_owner, err]() {
+                endHandshake(err);
+
+                if (err == boost::asio::error::operation_aborted) // Silent if server was stopped
+                    return;
+
                 const boost::asio::ip::tcp::socket& underlying_socket { // Get base connection socket for logging
                     new_client_stream_owner->next_layer().next_layer().socket()
                 };
 
                 getLogger().error("TLS handshaking with {}: {}", endpointFor(underlying_socket), err.message());
-            }
+            });
 
             return; // In any case, failed TLS handshaking means client should NOT be added into registry
         }
 
-        // Moves WSS stream to open WSS layer
+        // TCP stream timeout must be disabled as Websocket stream has its own timeouts
+        boost::beast::get_lowest_layer(*new_client_stream_owner).expires_never();
+
+        // Checked from stream strand, as TLS layer is still used by it
+        const bool session_resumed { SSL_session_reused(new_client_stream_owner->next_layer().native_handle()) == 1 };
+
+        runOnBackend([this, session_resumed]() {
+            if (session_resumed)
+                tls_session_counters_.hits++;
+            else
+                tls_session_counters_.misses++;
+        });
+
+        // Moves WSS stream to open WSS layer, still from stream strand as it doesn't access backend state
         openSafeWebsocketLayer(std::move(*new_client_stream_owner));
     });
 }
 
-void SafeBeastWebsocketBackend::openSafeWebsocketLayer(SafeBeastWebsocketBackend::WebsocketStream new_client_stream) {
+void SafeBeastWebsocketBackend::openSafeWebsocketLayer(SafeBeastWebsocketBackend::ClientStream new_client_stream) {
     // Websocket stream should be alive until WSS layer has been open
-    const auto new_client_stream_owner { std::make_shared<WebsocketStream>(std::move(new_client_stream)) };
+    const auto new_client_stream_owner { std::make_shared<ClientStream>(std::move(new_client_stream)) };
+    configureWebsocketStream(*new_client_stream_owner); // Options must be set before handshake to be negotiated
 
-    new_client_stream_owner->async_accept([this, new_client_stream_owner](const boost::system::error_code& err) {
-        boost::asio::ip::tcp::socket& underlying_socket { // Get base TCP socket for logging purpose
-                new_client_stream_owner->next_layer().next_layer().socket()
-        };
+    new_client_stream_owner->async_accept([this, new_client_stream_owner](boost::system::error_code err) {
+        if (!err) // Still from stream strand, so no operation is pending on stream
+            err = establishStream(*new_client_stream_owner);
 
-        if (err) {
-            if (err != boost::asio::error::operation_aborted) { // Ignores if server stopped
-                getLogger().error("WSS accepting connection from {}: {}",
-                                  endpointFor(underlying_socket), err.message());
-            }
+        // Handshake result is handled from backend thread as client might be added into registry
+        runOnBackend([this, new_client_stream_owner, err]() {
+            endHandshake(err);
 
-            return; // In any case, failed WSS handshaking/accepting means client should NOT be added into registry
-        }
+            boost::asio::ip::tcp::socket& underlying_socket { // Get base TCP socket for logging purpose
+                    new_client_stream_owner->next_layer().next_layer().socket()
+            };
+
+            if (err) {
+                if (err != boost::asio::error::operation_aborted) { // Ignores if server stopped
+                    getLogger().error("WSS accepting connection from {}: {}",
+                                      endpointFor(underlying_socket), err.message());
+                }
+
+                return; // In any case, failed WSS handshaking/accepting means client should NOT be added into registry
+            }
 
-        // Moves WSS open stream into clients registry
-        addClientStream(underlying_socket, std::move(*new_client_stream_owner));
+            // Moves WSS open stream into clients registry
+            addClientStream(underlying_socket, new_client_stream_owner);
+        });
     });
 }
 
-void SafeBeastWebsocketBackend::openWebsocketStream(boost::asio::ip::tcp::socket new_client_connection) {
+void SafeBeastWebsocketBackend::openClientStream(boost::asio::ip::tcp::socket new_client_connection) {
     // Builds new websocket stream over security layer using TLS features
-    WebsocketStream new_client_stream {
+    ClientStream new_client_stream {
         std::move(new_client_connection), tls_context_
     };
 
@@ -0,0 +1,173 @@
+#include <RpT-Network/TlsSessionResumption.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+#include <string_view>
+#include <openssl/evp.h>
+#include <openssl/rand.h>
+
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+#include <openssl/core_names.h>
+#else
+#include <openssl/hmac.h>
+#endif
+
+
+namespace RpT::Network {
+
+
+/// Session ID context required for sessions to be resumed from server-side cache
+constexpr std::string_view SESSION_ID_CONTEXT { "RpT-Server" };
+
+
+int TlsSessionResumption::contextDataIndex() {
+    static const int index { SSL_CTX_get_ex_new_index(0, nullptr, nullptr, nullptr, nullptr) };
+
+    return index;
+}
+
+TlsSessionResumption::TicketKey TlsSessionResumption::generateKey() {
+    TicketKey new_key;
+
+    const bool generated {
+        RAND_bytes(new_key.name.data(), new_key.name.size()) == 1
+        && RAND_bytes(new_key.hmacSecret.data(), new_key.hmacSecret.size()) == 1
+        && RAND_bytes(new_key.aesKey.data(), new_key.aesKey.size()) == 1
+    };
+
+    if (!generated)
+        throw std::runtime_error { "Unable to generate TLS session tickets key" };
+
+    new_key.creation = std::chrono::steady_clock::now();
+
+    return new_key;
+}
+
+bool TlsSessionResumption::initMac(TicketMacContext* mac_context, const TicketKey& key) {
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+    // OSSL_PARAM requires non-const pointers, secret isn't modified anyway
+    const OSSL_PARAM mac_params[] {
+        OSSL_PARAM_construct_octet_string(OSSL_MAC_PARAM_KEY,
+                                          const_cast<unsigned char*>(key.hmacSecret.data()), key.hmacSecret.size()),
+        OSSL_PARAM_construct_utf8_string(OSSL_MAC_PARAM_DIGEST, const_cast<char*>("SHA256"), 0),
+        OSSL_PARAM_construct_end()
+    };
+
+    return EVP_MAC_CTX_set_params(mac_context, mac_params) == 1;
+#else
+    return HMAC_Init_ex(mac_context, key.hmacSecret.data(), key.hmacSecret.size(), EVP_sha256(), nullptr) == 1;
+#endif
+}
+
+int TlsSessionResumption::handleTicketKey(SSL* tls_session, unsigned char* key_name, unsigned char* iv,
+                                          EVP_CIPHER_CTX* cipher_context, TicketMacContext* mac_context,
+                                          const int encrypt) {
+
+    auto* const resumption {
+        static_cast<TlsSessionResumption*>(SSL_CTX_get_ex_data(SSL_get_SSL_CTX(tls_session), contextDataIndex()))
+    };
+
+    if (resumption == nullptr) // Instance unregistered, no ticket issued or resumed
+        return 0;
+
+    std::lock_guard<std::mutex> ticket_keys_lock { resumption->ticket_keys_mutex_ };
+    resumption->rotateKeys();
+
+    if (encrypt == 1) { // New ticket is always encrypted using current key
+        const TicketKey& current_key { resumption->current_key_ };
+
+        if (RAND_bytes(iv, EVP_CIPHER_iv_length(EVP_aes_256_cbc())) != 1)
+            return -1;
+
+        std::copy(current_key.name.begin(), current_key.name.end(), key_name);
+
+        const bool initialized {
+            EVP_EncryptInit_ex(cipher_context, EVP_aes_256_cbc(), nullptr, current_key.aesKey.data(), iv) == 1
+            && initMac(mac_context, current_key)
+        };
+
+        return initialized ? 1 : -1;
+    }
+
+    // Ticket provided by client is decrypted using key with the same name, if it is still known
+    const auto has_name { [key_name](const TicketKey& key) {
+        return std::equal(key.name.begin(), key.name.end(), key_name);
+    } };
+
+    const TicketKey* decryption_key { nullptr };
+    int success_result; // 1 if ticket is valid, 2 if ticket is valid but must be renewed with current key
+
+    if (has_name(resumption->current_key_)) {
+        decryption_key = &resumption->current_key_;
+        success_result = 1;
+    } else if (resumption->previous_key_.has_value() && has_name(*resumption->previous_key_)) {
+        decryption_key = &*resumption->previous_key_;
+        success_result = 2;
+    } else { // Unknown or expired key, full handshake is required
+        return 0;
+    }
+
+    const bool initialized {
+        EVP_DecryptInit_ex(cipher_context, EVP_aes_256_cbc(), nullptr, decryption_key->aesKey.data(), iv) == 1
+        && initMac(mac_context, *decryption_key)
+    };
+
+    return initialized ? success_result : -1;
+}
+
+void TlsSessionResumption::rotateKeys() {
+    const auto current_key_age { std::chrono::steady_clock::now() - current_key_.creation };
+
+    if (current_key_age < rotation_period_) // Current key still valid, nothing to do
+        return;
+
+    // Current key expired, it can still decrypt tickets for one rotation period unless this period expired too
+    if (current_key_age < 2 * rotation_period_)
+        previous_key_ = current_key_;
+    else
+        previous_key_.reset();
+
+    current_key_ = generateKey();
+}
+
+TlsSessionResumption::TlsSessionResumption(boost::asio::ssl::context& tls_context, const TlsSessionOptions& options)
+: tls_context_ { tls_context.native_handle() }, rotation_period_ { options.ticketKeysRotation },
+current_key_ { generateKey() } {
+
+    if (!options.enabled) { // Neither sessions cache nor tickets are used if resumption is disabled
+        SSL_CTX_set_session_cache_mode(tls_context_, SSL_SESS_CACHE_OFF);
+        SSL_CTX_set_options(tls_context_, SSL_OP_NO_TICKET);
+        SSL_CTX_set_num_tickets(tls_context_, 0);
+
+        return;
+    }
+
+    if (options.lifetime.count() <= 0)
+        throw std::invalid_argument { "TLS sessions lifetime must be positive" };
+
+    if (rotation_period_.count() <= 0)
+        throw std::invalid_argument { "TLS session tickets keys rotation period must be positive" };
+
+    // Server-side cache, for clients which don't support tickets
+    SSL_CTX_set_session_cache_mode(tls_context_, SSL_SESS_CACHE_SERVER);
+    SSL_CTX_sess_set_cache_size(tls_context_, static_cast<long>(options.cacheSize));
+    SSL_CTX_set_session_id_context(tls_context_, reinterpret_cast<const unsigned char*>(SESSION_ID_CONTEXT.data()),
+                                   SESSION_ID_CONTEXT.size());
+    // Applies to both cached sessions and tickets lifetime hint
+    SSL_CTX_set_timeout(tls_context_, static_cast<long>(options.lifetime.count()));
+
+    // Tickets keys are provided by this instance, so they can be rotated
+    SSL_CTX_set_ex_data(tls_context_, contextDataIndex(), this);
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+    SSL_CTX_set_tlsext_ticket_key_evp_cb(tls_context_, handleTicketKey);
+#else
+    SSL_CTX_set_tlsext_ticket_key_cb(tls_context_, handleTicketKey);
+#endif
+}
+
+TlsSessionResumption::~TlsSessionResumption() {
+    SSL_CTX_set_ex_data(tls_context_, contextDataIndex(), nullptr);
+}
+
+
+}
@@ -0,0 +1,37 @@
+#include <RpT-Network/UnixLengthPrefixedBackend.hpp>
+
+#if RPT_RUNTIME_PLATFORM == RPT_RUNTIME_UNIX
+
+namespace RpT::Network {
+
+
+UnixLengthPrefixedBackend::UnixLengthPrefixedBackend(
+        const boost::asio::local::stream_protocol::endpoint& local_endpoint, Utils::LoggingContext& logging_context,
+        const std::size_t io_threads_count, const OutboundQueueLimits& outbound_limits, const AcceptOptions& accept,
+        const TimeoutOptions& timeouts)
+        : BeastWebsocketBackendBase<UnixStream, LengthPrefixedStream<UnixStream>> {
+    local_endpoint, logging_context, io_threads_count, outbound_limits, {}, {}, accept, timeouts
+} {}
+
+void UnixLengthPrefixedBackend::openClientStream(boost::asio::local::stream_protocol::socket new_client_connection) {
+    const auto new_client_stream { std::make_shared<ClientStream>(std::move(new_client_connection)) };
+
+    // No handshake to perform, and no operation is pending yet, so stream is established from backend thread
+    const boost::system::error_code err { establishStream(*new_client_stream) };
+    endHandshake(err);
+
+    boost::asio::local::stream_protocol::socket& underlying_socket { new_client_stream->next_layer().socket() };
+
+    if (err) {
+        getLogger().error("Opening stream with {}: {}", endpointFor(underlying_socket), err.message());
+
+        return;
+    }
+
+    addClientStream(underlying_socket, new_client_stream);
+}
+
+
+}
+
+#endif
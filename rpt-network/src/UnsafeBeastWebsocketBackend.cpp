@@ -4,27 +4,41 @@ namespace RpT::Network {
 
 
 UnsafeBeastWebsocketBackend::UnsafeBeastWebsocketBackend(
-        const boost::asio::ip::tcp::endpoint& local_endpoint, Utils::LoggingContext& logging_context)
-        : BeastWebsocketBackendBase<boost::beast::tcp_stream> { local_endpoint, logging_context } {}
-
-void UnsafeBeastWebsocketBackend::openWebsocketStream(boost::asio::ip::tcp::socket new_client_connection) {
+        const boost::asio::ip::tcp::endpoint& local_endpoint, Utils::LoggingContext& logging_context,
+        const std::size_t io_threads_count, const OutboundQueueLimits& outbound_limits,
+        const DeflateOptions& deflate, const HandshakeOptions& handshakes, const AcceptOptions& accept,
+        const TimeoutOptions& timeouts)
+        : BeastWebsocketBackendBase<boost::beast::tcp_stream> {
+    local_endpoint, logging_context, io_threads_count, outbound_limits, deflate, handshakes, accept, timeouts
+} {}
+
+void UnsafeBeastWebsocketBackend::openClientStream(boost::asio::ip::tcp::socket new_client_connection) {
     // Stream ownership is not inside connected clients registry yet, ownership need to be preserved by async IO
     // handler
-    const auto new_client_stream { std::make_shared<WebsocketStream>(std::move(new_client_connection)) };
+    const auto new_client_stream { std::make_shared<ClientStream>(std::move(new_client_connection)) };
+    configureWebsocketStream(*new_client_stream); // Options must be set before handshake to be negotiated
+
+    new_client_stream->async_accept([this, new_client_stream](boost::system::error_code err) {
+        if (!err) // Still from stream strand, so no operation is pending on stream
+            err = establishStream(*new_client_stream);
+
+        // Handshake result is handled from backend thread as client might be added into registry
+        runOnBackend([this, new_client_stream, err]() {
+            endHandshake(err);
 
-    new_client_stream->async_accept([this, new_client_stream](const boost::system::error_code& err) {
-        boost::asio::ip::tcp::socket& underlying_socket { new_client_stream->next_layer().socket() };
+            boost::asio::ip::tcp::socket& underlying_socket { new_client_stream->next_layer().socket() };
 
-        if (err) {
-            if (err != boost::asio::error::operation_aborted) // Silent if server was stopped
-                getLogger().error("Websocket handshaking with {}: {}",
-                                  endpointFor(underlying_socket), err.message());
+            if (err) {
+                if (err != boost::asio::error::operation_aborted) // Silent if server was stopped
+                    getLogger().error("Websocket handshaking with {}: {}",
+                                      endpointFor(underlying_socket), err.message());
 
-            return; // In any case, failed Websocket handshake means client should NOT be added to registry
-        }
+                return; // In any case, failed Websocket handshake means client should NOT be added to registry
+            }
 
-        // Successfully handshake Websocket, move stream into registry, providing underlying TCP socket
-        addClientStream(underlying_socket, std::move(*new_client_stream));
+            // Successfully handshake Websocket, move stream into registry, providing underlying TCP socket
+            addClientStream(underlying_socket, new_client_stream);
+        });
     });
 }
 
@@ -1,4 +1,5 @@
 #include <cassert>
+#include <chrono>
 #include <cstdlib>
 #include <iostream>
 #include <limits>
@@ -7,6 +8,9 @@
 #include <unordered_map>
 #include <RpT-Config/Config.hpp>
 #include <RpT-Core/Executor.hpp>
+#include <RpT-Network/LengthPrefixedTcpBackend.hpp>
+#include <RpT-Network/UnixLengthPrefixedBackend.hpp>
+#include <RpT-Network/UnixWebsocketBackend.hpp>
 #include <RpT-Network/UnsafeBeastWebsocketBackend.hpp>
 #include <RpT-Utils/CommandLineOptionsParser.hpp>
 #include <RpT-Network/SafeBeastWebsocketBackend.hpp>
@@ -52,7 +56,13 @@ int main(const int argc, const char** argv) {
     try {
         // Read and parse command line options
         const RpT::Utils::CommandLineOptionsParser cmd_line_options {
-            argc, argv, { "game", "log-level", "testing", "ip", "net-backend", "crt", "privkey" }
+            argc, argv, { "game", "log-level", "testing", "ip", "net-backend", "crt", "privkey", "io-threads",
+                    "max-queued-messages", "max-queued-bytes", "slow-client-policy",
+                    "deflate", "deflate-window-bits", "deflate-mem-level", "deflate-min-size",
+                    "tls-session-lifetime", "tls-ticket-rotation", "handshake-threads", "max-pending-handshakes",
+                    "acceptors", "pending-accepts", "unix-socket",
+                    "handshake-timeout", "idle-timeout", "close-timeout", "no-keepalive-pings", "trace-latency",
+                    "metrics-port", "input-batch" }
         };
 
         // Get game name from command line options
@@ -113,6 +123,193 @@ int main(const int argc, const char** argv) {
             logger.debug("Keeps mode IPv4, no command line options \"ip\"");
         }
 
+        // Default is running clients IO operations from main loop thread
+        std::size_t io_threads_count { 0 };
+        // Try to get and parse IO threads count from command line options
+        if (cmd_line_options.has("io-threads")) {
+            // String copy must be created anyway to use stoull function
+            const std::string io_threads_argument { cmd_line_options.get("io-threads") };
+
+            io_threads_count = std::stoull(io_threads_argument);
+
+            logger.debug("Switch clients IO operations to {} threads", io_threads_count);
+        } else {
+            logger.debug("Keeps clients IO operations inside main loop thread");
+        }
+
+        // Default is main loop handling up to 64 ready input events before outputs are flushed
+        std::size_t max_batched_inputs { RpT::Core::Executor::DEFAULT_MAX_BATCHED_INPUTS };
+        // Try to get and parse input events batch size from command line options
+        if (cmd_line_options.has("input-batch")) {
+            // String copy must be created anyway to use stoull function
+            const std::string input_batch_argument { cmd_line_options.get("input-batch") };
+
+            max_batched_inputs = std::stoull(input_batch_argument);
+
+            logger.debug("Switch input events batch size to {}", max_batched_inputs);
+        }
+
+        // Default is handshakes ran as clients IO operations, without any limit
+        RpT::Network::HandshakeOptions handshake_options;
+        // Try to get and parse handshake threads count and pending handshakes limit from command line options
+        if (cmd_line_options.has("handshake-threads")) {
+            // String copy must be created anyway to use stoull function
+            const std::string handshake_threads_argument { cmd_line_options.get("handshake-threads") };
+
+            handshake_options.threadsCount = std::stoull(handshake_threads_argument);
+
+            logger.debug("Switch clients handshakes to {} threads", handshake_options.threadsCount);
+        }
+        if (cmd_line_options.has("max-pending-handshakes")) {
+            // String copy must be created anyway to use stoull function
+            const std::string max_pending_argument { cmd_line_options.get("max-pending-handshakes") };
+
+            handshake_options.maxPending = std::stoull(max_pending_argument);
+
+            logger.debug("Limits handshakes in progress to {}", handshake_options.maxPending);
+        }
+
+        // Default is one listening socket with one pending accept operation
+        RpT::Network::AcceptOptions accept_options;
+        // Try to get and parse acceptors count and pending accept operations from command line options
+        if (cmd_line_options.has("acceptors")) {
+            // String copy must be created anyway to use stoull function
+            const std::string acceptors_argument { cmd_line_options.get("acceptors") };
+
+            accept_options.acceptorsCount = std::stoull(acceptors_argument);
+
+            logger.debug("Spread connections among {} acceptors", accept_options.acceptorsCount);
+        }
+        if (cmd_line_options.has("pending-accepts")) {
+            // String copy must be created anyway to use stoull function
+            const std::string pending_accepts_argument { cmd_line_options.get("pending-accepts") };
+
+            accept_options.pendingAccepts = std::stoull(pending_accepts_argument);
+
+            logger.debug("Keeps {} accept operations pending for each acceptor", accept_options.pendingAccepts);
+        }
+
+        // Default is every timeout enabled with default delays, idle clients being pinged, except for length-prefixed
+        // backends which cannot ping clients
+        RpT::Network::TimeoutOptions timeout_options;
+        // Try to get and parse timeouts from command line options, 0 disables a timeout
+        if (cmd_line_options.has("handshake-timeout")) {
+            // String copy must be created anyway to use stoll function
+            const std::string handshake_timeout_argument { cmd_line_options.get("handshake-timeout") };
+
+            timeout_options.handshake = std::chrono::seconds { std::stoll(handshake_timeout_argument) };
+
+            logger.debug("Handshakes timeout set to {}s", timeout_options.handshake.count());
+        }
+        if (cmd_line_options.has("idle-timeout")) {
+            // String copy must be created anyway to use stoll function
+            const std::string idle_timeout_argument { cmd_line_options.get("idle-timeout") };
+
+            timeout_options.idle = std::chrono::seconds { std::stoll(idle_timeout_argument) };
+
+            logger.debug("Idle clients timeout set to {}s", timeout_options.idle.count());
+        }
+        if (cmd_line_options.has("close-timeout")) {
+            // String copy must be created anyway to use stoll function
+            const std::string close_timeout_argument { cmd_line_options.get("close-timeout") };
+
+            timeout_options.close = std::chrono::seconds { std::stoll(close_timeout_argument) };
+
+            logger.debug("Closing handshakes timeout set to {}s", timeout_options.close.count());
+        }
+        if (cmd_line_options.has("no-keepalive-pings")) {
+            timeout_options.keepAlivePings = false;
+
+            logger.debug("Idle clients will not be pinged");
+        }
+
+        // Default is unbounded clients outbound queues
+        RpT::Network::OutboundQueueLimits outbound_limits;
+        // Try to get and parse clients outbound queues limits from command line options
+        if (cmd_line_options.has("max-queued-messages")) {
+            // String copy must be created anyway to use stoull function
+            const std::string max_messages_argument { cmd_line_options.get("max-queued-messages") };
+
+            outbound_limits.maxMessages = std::stoull(max_messages_argument);
+
+            logger.debug("Limits clients outbound queues to {} messages", outbound_limits.maxMessages);
+        }
+        if (cmd_line_options.has("max-queued-bytes")) {
+            // String copy must be created anyway to use stoull function
+            const std::string max_bytes_argument { cmd_line_options.get("max-queued-bytes") };
+
+            outbound_limits.maxBytes = std::stoull(max_bytes_argument);
+
+            logger.debug("Limits clients outbound queues to {} bytes", outbound_limits.maxBytes);
+        }
+        // Try to get and parse policy applied to clients exceeding limits, defaults to disconnection
+        if (cmd_line_options.has("slow-client-policy")) {
+            const std::string_view policy { cmd_line_options.get("slow-client-policy") };
+
+            if (policy == "disconnect") {
+                outbound_limits.policy = RpT::Network::SlowClientPolicy::Disconnect;
+            } else if (policy == "drop-oldest") {
+                outbound_limits.policy = RpT::Network::SlowClientPolicy::DropOldest;
+            } else if (policy == "pause") {
+                outbound_limits.policy = RpT::Network::SlowClientPolicy::Pause;
+            } else {
+                throw RpT::Utils::OptionsError { "Unknown slow client policy: " + std::string { policy } };
+            }
+
+            logger.debug("Slow clients policy set to {}", policy);
+        }
+
+        // Default is Websocket permessage-deflate extension disabled
+        RpT::Network::DeflateOptions deflate_options;
+        // Extension is offered only if option is enabled, other deflate options are ignored otherwise
+        if (cmd_line_options.has("deflate")) {
+            deflate_options.enabled = true;
+
+            if (cmd_line_options.has("deflate-window-bits")) {
+                // String copy must be created anyway to use stoi function
+                const std::string window_bits_argument { cmd_line_options.get("deflate-window-bits") };
+
+                deflate_options.windowBits = std::stoi(window_bits_argument);
+            }
+            if (cmd_line_options.has("deflate-mem-level")) {
+                // String copy must be created anyway to use stoi function
+                const std::string mem_level_argument { cmd_line_options.get("deflate-mem-level") };
+
+                deflate_options.memLevel = std::stoi(mem_level_argument);
+            }
+            if (cmd_line_options.has("deflate-min-size")) {
+                // String copy must be created anyway to use stoull function
+                const std::string min_size_argument { cmd_line_options.get("deflate-min-size") };
+
+                deflate_options.minMessageSize = std::stoull(min_size_argument);
+            }
+
+            logger.debug("Enable permessage-deflate, uncompressed below {} bytes", deflate_options.minMessageSize);
+        } else {
+            logger.debug("Keeps permessage-deflate disabled");
+        }
+
+        // Default is TLS sessions resumable with default lifetime and tickets keys rotation
+        RpT::Network::TlsSessionOptions tls_session_options;
+        // Try to get and parse TLS sessions lifetime from command line options, 0 disables sessions resumption
+        if (cmd_line_options.has("tls-session-lifetime")) {
+            // String copy must be created anyway to use stoll function
+            const std::string lifetime_argument { cmd_line_options.get("tls-session-lifetime") };
+
+            tls_session_options.lifetime = std::chrono::seconds { std::stoll(lifetime_argument) };
+            tls_session_options.enabled = tls_session_options.lifetime.count() != 0;
+
+            logger.debug("TLS sessions lifetime set to {}s", tls_session_options.lifetime.count());
+        }
+        if (cmd_line_options.has("tls-ticket-rotation")) {
+            // String copy must be created anyway to use stoll function
+            const std::string rotation_argument { cmd_line_options.get("tls-ticket-rotation") };
+
+            tls_session_options.ticketKeysRotation = std::chrono::seconds { std::stoll(rotation_argument) };
+
+            logger.debug("TLS session tickets keys rotated every {}s", tls_session_options.ticketKeysRotation.count());
+        }
+
         logger.info("Running RpT server {} on {}.", RpT::Config::VERSION, RpT::Config::runtimePlatformName());
 
         std::vector<boost::filesystem::path> game_resources_path;
@@ -141,12 +338,47 @@ int main(const int argc, const char** argv) {
         game_resources_path.push_back(std::move(user_path));
         game_resources_path.push_back(std::move(local_path));
 
+        // Requests latency is traced only if a dump file is given, declared before backend as it must outlive it
+        std::unique_ptr<RpT::Core::LatencyTracer> latency_tracer;
+        if (cmd_line_options.has("trace-latency")) {
+            latency_tracer = std::make_unique<RpT::Core::LatencyTracer>(
+                    std::string { cmd_line_options.get("trace-latency") });
+
+            if constexpr (RpT::Config::isUnixBuild())
+                logger.info("Latency traced, dumped into {} on SIGUSR1 and at shutdown.", latency_tracer->dumpPath());
+            else
+                logger.info("Latency traced, dumped into {} at shutdown.", latency_tracer->dumpPath());
+        }
+
+        // Main loop metrics are recorded only if they're exposed, declared before backend as it must outlive it
+        std::unique_ptr<RpT::Core::MainLoopMetrics> main_loop_metrics;
+        std::uint16_t metrics_port { 0 };
+        if (cmd_line_options.has("metrics-port")) {
+            // String copy must be created anyway to use stoull function
+            const std::string metrics_port_argument { cmd_line_options.get("metrics-port") };
+            const std::uint64_t parsed_metrics_port { std::stoull(metrics_port_argument) };
+
+            if (parsed_metrics_port > std::numeric_limits<std::uint16_t>::max())
+                throw RpT::Utils::OptionsError { "metrics-port argument must be included inside 0..65535" };
+
+            metrics_port = parsed_metrics_port;
+            main_loop_metrics = std::make_unique<RpT::Core::MainLoopMetrics>();
+        }
+
         // Selected backend for IO interface, defaults to WSS (Safe Websocket)
         std::string_view selected_network_bakcend { "wss" };
         // If backend is supplied by command line options, then override default behavior
         if (cmd_line_options.has("net-backend"))
             selected_network_bakcend = cmd_line_options.get("net-backend");
 
+        // Without any ping, idle timeout would kill clients only receiving messages, so it must be explicitly enabled
+        if ((selected_network_bakcend == "tcp" || selected_network_bakcend == "unix")
+                && !cmd_line_options.has("idle-timeout")) {
+            timeout_options.idle = RpT::Network::lengthPrefixedTimeouts().idle;
+
+            logger.debug("Idle clients timeout disabled for length-prefixed backend");
+        }
+
         // Dynamic selection from command line options, requires dynamic allocation
         std::unique_ptr<RpT::Network::NetworkBackend> network_backend;
         // Local server endpoint evaluated from configurable port and IP protocol version
@@ -173,18 +405,64 @@ int main(const int argc, const char** argv) {
 
             // If both paths are valid, uses them to build backend with appropriate TLS features configuration
             network_backend = std::make_unique<RpT::Network::SafeBeastWebsocketBackend>(
-                    certificate_option, private_key_option, server_local_endpoint, server_logging);
+                    certificate_option, private_key_option, server_local_endpoint, server_logging, io_threads_count,
+                    outbound_limits, deflate_options, tls_session_options, handshake_options, accept_options,
+                    timeout_options);
         } else if (selected_network_bakcend == "unsafe-ws") { // Websockets switched from HTTP
             logger.debug("Using NON-Secure Websocket backend for IO interface.");
 
             network_backend = std::make_unique<RpT::Network::UnsafeBeastWebsocketBackend>(
-                    server_local_endpoint, server_logging);
+                    server_local_endpoint, server_logging, io_threads_count, outbound_limits, deflate_options,
+                    handshake_options, accept_options, timeout_options);
+        } else if (selected_network_bakcend == "tcp") { // Length-prefixed messages over plain TCP
+            logger.debug("Using length-prefixed TCP backend for IO interface, for trusted clients only.");
+
+            network_backend = std::make_unique<RpT::Network::LengthPrefixedTcpBackend>(
+                    server_local_endpoint, server_logging, io_threads_count, outbound_limits, accept_options,
+                    timeout_options);
+#if RPT_RUNTIME_PLATFORM == RPT_RUNTIME_UNIX
+        } else if (selected_network_bakcend == "unix-ws" || selected_network_bakcend == "unix") {
+            // Unix domain socket for a sidecar on the same host, defaults to socket file inside working directory
+            std::string unix_socket_path { "rpt-server.sock" };
+            if (cmd_line_options.has("unix-socket"))
+                unix_socket_path = cmd_line_options.get("unix-socket");
+
+            const boost::asio::local::stream_protocol::endpoint unix_local_endpoint { unix_socket_path };
+
+            if (selected_network_bakcend == "unix-ws") { // Websockets switched from HTTP over local socket
+                logger.debug("Using Unix socket Websocket backend for IO interface, for local clients only.");
+
+                network_backend = std::make_unique<RpT::Network::UnixWebsocketBackend>(
+                        unix_local_endpoint, server_logging, io_threads_count, outbound_limits, deflate_options,
+                        handshake_options, accept_options, timeout_options);
+            } else { // Length-prefixed messages over local socket
+                logger.debug("Using length-prefixed Unix socket backend for IO interface, for local clients only.");
+
+                network_backend = std::make_unique<RpT::Network::UnixLengthPrefixedBackend>(
+                        unix_local_endpoint, server_logging, io_threads_count, outbound_limits, accept_options,
+                        timeout_options);
+            }
+#endif
         } else { // Unknown network backend
             const std::string backend_copy { selected_network_bakcend }; // Copy required for string concat
 
             throw RpT::Utils::OptionsError { "Unknown networking backend " + backend_copy };
         }
 
+        if (latency_tracer)
+            network_backend->traceLatencyWith(*latency_tracer);
+
+        if (main_loop_metrics) { // Only served on loopback, as metrics aren't meant to be public
+            const boost::asio::ip::address loopback_address {
+                server_local_protocol == boost::asio::ip::tcp::v6()
+                ? boost::asio::ip::address { boost::asio::ip::address_v6::loopback() }
+                : boost::asio::ip::address { boost::asio::ip::address_v4::loopback() }
+            };
+
+            network_backend->recordMetricsWith(*main_loop_metrics);
+            network_backend->exposeMetrics({ loopback_address, metrics_port });
+        }
+
         /*
          * Create executor with listed resources paths, game name argument and run main loop with dynamically
          * initialized NetworkBackend implementation
@@ -198,11 +476,22 @@ int main(const int argc, const char** argv) {
         }
 
         RpT::Core::Executor rpt_executor {
-            std::move(game_resources_path), std::string { game_name }, *network_backend, server_logging
+            std::move(game_resources_path), std::string { game_name }, *network_backend, server_logging,
+            max_batched_inputs
         };
 
         const bool done_successfully { rpt_executor.run() };
 
+        if (latency_tracer) { // Traces are kept until the end, so whole server execution is dumped
+            try {
+                latency_tracer->dump();
+
+                logger.info("Latency trace dumped into {}.", latency_tracer->dumpPath());
+            } catch (const std::runtime_error& err) { // Server shutdown doesn't depend on it
+                logger.error("Latency trace dump: {}", err.what());
+            }
+        }
+
         // Process exit code depends on main loop result
         if (done_successfully) {
             logger.info("Successfully shut down.");
@@ -0,0 +1,130 @@
+#include <RpT-Testing/TestingUtils.hpp>
+
+#include <string>
+#include <vector>
+#include <RpT-Network/ClientsSlotMap.hpp>
+
+
+using namespace RpT::Network;
+
+
+BOOST_AUTO_TEST_SUITE(ClientsSlotMapTests)
+
+BOOST_AUTO_TEST_CASE(InsertAndErase) {
+    ClientsSlotMap<std::string> records;
+
+    BOOST_CHECK(records.insert(0, "a"));
+    BOOST_CHECK(records.insert(1, "b"));
+    // Slot 1 already used
+    BOOST_CHECK(!records.insert(1, "c"));
+
+    BOOST_CHECK_EQUAL(records.size(), 2);
+    BOOST_CHECK_EQUAL(records.at(0), "a");
+    BOOST_CHECK_EQUAL(records.at(1), "b");
+    // Slot 2 isn't used
+    BOOST_CHECK(!records.contains(2));
+    BOOST_CHECK_THROW(records.at(2), StaleClientToken);
+
+    BOOST_CHECK_EQUAL(records.erase(1), 1);
+    BOOST_CHECK_EQUAL(records.erase(1), 0);
+    BOOST_CHECK_EQUAL(records.size(), 1);
+    BOOST_CHECK(!records.contains(1));
+}
+
+BOOST_AUTO_TEST_CASE(InsertBeyondLastSlot) {
+    ClientsSlotMap<std::string> records;
+
+    // Would require slots up to 0xFFFFFFF0 to be allocated
+    BOOST_CHECK(!records.insert(0xFFFFFFF0, "a"));
+    // Only the slot right after the last one can be used
+    BOOST_CHECK(!records.insert(1, "a"));
+    BOOST_CHECK(records.insert(0, "a"));
+    BOOST_CHECK(!records.insert(2, "b"));
+    BOOST_CHECK(records.insert(1, "b"));
+
+    BOOST_CHECK_EQUAL(records.size(), 2);
+    BOOST_CHECK_EQUAL(records.nextToken(), 2);
+}
+
+BOOST_AUTO_TEST_CASE(InsertLowerGeneration) {
+    ClientsSlotMap<std::string> records;
+
+    BOOST_CHECK(records.insert(0, "a"));
+    records.erase(0);
+
+    // Token for erased record is stale, it must not address a record again
+    BOOST_CHECK(!records.insert(0, "b"));
+    BOOST_CHECK(!records.contains(0));
+
+    // Current slot generation, or any higher one, is accepted
+    const std::uint64_t next_token { records.nextToken() };
+    BOOST_CHECK(records.insert(next_token, "b"));
+    records.erase(next_token);
+    const std::uint64_t higher_generation_token { std::uint64_t { 42 } << 32 }; // Slot 0, generation 42
+    BOOST_CHECK(records.insert(higher_generation_token, "c"));
+    BOOST_CHECK_EQUAL(records.at(higher_generation_token), "c");
+}
+
+BOOST_AUTO_TEST_CASE(NextTokenReusesSlot) {
+    ClientsSlotMap<std::string> records;
+
+    // Without any freed slot, next token uses a new slot
+    const std::uint64_t first_token { records.nextToken() };
+    BOOST_CHECK_EQUAL(first_token, 0);
+    BOOST_CHECK(records.insert(first_token, "a"));
+    BOOST_CHECK_EQUAL(records.nextToken(), 1);
+
+    records.erase(first_token);
+
+    // Freed slot is reused, but with another generation
+    const std::uint64_t second_token { records.nextToken() };
+    BOOST_CHECK_NE(second_token, first_token);
+    BOOST_CHECK(records.insert(second_token, "b"));
+
+    // Token for erased record is stale, it doesn't address record reusing its slot
+    BOOST_CHECK(!records.contains(first_token));
+    BOOST_CHECK_THROW(records.at(first_token), StaleClientToken);
+    BOOST_CHECK_EQUAL(records.at(second_token), "b");
+    // Slot is still used by new record
+    BOOST_CHECK(!records.insert(first_token, "c"));
+}
+
+BOOST_AUTO_TEST_CASE(NextTokenSkipsReusedSlot) {
+    ClientsSlotMap<std::string> records;
+
+    records.insert(0, "a");
+    records.insert(1, "b");
+    records.erase(0);
+    records.erase(1);
+
+    // Slot 0 freed first, then used again by a caller-chosen token with its current generation
+    BOOST_CHECK(records.insert(std::uint64_t { 1 } << 32, "c"));
+
+    // Slot 1 is the last freed one, and still free
+    BOOST_CHECK(records.insert(records.nextToken(), "d"));
+    // No more freed slot, so a new one is used
+    BOOST_CHECK_EQUAL(records.nextToken(), 2);
+}
+
+BOOST_AUTO_TEST_CASE(ForEachInSlotsOrder) {
+    ClientsSlotMap<std::string> records;
+
+    records.insert(0, "a");
+    records.insert(1, "b");
+    records.insert(2, "c");
+    records.erase(1);
+
+    std::vector<std::uint64_t> visited_tokens;
+    std::string visited_records;
+    records.forEach([&](const std::uint64_t token, std::string& record) {
+        visited_tokens.push_back(token);
+        visited_records += record;
+    });
+
+    const std::vector<std::uint64_t> expected_tokens { 0, 2 };
+    BOOST_CHECK_EQUAL_COLLECTIONS(visited_tokens.begin(), visited_tokens.end(),
+                                  expected_tokens.begin(), expected_tokens.end());
+    BOOST_CHECK_EQUAL(visited_records, "ac");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
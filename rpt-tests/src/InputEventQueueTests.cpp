@@ -0,0 +1,125 @@
+#include <RpT-Testing/TestingUtils.hpp>
+
+#include <RpT-Core/InputEventQueue.hpp>
+
+
+using namespace RpT::Core;
+
+
+BOOST_AUTO_TEST_SUITE(InputEventQueueTests)
+
+BOOST_AUTO_TEST_CASE(Empty) {
+    InputEventQueue queue;
+
+    BOOST_CHECK(queue.empty());
+    BOOST_CHECK_EQUAL(queue.size(), 0);
+    BOOST_CHECK_EQUAL(queue.slabsCount(), 0);
+    BOOST_CHECK_THROW(queue.poll(), std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE(EveryEventType) {
+    InputEventQueue queue;
+    queue.push(NoneEvent { 1 });
+    queue.push(ServiceRequestEvent { 2, "REQUEST 0 Chat Hi" });
+    queue.push(ServiceRequestEvent { 3, 7, "Chat", "Hello everyone" });
+    queue.push(TimerEvent { 4 });
+    queue.push(JoinedEvent { 5, "NewActor" });
+    queue.push(LeftEvent { 6 });
+    queue.push(LeftEvent { 7, "Connection lost" });
+
+    BOOST_CHECK_EQUAL(queue.size(), 7);
+
+    // Events are polled in the order they were pushed
+    BOOST_CHECK_EQUAL(boost::get<NoneEvent>(queue.poll()).actor(), 1);
+
+    const ServiceRequestEvent sr_command { boost::get<ServiceRequestEvent>(queue.poll()) };
+    BOOST_CHECK_EQUAL(sr_command.actor(), 2);
+    BOOST_CHECK(sr_command.borrowed());
+    BOOST_CHECK_EQUAL(sr_command.serviceRequest(), "REQUEST 0 Chat Hi");
+
+    const ServiceRequestEvent decoded_request { boost::get<ServiceRequestEvent>(queue.poll()) };
+    BOOST_CHECK_EQUAL(decoded_request.actor(), 3);
+    BOOST_CHECK(decoded_request.borrowed());
+    BOOST_CHECK(decoded_request.decoded());
+    BOOST_CHECK_EQUAL(decoded_request.ruid(), 7);
+    BOOST_CHECK_EQUAL(decoded_request.serviceName(), "Chat");
+    BOOST_CHECK_EQUAL(decoded_request.commandData(), "Hello everyone");
+
+    BOOST_CHECK_EQUAL(boost::get<TimerEvent>(queue.poll()).actor(), 4);
+
+    const JoinedEvent joined { boost::get<JoinedEvent>(queue.poll()) };
+    BOOST_CHECK_EQUAL(joined.actor(), 5);
+    BOOST_CHECK_EQUAL(joined.playerName(), "NewActor");
+
+    const LeftEvent clean_left { boost::get<LeftEvent>(queue.poll()) };
+    BOOST_CHECK_EQUAL(clean_left.actor(), 6);
+    BOOST_CHECK(clean_left.disconnectionReason());
+
+    const LeftEvent crashed_left { boost::get<LeftEvent>(queue.poll()) };
+    BOOST_CHECK_EQUAL(crashed_left.actor(), 7);
+    BOOST_CHECK(!crashed_left.disconnectionReason());
+    BOOST_CHECK_EQUAL(crashed_left.disconnectionReason().errorMessage(), "Connection lost");
+
+    BOOST_CHECK(queue.empty());
+}
+
+BOOST_AUTO_TEST_CASE(BorrowedEventCopied) {
+    InputEventQueue queue;
+
+    {
+        const std::string message { "REQUEST 0 Chat Hi" };
+        queue.push(ServiceRequestEvent::borrowing(42, message));
+    } // Borrowed message no longer exists
+
+    const ServiceRequestEvent event { boost::get<ServiceRequestEvent>(queue.poll()) };
+    BOOST_CHECK_EQUAL(event.actor(), 42);
+    BOOST_CHECK_EQUAL(event.serviceRequest(), "REQUEST 0 Chat Hi");
+}
+
+BOOST_AUTO_TEST_CASE(SlabsRecycled) {
+    InputEventQueue queue;
+    queue.push(ServiceRequestEvent { 1, "REQUEST 0 Chat Hi" });
+    queue.push(ServiceRequestEvent { 2, "REQUEST 1 Chat Hi" });
+    queue.push(TimerEvent { 3 }); // No payload, no slab required
+
+    BOOST_CHECK_EQUAL(queue.slabsCount(), 2);
+
+    queue.poll();
+    queue.poll();
+    queue.poll();
+    // Polled events might still be used, so slabs cannot be reused yet
+    queue.push(ServiceRequestEvent { 4, "REQUEST 2 Chat Hi" });
+
+    BOOST_CHECK_EQUAL(queue.slabsCount(), 3);
+
+    queue.releasePolled();
+    queue.push(ServiceRequestEvent { 5, "REQUEST 3 Chat Hi" });
+    queue.push(ServiceRequestEvent { 6, "REQUEST 4 Chat Hi" });
+
+    // Released slabs are reused
+    BOOST_CHECK_EQUAL(queue.slabsCount(), 3);
+    BOOST_CHECK_EQUAL(boost::get<ServiceRequestEvent>(queue.poll()).serviceRequest(), "REQUEST 2 Chat Hi");
+    BOOST_CHECK_EQUAL(boost::get<ServiceRequestEvent>(queue.poll()).serviceRequest(), "REQUEST 3 Chat Hi");
+    BOOST_CHECK_EQUAL(boost::get<ServiceRequestEvent>(queue.poll()).serviceRequest(), "REQUEST 4 Chat Hi");
+}
+
+BOOST_AUTO_TEST_CASE(RingGrownWhileWrapped) {
+    InputEventQueue queue;
+
+    // Moves ring head forward, so records are wrapped around ring end when it becomes full
+    for (std::uint64_t actor { 0 }; actor < 10; actor++)
+        queue.push(TimerEvent { actor });
+    for (std::uint64_t actor { 0 }; actor < 10; actor++)
+        queue.poll();
+
+    for (std::uint64_t actor { 0 }; actor < 100; actor++)
+        queue.push(TimerEvent { actor });
+
+    BOOST_CHECK_EQUAL(queue.size(), 100);
+    for (std::uint64_t actor { 0 }; actor < 100; actor++)
+        BOOST_CHECK_EQUAL(boost::get<TimerEvent>(queue.poll()).actor(), actor);
+
+    BOOST_CHECK(queue.empty());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -43,6 +43,66 @@ BOOST_AUTO_TEST_CASE(ActorNameAndValidRequest) {
 
     BOOST_CHECK_EQUAL(event.actor(), 42);
     BOOST_CHECK_EQUAL(event.serviceRequest(), "REQUEST Service command");
+    BOOST_CHECK(!event.decoded());
+    // Request fields are only available once parsed by SER Protocol
+    BOOST_CHECK_THROW(event.ruid(), UnavailableRequestForm);
+    BOOST_CHECK_THROW(event.serviceName(), UnavailableRequestForm);
+    BOOST_CHECK_THROW(event.commandData(), UnavailableRequestForm);
+}
+
+BOOST_AUTO_TEST_CASE(DecodedRequest) {
+    const ServiceRequestEvent event { 42, 7, "Chat", "Hello everyone" };
+
+    BOOST_CHECK_EQUAL(event.actor(), 42);
+    BOOST_CHECK(event.decoded());
+    BOOST_CHECK_EQUAL(event.ruid(), 7);
+    BOOST_CHECK_EQUAL(event.serviceName(), "Chat");
+    BOOST_CHECK_EQUAL(event.commandData(), "Hello everyone");
+    // There isn't any SR command to parse
+    BOOST_CHECK_THROW(event.serviceRequest(), UnavailableRequestForm);
+}
+
+BOOST_AUTO_TEST_CASE(DecodedRequestEmptyFields) {
+    const ServiceRequestEvent event { 42, 0, "", "" };
+
+    BOOST_CHECK(event.decoded());
+    BOOST_CHECK_EQUAL(event.ruid(), 0);
+    BOOST_CHECK_EQUAL(event.serviceName(), "");
+    BOOST_CHECK_EQUAL(event.commandData(), "");
+}
+
+BOOST_AUTO_TEST_CASE(BorrowedRequest) {
+    const std::string message { "SERVICE REQUEST 0 Chat Hi" };
+    const std::string_view sr_command { std::string_view { message }.substr(8) };
+    const ServiceRequestEvent event { ServiceRequestEvent::borrowing(42, sr_command) };
+
+    BOOST_CHECK_EQUAL(event.actor(), 42);
+    BOOST_CHECK(event.borrowed());
+    BOOST_CHECK(!event.decoded());
+    // No copy done, SR command is the borrowed one
+    BOOST_CHECK(event.serviceRequest().data() == sr_command.data());
+    BOOST_CHECK_EQUAL(event.serviceRequest(), "REQUEST 0 Chat Hi");
+    BOOST_CHECK_THROW(event.serviceName(), UnavailableRequestForm);
+}
+
+BOOST_AUTO_TEST_CASE(BorrowedDecodedRequest) {
+    const std::string service_name { "Chat" };
+    const std::string command_data { "Hello everyone" };
+    const ServiceRequestEvent event { ServiceRequestEvent::borrowing(42, 7, service_name, command_data) };
+
+    BOOST_CHECK_EQUAL(event.actor(), 42);
+    BOOST_CHECK(event.borrowed());
+    BOOST_CHECK(event.decoded());
+    BOOST_CHECK_EQUAL(event.ruid(), 7);
+    BOOST_CHECK(event.serviceName().data() == service_name.data());
+    BOOST_CHECK(event.commandData().data() == command_data.data());
+    BOOST_CHECK_THROW(event.serviceRequest(), UnavailableRequestForm);
+}
+
+BOOST_AUTO_TEST_CASE(OwnedRequest) {
+    const ServiceRequestEvent event { 42, "REQUEST 0 Chat Hi" };
+
+    BOOST_CHECK(!event.borrowed());
 }
 
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,132 @@
+#include <RpT-Testing/TestingUtils.hpp>
+
+#include <limits>
+#include <RpT-Utils/LatencyHistogram.hpp>
+
+
+using namespace RpT::Utils;
+
+
+/// Checks for given reported value to be at most 1% above given actual value, and never below it
+void requireClose(const std::uint64_t reported, const std::uint64_t actual) {
+    BOOST_CHECK_GE(reported, actual);
+    BOOST_CHECK_LE(reported - actual, actual / 100);
+}
+
+
+BOOST_AUTO_TEST_SUITE(LatencyHistogramTests)
+
+BOOST_AUTO_TEST_CASE(Empty) {
+    const LatencyHistogram histogram;
+
+    BOOST_CHECK_EQUAL(histogram.count(), 0);
+    BOOST_CHECK_EQUAL(histogram.min(), 0);
+    BOOST_CHECK_EQUAL(histogram.max(), 0);
+    BOOST_CHECK_EQUAL(histogram.mean(), 0);
+    BOOST_CHECK_EQUAL(histogram.percentile(50), 0);
+}
+
+BOOST_AUTO_TEST_CASE(ExactValues) {
+    LatencyHistogram histogram;
+
+    // Small values have their own bucket
+    for (std::uint64_t value { 1 }; value <= 100; value++)
+        histogram.record(value);
+
+    BOOST_CHECK_EQUAL(histogram.count(), 100);
+    BOOST_CHECK_EQUAL(histogram.min(), 1);
+    BOOST_CHECK_EQUAL(histogram.max(), 100);
+    BOOST_CHECK_EQUAL(histogram.mean(), 50.5);
+    BOOST_CHECK_EQUAL(histogram.percentile(0), 1);
+    BOOST_CHECK_EQUAL(histogram.percentile(50), 50);
+    BOOST_CHECK_EQUAL(histogram.percentile(90), 90);
+    BOOST_CHECK_EQUAL(histogram.percentile(99), 99);
+    BOOST_CHECK_EQUAL(histogram.percentile(99.5), 100);
+    BOOST_CHECK_EQUAL(histogram.percentile(100), 100);
+}
+
+BOOST_AUTO_TEST_CASE(SharedBuckets) {
+    LatencyHistogram histogram;
+
+    // Values from 1ms to 1s in microseconds, 1ms apart
+    for (std::uint64_t value { 1000 }; value <= 1000000; value += 1000)
+        histogram.record(value);
+
+    BOOST_CHECK_EQUAL(histogram.count(), 1000);
+    BOOST_CHECK_EQUAL(histogram.min(), 1000);
+    BOOST_CHECK_EQUAL(histogram.max(), 1000000);
+    requireClose(histogram.percentile(50), 500000);
+    requireClose(histogram.percentile(90), 900000);
+    requireClose(histogram.percentile(99), 990000);
+    BOOST_CHECK_EQUAL(histogram.percentile(100), 1000000);
+}
+
+BOOST_AUTO_TEST_CASE(HighestValues) {
+    LatencyHistogram histogram;
+
+    constexpr std::uint64_t highest_value { std::numeric_limits<std::uint64_t>::max() };
+    histogram.record(highest_value);
+    histogram.record(highest_value / 2);
+
+    // Highest bucket counts values up to the highest 64 bits value
+    BOOST_CHECK_EQUAL(histogram.max(), highest_value);
+    BOOST_CHECK_EQUAL(histogram.percentile(100), highest_value);
+    requireClose(histogram.percentile(50), highest_value / 2);
+}
+
+BOOST_AUTO_TEST_CASE(ReportedValueNeverAboveMax) {
+    LatencyHistogram histogram;
+
+    // Shares its bucket with higher values
+    histogram.record(1001);
+
+    BOOST_CHECK_EQUAL(histogram.percentile(50), 1001);
+}
+
+BOOST_AUTO_TEST_CASE(Merge) {
+    LatencyHistogram low_values;
+    LatencyHistogram high_values;
+
+    for (std::uint64_t value { 1 }; value <= 50; value++) {
+        low_values.record(value);
+        high_values.record(value + 50);
+    }
+
+    low_values.merge(high_values);
+
+    BOOST_CHECK_EQUAL(low_values.count(), 100);
+    BOOST_CHECK_EQUAL(low_values.min(), 1);
+    BOOST_CHECK_EQUAL(low_values.max(), 100);
+    BOOST_CHECK_EQUAL(low_values.percentile(50), 50);
+    BOOST_CHECK_EQUAL(low_values.percentile(90), 90);
+
+    // Merged histogram is left unchanged
+    BOOST_CHECK_EQUAL(high_values.count(), 50);
+    BOOST_CHECK_EQUAL(high_values.min(), 51);
+}
+
+BOOST_AUTO_TEST_CASE(Reset) {
+    LatencyHistogram histogram;
+
+    histogram.record(42);
+    histogram.reset();
+
+    BOOST_CHECK_EQUAL(histogram.count(), 0);
+    BOOST_CHECK_EQUAL(histogram.min(), 0);
+    BOOST_CHECK_EQUAL(histogram.max(), 0);
+    BOOST_CHECK_EQUAL(histogram.percentile(100), 0);
+
+    // Minimum value is recorded again from scratch
+    histogram.record(7);
+    BOOST_CHECK_EQUAL(histogram.min(), 7);
+}
+
+BOOST_AUTO_TEST_CASE(InvalidPercentiles) {
+    const LatencyHistogram histogram;
+
+    BOOST_CHECK_THROW(histogram.percentile(-1), InvalidPercentile);
+    BOOST_CHECK_THROW(histogram.percentile(100.1), InvalidPercentile);
+    BOOST_CHECK_THROW(histogram.percentile(std::numeric_limits<double>::quiet_NaN()), InvalidPercentile);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,267 @@
+#include <RpT-Testing/TestingUtils.hpp>
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <RpT-Core/LatencyTracer.hpp>
+
+
+using namespace RpT::Core;
+
+
+constexpr std::uint64_t CLIENT { 1 };
+constexpr std::uint64_t OTHER_CLIENT { 2 };
+constexpr std::uint64_t RUID { 42 };
+
+
+/**
+ * @brief Provides tracer with a request from `CLIENT` using `RUID` received at `received_at`, then queued 1µs later
+ */
+class ReceivedRequestFixture {
+public:
+    LatencyTracer tracer;
+    LatencyTracer::Clock::time_point received_at;
+
+    ReceivedRequestFixture() : tracer { "latency-trace-tests.json" }, received_at { LatencyTracer::Clock::now() } {
+        tracer.received(CLIENT, RUID, received_at);
+        tracer.record(CLIENT, RUID, PipelineStage::Queued, received_at + std::chrono::microseconds { 1 });
+    }
+
+    /// Moves request along pipeline until its response is synchronized, response being carried by given message
+    void replyAndSynchronize(const std::string& response) {
+        tracer.dequeued(LatencyTracer::TraceKey { CLIENT, RUID });
+        tracer.recordCurrent(PipelineStage::HandlingBegin);
+        tracer.recordCurrent(PipelineStage::HandlingEnd);
+        tracer.replied(CLIENT, &response);
+        tracer.synchronized(CLIENT);
+    }
+};
+
+
+BOOST_AUTO_TEST_SUITE(LatencyTracerTests)
+
+/*
+ * Request UID
+ */
+
+BOOST_AUTO_TEST_SUITE(RequestUid)
+
+BOOST_AUTO_TEST_CASE(Decoded) {
+    RpT::Testing::boostCheckOptionalsEqual(LatencyTracer::requestUid(ServiceRequestEvent { 0, 42, "Chat", "Hi" }),
+                                           std::optional<std::uint64_t> { 42 });
+}
+
+BOOST_AUTO_TEST_CASE(ValidCommand) {
+    RpT::Testing::boostCheckOptionalsEqual(LatencyTracer::requestUid(ServiceRequestEvent { 0, "REQUEST 42 Chat Hi" }),
+                                           std::optional<std::uint64_t> { 42 });
+}
+
+BOOST_AUTO_TEST_CASE(MissingRuid) {
+    BOOST_CHECK(!LatencyTracer::requestUid(ServiceRequestEvent { 0, "REQUEST" }).has_value());
+}
+
+BOOST_AUTO_TEST_CASE(InvalidRuid) {
+    BOOST_CHECK(!LatencyTracer::requestUid(ServiceRequestEvent { 0, "REQUEST 4a2 Chat Hi" }).has_value());
+    BOOST_CHECK(!LatencyTracer::requestUid(ServiceRequestEvent { 0, "REQUEST abc Chat Hi" }).has_value());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+/*
+ * Traces
+ */
+
+BOOST_FIXTURE_TEST_SUITE(Traces, ReceivedRequestFixture)
+
+BOOST_AUTO_TEST_CASE(QueuedLatency) {
+    const RpT::Utils::LatencyHistogram& queued_latency { tracer.stageLatency(PipelineStage::Queued) };
+
+    BOOST_CHECK_EQUAL(tracer.inFlight(), 1);
+    BOOST_CHECK_EQUAL(queued_latency.count(), 1);
+    BOOST_CHECK_EQUAL(queued_latency.max(), 1000); // Nanoseconds
+    // Trace begins at Received stage, there is nothing to measure
+    BOOST_CHECK_EQUAL(tracer.stageLatency(PipelineStage::Received).count(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(UntracedRequest) {
+    tracer.record(CLIENT, RUID + 1, PipelineStage::Queued);
+    tracer.record(OTHER_CLIENT, RUID, PipelineStage::Queued);
+
+    // Only the request received by fixture has been recorded
+    BOOST_CHECK_EQUAL(tracer.stageLatency(PipelineStage::Queued).count(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(StageOutOfOrder) {
+    tracer.record(CLIENT, RUID, PipelineStage::HandlingBegin);
+    tracer.record(CLIENT, RUID, PipelineStage::Dequeued);
+    tracer.record(CLIENT, RUID, PipelineStage::HandlingBegin);
+
+    BOOST_CHECK_EQUAL(tracer.stageLatency(PipelineStage::Dequeued).count(), 0);
+    BOOST_CHECK_EQUAL(tracer.stageLatency(PipelineStage::HandlingBegin).count(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(CompleteTrace) {
+    const std::string response { "SERVICE RESPONSE 42 OK" };
+    replyAndSynchronize(response);
+
+    const auto written_at { LatencyTracer::Clock::now() + std::chrono::milliseconds { 1 } };
+    tracer.sent(CLIENT, &response, written_at);
+
+    // Every stage has been recorded once
+    for (std::size_t i { 1 }; i < PIPELINE_STAGES_COUNT; i++)
+        BOOST_CHECK_EQUAL(tracer.stageLatency(static_cast<PipelineStage>(i)).count(), 1);
+
+    BOOST_CHECK_EQUAL(tracer.inFlight(), 0);
+    BOOST_CHECK_EQUAL(tracer.completed(), 1);
+    BOOST_CHECK_EQUAL(tracer.endToEndLatency().count(), 1);
+    BOOST_CHECK_EQUAL(tracer.endToEndLatency().max(),
+                      std::chrono::duration_cast<std::chrono::nanoseconds>(written_at - received_at).count());
+}
+
+BOOST_AUTO_TEST_CASE(OtherMessageSent) {
+    const std::string response { "SERVICE RESPONSE 42 OK" };
+    const std::string event { "SERVICE EVENT Chat MESSAGE_FROM 0 Hi" };
+    replyAndSynchronize(response);
+
+    // Event was queued before response
+    tracer.sent(CLIENT, &event, LatencyTracer::Clock::now());
+
+    BOOST_CHECK_EQUAL(tracer.inFlight(), 1);
+    BOOST_CHECK_EQUAL(tracer.stageLatency(PipelineStage::Sent).count(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(MergedMessageSent) {
+    const std::string response { "SERVICE RESPONSE 42 OK" };
+    const std::string batch { "BATCH 22 SERVICE RESPONSE 42 OK" };
+
+    tracer.dequeued(LatencyTracer::TraceKey { CLIENT, RUID });
+    tracer.replied(CLIENT, &response);
+    tracer.synchronized(CLIENT, &batch);
+
+    // Response is no longer sent by itself
+    tracer.sent(CLIENT, &response, LatencyTracer::Clock::now());
+    BOOST_CHECK_EQUAL(tracer.completed(), 0);
+
+    tracer.sent(CLIENT, &batch, LatencyTracer::Clock::now());
+    BOOST_CHECK_EQUAL(tracer.completed(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(SentBeforeSynchronized) {
+    const std::string response { "SERVICE RESPONSE 42 OK" };
+
+    tracer.dequeued(LatencyTracer::TraceKey { CLIENT, RUID });
+    tracer.replied(CLIENT, &response);
+    tracer.sent(CLIENT, &response, LatencyTracer::Clock::now());
+
+    // Message written can only be one flushed before response was queued
+    BOOST_CHECK_EQUAL(tracer.completed(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(RepliedToOtherClient) {
+    const std::string response { "SERVICE RESPONSE 42 OK" };
+
+    tracer.dequeued(LatencyTracer::TraceKey { CLIENT, RUID });
+    tracer.replied(OTHER_CLIENT, &response);
+
+    BOOST_CHECK_EQUAL(tracer.stageLatency(PipelineStage::Replied).count(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(UntracedEventDequeued) {
+    tracer.dequeued({});
+    tracer.recordCurrent(PipelineStage::HandlingBegin);
+
+    // Traced request isn't the one handled by main loop
+    BOOST_CHECK_EQUAL(tracer.stageLatency(PipelineStage::HandlingBegin).count(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(DequeuedInBatch) {
+    tracer.received(OTHER_CLIENT, RUID, LatencyTracer::Clock::now());
+
+    // Untraced event, then both requests, are dequeued before main loop handles any of them
+    tracer.dequeuedInBatch({});
+    tracer.dequeuedInBatch(LatencyTracer::TraceKey { CLIENT, RUID });
+    tracer.dequeuedInBatch(LatencyTracer::TraceKey { OTHER_CLIENT, RUID });
+
+    // Dequeued stage is recorded at once for both requests
+    BOOST_CHECK_EQUAL(tracer.stageLatency(PipelineStage::Dequeued).count(), 2);
+
+    tracer.nextInBatch();
+    tracer.recordCurrent(PipelineStage::HandlingBegin);
+    BOOST_CHECK_EQUAL(tracer.stageLatency(PipelineStage::HandlingBegin).count(), 0);
+
+    tracer.nextInBatch();
+    tracer.recordCurrent(PipelineStage::HandlingBegin);
+    BOOST_CHECK_EQUAL(tracer.stageLatency(PipelineStage::HandlingBegin).count(), 1);
+
+    // Previous request is done with main loop, response for its client isn't attributed to current request
+    const std::string response { "SERVICE RESPONSE 42 OK" };
+    tracer.nextInBatch();
+    tracer.recordCurrent(PipelineStage::HandlingBegin);
+    tracer.replied(CLIENT, &response);
+
+    BOOST_CHECK_EQUAL(tracer.stageLatency(PipelineStage::HandlingBegin).count(), 2);
+    BOOST_CHECK_EQUAL(tracer.stageLatency(PipelineStage::Replied).count(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(NextInBatchWithoutBatch) {
+    tracer.dequeued(LatencyTracer::TraceKey { CLIENT, RUID });
+    tracer.nextInBatch(); // Request dequeued alone stays current
+
+    tracer.recordCurrent(PipelineStage::HandlingBegin);
+
+    BOOST_CHECK_EQUAL(tracer.stageLatency(PipelineStage::HandlingBegin).count(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(ReusedRuid) {
+    tracer.received(CLIENT, RUID, LatencyTracer::Clock::now());
+
+    // Trace restarted instead of being duplicated
+    BOOST_CHECK_EQUAL(tracer.inFlight(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(Discarded) {
+    tracer.received(OTHER_CLIENT, RUID, LatencyTracer::Clock::now());
+    tracer.dequeued(LatencyTracer::TraceKey { CLIENT, RUID });
+    tracer.discard(CLIENT);
+
+    BOOST_CHECK_EQUAL(tracer.inFlight(), 1);
+
+    // Neither current request nor its client are traced anymore
+    tracer.recordCurrent(PipelineStage::HandlingBegin);
+    tracer.record(CLIENT, RUID, PipelineStage::HandlingBegin);
+    BOOST_CHECK_EQUAL(tracer.stageLatency(PipelineStage::HandlingBegin).count(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(Json) {
+    const std::string json { tracer.toJson() };
+
+    BOOST_CHECK_NE(json.find("\"unit\": \"ns\""), std::string::npos);
+    BOOST_CHECK_NE(json.find("\"in_flight\": 1"), std::string::npos);
+    BOOST_CHECK_NE(json.find("\"queued\": { \"count\": 1, \"mean\": 1000"), std::string::npos);
+    BOOST_CHECK_NE(json.find("\"sent\": { \"count\": 0"), std::string::npos);
+    BOOST_CHECK_EQUAL(json.find("\"received\""), std::string::npos);
+    BOOST_CHECK_NE(json.find("\"end_to_end\": { \"count\": 0"), std::string::npos);
+}
+
+BOOST_AUTO_TEST_CASE(Dump) {
+    tracer.dump();
+
+    std::ifstream dump_file { tracer.dumpPath() };
+    std::ostringstream dumped_json;
+    dumped_json << dump_file.rdbuf();
+
+    BOOST_CHECK_EQUAL(dumped_json.str(), tracer.toJson());
+
+    std::remove(tracer.dumpPath().c_str());
+}
+
+BOOST_AUTO_TEST_CASE(DumpUnwritable) {
+    const LatencyTracer unwritable_tracer { "nonexistent-directory/latency-trace.json" };
+
+    BOOST_CHECK_THROW(unwritable_tracer.dump(), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,180 @@
+#include <RpT-Testing/TestingUtils.hpp>
+
+#include <array>
+#include <functional>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+#include <boost/asio/io_context.hpp>
+#include <boost/beast/core/buffers_to_string.hpp>
+#include <boost/beast/core/flat_buffer.hpp>
+#include <boost/beast/core/tcp_stream.hpp>
+#include <RpT-Network/LengthPrefixedStream.hpp>
+
+
+using namespace RpT::Network;
+
+using TcpPrefixedStream = LengthPrefixedStream<boost::beast::tcp_stream>;
+
+
+/// Server stream and raw client socket connected to each other over loopback
+struct ConnectedStreams {
+    boost::asio::io_context context;
+    std::optional<TcpPrefixedStream> server;
+    boost::asio::ip::tcp::socket client { context };
+
+    ConnectedStreams() {
+        boost::asio::ip::tcp::acceptor acceptor {
+            context, boost::asio::ip::tcp::endpoint { boost::asio::ip::address_v4::loopback(), 0 }
+        };
+
+        client.connect(acceptor.local_endpoint());
+        server.emplace(acceptor.accept());
+    }
+};
+
+
+/// Formats given message prefixed by its size, as written by stream
+std::string prefixed(const std::string_view message) {
+    const auto size { static_cast<std::uint32_t>(message.size()) };
+    std::string prefixed_message {
+        static_cast<char>(size >> 24), static_cast<char>(size >> 16),
+        static_cast<char>(size >> 8), static_cast<char>(size)
+    };
+
+    return prefixed_message.append(message);
+}
+
+/// Reads messages from given server stream until error, returning read messages and final error
+std::pair<std::vector<std::string>, boost::system::error_code> readAll(ConnectedStreams& streams) {
+    std::vector<std::string> messages;
+    boost::system::error_code final_err;
+    boost::beast::flat_buffer buffer;
+
+    std::function<void()> read_next;
+    read_next = [&]() {
+        streams.server->async_read(buffer, [&](const boost::system::error_code& err, const std::size_t size) {
+            if (err) {
+                final_err = err;
+                return;
+            }
+
+            BOOST_CHECK_EQUAL(size, buffer.size());
+            messages.push_back(boost::beast::buffers_to_string(buffer.data()));
+            buffer.consume(buffer.size());
+
+            read_next();
+        });
+    };
+
+    read_next();
+    streams.context.run();
+    streams.context.restart();
+
+    return { std::move(messages), final_err };
+}
+
+
+BOOST_AUTO_TEST_SUITE(LengthPrefixedStreamTests)
+
+BOOST_AUTO_TEST_CASE(ReadMessages) {
+    ConnectedStreams streams;
+
+    // Several messages inside one segment, including an empty message, then connection closed by client
+    const std::string sent { prefixed("LOGIN 42 Alvis") + prefixed("") + prefixed("SERVICE REQUEST 0 a b") };
+    boost::asio::write(streams.client, boost::asio::buffer(sent));
+    streams.client.shutdown(boost::asio::socket_base::shutdown_send);
+
+    const auto [messages, err] { readAll(streams) };
+
+    BOOST_CHECK(err == boost::asio::error::eof);
+    BOOST_REQUIRE_EQUAL(messages.size(), 3);
+    BOOST_CHECK_EQUAL(messages[0], "LOGIN 42 Alvis");
+    BOOST_CHECK_EQUAL(messages[1], "");
+    BOOST_CHECK_EQUAL(messages[2], "SERVICE REQUEST 0 a b");
+}
+
+BOOST_AUTO_TEST_CASE(MessageTooLarge) {
+    ConnectedStreams streams;
+    streams.server->read_message_max(8);
+
+    // Only prefix is sent, it must be rejected before message is received
+    boost::asio::write(streams.client, boost::asio::buffer(prefixed("123456789").substr(0, 4)));
+
+    const auto [messages, err] { readAll(streams) };
+
+    BOOST_CHECK(err == boost::asio::error::message_size);
+    BOOST_CHECK(messages.empty());
+}
+
+BOOST_AUTO_TEST_CASE(WriteMessages) {
+    ConnectedStreams streams;
+
+    const std::array<std::string, 2> messages { "REGISTRATION 0 Console", "INTERRUPT" };
+    for (const std::string& message : messages) {
+        streams.server->async_write(boost::asio::buffer(message), [&message](
+                const boost::system::error_code& err, const std::size_t size) {
+
+            BOOST_CHECK(!err);
+            BOOST_CHECK_EQUAL(size, message.size()); // Prefix isn't counted
+        });
+
+        streams.context.run();
+        streams.context.restart();
+    }
+
+    const std::string expected { prefixed(messages[0]) + prefixed(messages[1]) };
+    std::string received(expected.size(), '\0');
+    boost::asio::read(streams.client, boost::asio::buffer(received));
+
+    BOOST_CHECK_EQUAL(received, expected);
+}
+
+BOOST_AUTO_TEST_CASE(CloseSendsEndOfStream) {
+    ConnectedStreams streams;
+    bool closed { false };
+
+    const std::string message { "INTERRUPT" };
+    streams.server->async_write(boost::asio::buffer(message), [](const boost::system::error_code& err, std::size_t) {
+        BOOST_CHECK(!err);
+    });
+
+    // Streams close once every message was sent
+    streams.context.run();
+    streams.context.restart();
+
+    streams.server->async_close(boost::beast::websocket::normal, [&closed](const boost::system::error_code& err) {
+        BOOST_CHECK(!err);
+        closed = true;
+    });
+
+    streams.context.run();
+    streams.context.restart();
+    BOOST_CHECK(closed);
+
+    // Client receives message already sent then end of stream
+    std::string received;
+    boost::system::error_code err;
+    boost::asio::read(streams.client, boost::asio::dynamic_buffer(received), err);
+
+    BOOST_CHECK(err == boost::asio::error::eof);
+    BOOST_CHECK_EQUAL(received, prefixed(message));
+}
+
+BOOST_AUTO_TEST_CASE(IdleTimeout) {
+    ConnectedStreams streams;
+
+    streams.server->set_option(boost::beast::websocket::stream_base::timeout {
+        boost::beast::websocket::stream_base::none(), std::chrono::milliseconds { 50 }, false
+    });
+
+    // Client never sends anything
+    const auto [messages, err] { readAll(streams) };
+
+    BOOST_CHECK(err == boost::beast::error::timeout);
+    BOOST_CHECK(messages.empty());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
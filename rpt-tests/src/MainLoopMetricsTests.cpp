@@ -0,0 +1,84 @@
+#include <RpT-Testing/TestingUtils.hpp>
+
+#include <RpT-Core/MainLoopMetrics.hpp>
+
+
+using namespace RpT::Core;
+
+
+BOOST_AUTO_TEST_SUITE(MainLoopMetricsTests)
+
+BOOST_AUTO_TEST_CASE(Empty) {
+    const MainLoopMetrics metrics;
+
+    BOOST_CHECK_EQUAL(metrics.serviceRequests("Chat").succeeded, 0);
+    BOOST_CHECK_EQUAL(metrics.serviceRequests("Chat").failed, 0);
+    BOOST_CHECK_EQUAL(metrics.rejectedRequests(), 0);
+    BOOST_CHECK_EQUAL(metrics.polledEvents(), 0);
+    BOOST_CHECK_EQUAL(metrics.iterationLatency().count(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(ServiceRequestsByService) {
+    MainLoopMetrics metrics;
+    metrics.serviceRequestHandled("Chat", true);
+    metrics.serviceRequestHandled("Chat", true);
+    metrics.serviceRequestHandled("Chat", false);
+    metrics.serviceRequestHandled("Lobby", false);
+    metrics.serviceRequestRejected();
+
+    BOOST_CHECK_EQUAL(metrics.serviceRequests("Chat").succeeded, 2);
+    BOOST_CHECK_EQUAL(metrics.serviceRequests("Chat").failed, 1);
+    BOOST_CHECK_EQUAL(metrics.serviceRequests("Lobby").succeeded, 0);
+    BOOST_CHECK_EQUAL(metrics.serviceRequests("Lobby").failed, 1);
+    BOOST_CHECK_EQUAL(metrics.rejectedRequests(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(EventsAndIterations) {
+    MainLoopMetrics metrics;
+    metrics.serviceEventsPolled(3);
+    metrics.serviceEventsPolled(0);
+    metrics.iterationDone(1000);
+    metrics.iterationDone(2000);
+
+    BOOST_CHECK_EQUAL(metrics.polledEvents(), 3);
+    BOOST_CHECK_EQUAL(metrics.iterationLatency().count(), 2);
+}
+
+BOOST_AUTO_TEST_CASE(WriteTo) {
+    MainLoopMetrics metrics;
+    metrics.serviceRequestHandled("Lobby", false);
+    metrics.serviceRequestHandled("Chat", true);
+    metrics.serviceRequestRejected();
+    metrics.serviceEventsPolled(2);
+    metrics.iterationDone(1000);
+
+    RpT::Utils::PrometheusWriter writer;
+    metrics.writeTo(writer);
+
+    // Services are sorted by name
+    BOOST_CHECK_EQUAL(writer.str(),
+                      "# HELP rpt_service_requests_total Service Requests handled by each service, by response "
+                      "result.\n"
+                      "# TYPE rpt_service_requests_total counter\n"
+                      "rpt_service_requests_total{service=\"Chat\",result=\"ok\"} 1\n"
+                      "rpt_service_requests_total{service=\"Chat\",result=\"ko\"} 0\n"
+                      "rpt_service_requests_total{service=\"Lobby\",result=\"ok\"} 0\n"
+                      "rpt_service_requests_total{service=\"Lobby\",result=\"ko\"} 1\n"
+                      "# HELP rpt_service_requests_rejected_total Service Requests ill-formed or intended to an "
+                      "unknown service.\n"
+                      "# TYPE rpt_service_requests_rejected_total counter\n"
+                      "rpt_service_requests_rejected_total 1\n"
+                      "# HELP rpt_service_events_polled_total Service Events polled by main loop.\n"
+                      "# TYPE rpt_service_events_polled_total counter\n"
+                      "rpt_service_events_polled_total 2\n"
+                      "# HELP rpt_main_loop_iteration_seconds Time spent by main loop on one batch of input events "
+                      "and on Service Events they caused.\n"
+                      "# TYPE rpt_main_loop_iteration_seconds summary\n"
+                      "rpt_main_loop_iteration_seconds{quantile=\"0.5\"} 1e-06\n"
+                      "rpt_main_loop_iteration_seconds{quantile=\"0.9\"} 1e-06\n"
+                      "rpt_main_loop_iteration_seconds{quantile=\"0.99\"} 1e-06\n"
+                      "rpt_main_loop_iteration_seconds_sum 1e-06\n"
+                      "rpt_main_loop_iteration_seconds_count 1\n");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
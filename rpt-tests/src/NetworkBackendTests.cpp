@@ -1,10 +1,14 @@
 #include <RpT-Testing/TestingUtils.hpp>
 
 #include <array>
+#include <cassert>
+#include <initializer_list>
+#include <limits>
 #include <optional>
 #include <stdexcept>
 #include <type_traits>
 #include <unordered_map>
+#include <vector>
 #include <RpT-Network/NetworkBackend.hpp>
 
 
@@ -138,6 +142,11 @@ public:
         addClient(new_token);
     }
 
+    /// Trivial access to nextClientToken() for testing purpose
+    std::uint64_t availableToken() {
+        return nextClientToken();
+    }
+
     /// Trivial access to removeClient() for testing purpose
     void deleteClient(const std::uint64_t old_token) {
         removeClient(old_token);
@@ -157,9 +166,32 @@ public:
     void sync() {
         synchronize();
     }
+
+    /// Trivial access to pollDeadClients() for testing purpose
+    std::vector<std::uint64_t> deadClients() {
+        return pollDeadClients();
+    }
+
+    /// Trivial access to binaryMessages() for testing purpose
+    bool binaryEncoding(const std::uint64_t client_token) const {
+        return binaryMessages(client_token);
+    }
 };
 
 
+/// Builds binary RPTL message from given bytes, so no escape sequence can swallow following characters
+std::string bytes(const std::initializer_list<std::uint8_t> message_bytes) {
+    return std::string { message_bytes.begin(), message_bytes.end() };
+}
+
+/// Prefixes given string with its size, for strings short enough to be encoded as single byte varint
+std::string binaryString(const std::string_view value) {
+    assert(value.size() < 0x80);
+
+    return static_cast<char>(value.size()) + std::string { value };
+}
+
+
 BOOST_AUTO_TEST_SUITE(NetworkBackendTests)
 
 /*
@@ -237,6 +269,112 @@ BOOST_AUTO_TEST_CASE(ManyQueuedEvents) {
     BOOST_CHECK_EQUAL(third_event.playerName(), "TestingActor");
 }
 
+BOOST_AUTO_TEST_CASE(RequestFromLeftActor) {
+    SimpleNetworkBackend io_interface;
+
+    // Request received, then pipeline with its actor closed before request is handled
+    io_interface.clientMessage(REGISTERED_TEST_CLIENT, "SERVICE REQUEST 0 Chat Hi");
+    io_interface.closePipelineWith(REGISTERED_TEST_ACTOR, {});
+
+    // Request cannot be replied, so it is dropped
+    const auto event { requireEventType<RpT::Core::LeftEvent>(io_interface.waitForInput()) };
+    BOOST_CHECK_EQUAL(event.actor(), REGISTERED_TEST_ACTOR);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+/*
+ * waitForInputs() unit tests
+ */
+
+BOOST_AUTO_TEST_SUITE(WaitForInputs)
+
+BOOST_AUTO_TEST_CASE(EmptyQueue) {
+    SimpleNetworkBackend io_interface;
+
+    std::vector<RpT::Core::AnyInputEvent> events { RpT::Core::TimerEvent { 1 } }; // Previous batch must be cleared
+    io_interface.waitForInputs(events, 10);
+
+    // Expected call to waitForEvent() returning NoneEvent triggered by actor 0
+    BOOST_REQUIRE_EQUAL(events.size(), 1);
+    BOOST_CHECK_EQUAL(requireEventType<RpT::Core::NoneEvent>(events.front()).actor(), CONSOLE_ACTOR);
+}
+
+BOOST_AUTO_TEST_CASE(EveryQueuedEvent) {
+    SimpleNetworkBackend io_interface;
+
+    io_interface.trigger(RpT::Core::TimerEvent { 1 });
+    io_interface.trigger(RpT::Core::TimerEvent { 2 });
+    io_interface.trigger(RpT::Core::JoinedEvent { 0, "TestingActor" });
+
+    std::vector<RpT::Core::AnyInputEvent> events;
+    io_interface.waitForInputs(events, 10);
+
+    // Queued events retrieved in the order they were triggered, without waiting for another one
+    BOOST_REQUIRE_EQUAL(events.size(), 3);
+    BOOST_CHECK_EQUAL(requireEventType<RpT::Core::TimerEvent>(events[0]).actor(), 1);
+    BOOST_CHECK_EQUAL(requireEventType<RpT::Core::TimerEvent>(events[1]).actor(), 2);
+    BOOST_CHECK_EQUAL(requireEventType<RpT::Core::JoinedEvent>(events[2]).actor(), 0);
+    BOOST_CHECK(!io_interface.ready());
+}
+
+BOOST_AUTO_TEST_CASE(MaxCount) {
+    SimpleNetworkBackend io_interface;
+
+    io_interface.trigger(RpT::Core::TimerEvent { 1 });
+    io_interface.trigger(RpT::Core::TimerEvent { 2 });
+    io_interface.trigger(RpT::Core::TimerEvent { 3 });
+
+    std::vector<RpT::Core::AnyInputEvent> events;
+    io_interface.waitForInputs(events, 2);
+
+    BOOST_REQUIRE_EQUAL(events.size(), 2);
+    BOOST_CHECK_EQUAL(requireEventType<RpT::Core::TimerEvent>(events[0]).actor(), 1);
+    BOOST_CHECK_EQUAL(requireEventType<RpT::Core::TimerEvent>(events[1]).actor(), 2);
+
+    // Remaining event retrieved by next batch
+    io_interface.waitForInputs(events, 2);
+
+    BOOST_REQUIRE_EQUAL(events.size(), 1);
+    BOOST_CHECK_EQUAL(requireEventType<RpT::Core::TimerEvent>(events[0]).actor(), 3);
+}
+
+BOOST_AUTO_TEST_CASE(ZeroMaxCount) {
+    SimpleNetworkBackend io_interface;
+
+    std::vector<RpT::Core::AnyInputEvent> events;
+    BOOST_CHECK_THROW(io_interface.waitForInputs(events, 0), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(SynchronizedWhileEventsQueued) {
+    SimpleNetworkBackend io_interface;
+
+    io_interface.replyTo(REGISTERED_TEST_ACTOR, "RESPONSE 0 OK");
+    io_interface.trigger(RpT::Core::TimerEvent { 1 });
+
+    std::vector<RpT::Core::AnyInputEvent> events;
+    io_interface.waitForInputs(events, 10);
+
+    // Response queued while previous batch was handled has been flushed, even if events were already queued
+    const auto& messages_queue { io_interface.messages_queues.at(REGISTERED_TEST_CLIENT) };
+    BOOST_REQUIRE_EQUAL(messages_queue.size(), 1);
+    BOOST_CHECK_EQUAL(*messages_queue.front(), "SERVICE RESPONSE 0 OK");
+}
+
+BOOST_AUTO_TEST_CASE(RequestFromLeftActor) {
+    SimpleNetworkBackend io_interface;
+
+    io_interface.clientMessage(REGISTERED_TEST_CLIENT, "SERVICE REQUEST 0 Chat Hi");
+    io_interface.closePipelineWith(REGISTERED_TEST_ACTOR, {});
+
+    std::vector<RpT::Core::AnyInputEvent> events;
+    io_interface.waitForInputs(events, 10);
+
+    // Request cannot be replied, so it is dropped
+    BOOST_REQUIRE_EQUAL(events.size(), 1);
+    BOOST_CHECK_EQUAL(requireEventType<RpT::Core::LeftEvent>(events.front()).actor(), REGISTERED_TEST_ACTOR);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 /*
@@ -317,6 +455,14 @@ BOOST_AUTO_TEST_CASE(UnavailableToken) {
     BOOST_CHECK_THROW(io_interface.newClient(CONSOLE_CLIENT), UnavailableClientToken);
 }
 
+BOOST_AUTO_TEST_CASE(TooFarToken) {
+    SimpleNetworkBackend io_interface;
+
+    // Clients storage isn't grown up to any token, it must be the one right after storage end at most
+    BOOST_CHECK_THROW(io_interface.newClient(0xFFFFFFF0), UnavailableClientToken);
+    BOOST_CHECK_NO_THROW(io_interface.newClient(io_interface.availableToken()));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 /*
@@ -408,6 +554,27 @@ BOOST_AUTO_TEST_CASE(UnregisterWithErrorMessage) {
     BOOST_CHECK_EQUAL(status_error.errorMessage(), "Error reason");
 }
 
+BOOST_AUTO_TEST_CASE(DeadClientsPolledOnce) {
+    SimpleNetworkBackend io_interface;
+
+    // No client killed yet
+    BOOST_CHECK(io_interface.deadClients().empty());
+
+    // Kills both registered and unregistered clients, TEST_CLIENT killed twice
+    io_interface.kill(TEST_CLIENT);
+    io_interface.kill(CONSOLE_CLIENT);
+    io_interface.kill(TEST_CLIENT);
+
+    // Each killed client should be listed exactly once, in killing order
+    const std::vector<std::uint64_t> dead_clients { io_interface.deadClients() };
+    BOOST_CHECK_EQUAL(dead_clients.size(), 2);
+    BOOST_CHECK_EQUAL(dead_clients.at(0), TEST_CLIENT);
+    BOOST_CHECK_EQUAL(dead_clients.at(1), CONSOLE_CLIENT);
+
+    // Dead clients have already been polled
+    BOOST_CHECK(io_interface.deadClients().empty());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 /*
@@ -430,8 +597,10 @@ BOOST_AUTO_TEST_CASE(NormalDisconnection) {
 
     // Disconnects default client which wasn't registered for no error reason
     io_interface.deleteClient(TEST_CLIENT);
-    // Adding new client with CONSOLE_CLIENT token should works as it has been removed
-    io_interface.newClient(TEST_CLIENT);
+    // Adding new client should reuse removed client storage
+    const std::uint64_t new_token { io_interface.availableToken() };
+    io_interface.newClient(new_token);
+    BOOST_CHECK(io_interface.alive(new_token));
 }
 
 BOOST_AUTO_TEST_CASE(ErrorDisconnection) {
@@ -441,8 +610,35 @@ BOOST_AUTO_TEST_CASE(ErrorDisconnection) {
 
     // Disconnects default client which wasn't registered for random error reason
     io_interface.deleteClient(TEST_CLIENT);
-    // Adding new client with CONSOLE_CLIENT token should works as it has been removed
-    io_interface.newClient(TEST_CLIENT);
+    // Adding new client should reuse removed client storage
+    const std::uint64_t new_token { io_interface.availableToken() };
+    io_interface.newClient(new_token);
+    BOOST_CHECK(io_interface.alive(new_token));
+}
+
+BOOST_AUTO_TEST_CASE(StaleTokenAfterReuse) {
+    SimpleNetworkBackend io_interface;
+    io_interface.kill(TEST_CLIENT);
+    io_interface.deleteClient(TEST_CLIENT);
+
+    // Removed client storage should be reused by next client, with a different token
+    const std::uint64_t new_token { io_interface.availableToken() };
+    BOOST_CHECK_NE(new_token, TEST_CLIENT);
+    io_interface.newClient(new_token);
+
+    // Removed client token must not address new client
+    BOOST_CHECK(io_interface.alive(new_token));
+    BOOST_CHECK_THROW(io_interface.alive(TEST_CLIENT), UnknownClientToken);
+    BOOST_CHECK_THROW(io_interface.newClient(TEST_CLIENT), UnavailableClientToken);
+}
+
+BOOST_AUTO_TEST_CASE(StaleTokenWithoutReuse) {
+    SimpleNetworkBackend io_interface;
+    io_interface.kill(TEST_CLIENT);
+    io_interface.deleteClient(TEST_CLIENT);
+
+    // Removed client token might still be held by a pending operation, it must not address another client
+    BOOST_CHECK_THROW(io_interface.newClient(TEST_CLIENT), UnavailableClientToken);
 }
 
 BOOST_AUTO_TEST_SUITE_END()
@@ -614,6 +810,104 @@ BOOST_AUTO_TEST_CASE(ExtraArgs) {
     BOOST_CHECK(io_interface.alive(TEST_CLIENT));
 }
 
+BOOST_AUTO_TEST_CASE(BatchedMessagesFlag) {
+    SimpleNetworkBackend io_interface;
+
+    // Sends handshake RPTL command opting into batched messages
+    io_interface.clientMessage(TEST_CLIENT, "LOGIN 42 Alvis BATCH");
+
+    BOOST_CHECK(io_interface.registered(42));
+    BOOST_CHECK(io_interface.alive(TEST_CLIENT));
+    requireEventType<RpT::Core::JoinedEvent>(io_interface.waitForInput());
+
+    io_interface.sync();
+
+    // Registration and logged in messages should have been gathered inside one batch
+    const auto& new_client_queue { io_interface.messages_queues.at(TEST_CLIENT) };
+    BOOST_CHECK_EQUAL(new_client_queue.size(), 1);
+
+    const std::string& batch_message { *new_client_queue.front() };
+    BOOST_CHECK_EQUAL(batch_message.substr(0, 6), "BATCH ");
+
+    // Checks for 1st message, with its size in bytes
+    const std::size_t size_end { batch_message.find(' ', 6) };
+    const std::size_t registration_size { std::stoull(batch_message.substr(6, size_end - 6)) };
+    const std::string registration_message { batch_message.substr(size_end + 1, registration_size) };
+    BOOST_CHECK_EQUAL(registration_message.substr(0, 12), "REGISTRATION");
+
+    // Checks for 2nd and last message, with its size in bytes
+    BOOST_CHECK_EQUAL(batch_message.substr(size_end + 1 + registration_size), " 18 LOGGED_IN 42 Alvis");
+
+    // Other clients didn't opt into batched messages
+    const auto& console_client_queue { io_interface.messages_queues.at(CONSOLE_CLIENT) };
+    BOOST_CHECK_EQUAL(console_client_queue.size(), 1);
+    BOOST_CHECK_EQUAL(*console_client_queue.front(), "LOGGED_IN 42 Alvis");
+
+    /*
+     * A single flushed message should not be batched
+     */
+
+    io_interface.messages_queues.clear();
+    io_interface.outputEvent("EVENT Chat MESSAGE_FROM 42 Hello");
+    io_interface.sync();
+
+    const auto& single_message_queue { io_interface.messages_queues.at(TEST_CLIENT) };
+    BOOST_CHECK_EQUAL(single_message_queue.size(), 1);
+    BOOST_CHECK_EQUAL(*single_message_queue.front(), "SERVICE EVENT Chat MESSAGE_FROM 42 Hello");
+}
+
+BOOST_AUTO_TEST_CASE(BinaryMessagesFlag) {
+    SimpleNetworkBackend io_interface;
+
+    // Sends handshake RPTL command opting into binary encoding, handshake itself is always a text message
+    io_interface.clientMessage(TEST_CLIENT, "LOGIN 42 Alvis BINARY");
+
+    BOOST_CHECK(io_interface.registered(42));
+    BOOST_CHECK(io_interface.binaryEncoding(TEST_CLIENT));
+    requireEventType<RpT::Core::JoinedEvent>(io_interface.waitForInput());
+
+    // Other clients didn't opt into binary encoding
+    BOOST_CHECK(!io_interface.binaryEncoding(CONSOLE_CLIENT));
+    BOOST_CHECK(!io_interface.binaryEncoding(REGISTERED_TEST_CLIENT));
+    BOOST_CHECK_THROW(io_interface.binaryEncoding(42), UnknownClientToken);
+}
+
+BOOST_AUTO_TEST_CASE(BinaryAndBatchedMessagesFlags) {
+    SimpleNetworkBackend io_interface;
+
+    // Flags can be given in any order
+    io_interface.clientMessage(TEST_CLIENT, "LOGIN 42 Alvis BINARY BATCH");
+
+    BOOST_CHECK(io_interface.registered(42));
+    BOOST_CHECK(io_interface.binaryEncoding(TEST_CLIENT));
+    requireEventType<RpT::Core::JoinedEvent>(io_interface.waitForInput());
+
+    io_interface.sync();
+
+    // Registration and logged in messages should still have been gathered inside one batch
+    const auto& new_client_queue { io_interface.messages_queues.at(TEST_CLIENT) };
+    BOOST_CHECK_EQUAL(new_client_queue.size(), 1);
+    BOOST_CHECK_EQUAL(new_client_queue.front()->substr(0, 6), "BATCH ");
+}
+
+BOOST_AUTO_TEST_CASE(DuplicatedFlag) {
+    SimpleNetworkBackend io_interface;
+
+    // Each flag can be given only once
+    BOOST_CHECK_THROW(io_interface.clientMessage(TEST_CLIENT, "LOGIN 42 Alvis BINARY BINARY"), BadClientMessage);
+    BOOST_CHECK(!io_interface.registered(42));
+    BOOST_CHECK(io_interface.alive(TEST_CLIENT));
+}
+
+BOOST_AUTO_TEST_CASE(UnknownFlag) {
+    SimpleNetworkBackend io_interface;
+
+    // Only flag known by handshaking is BATCH
+    BOOST_CHECK_THROW(io_interface.clientMessage(TEST_CLIENT, "LOGIN 42 Alvis BATCH a"), BadClientMessage);
+    BOOST_CHECK(!io_interface.registered(42));
+    BOOST_CHECK(io_interface.alive(TEST_CLIENT));
+}
+
 BOOST_AUTO_TEST_CASE(NotAHandshake) {
     SimpleNetworkBackend io_interface;
 
@@ -631,6 +925,74 @@ BOOST_AUTO_TEST_CASE(UnavailableUid) {
     BOOST_CHECK(io_interface.alive(TEST_CLIENT));
 }
 
+BOOST_AUTO_TEST_CASE(UnavailableName) {
+    SimpleNetworkBackend io_interface;
+
+    // Actor name "Console" isn't available, actor 0 uses it
+    BOOST_CHECK_THROW(io_interface.clientMessage(TEST_CLIENT, "LOGIN 42 Console"), InternalError);
+    BOOST_CHECK(!io_interface.registered(42));
+    BOOST_CHECK(io_interface.alive(TEST_CLIENT));
+}
+
+BOOST_AUTO_TEST_CASE(NameAvailableAfterLogout) {
+    SimpleNetworkBackend io_interface;
+
+    // Console actor logs out, so its name should be available again
+    io_interface.clientMessage(CONSOLE_CLIENT, "LOGOUT");
+    io_interface.clientMessage(TEST_CLIENT, "LOGIN 42 Console");
+
+    BOOST_CHECK(!io_interface.registered(CONSOLE_ACTOR));
+    BOOST_CHECK(io_interface.registered(42));
+}
+
+BOOST_AUTO_TEST_CASE(RegistrationUpToDate) {
+    SimpleNetworkBackend io_interface;
+
+    // Registry is modified at its end, then at its beginning, then at an entry which has been moved back
+    io_interface.clientMessage(TEST_CLIENT, "LOGIN 42 Alvis");
+    io_interface.clientMessage(CONSOLE_CLIENT, "LOGOUT");
+    io_interface.clientMessage(REGISTERED_TEST_CLIENT, "LOGOUT");
+
+    constexpr std::uint64_t new_client { 3 };
+    io_interface.newClient(new_client);
+    io_interface.clientMessage(new_client, "LOGIN 7 Bob");
+
+    io_interface.sync();
+
+    // New client should be synced with remaining actors only, in registration order
+    const auto& new_client_queue { io_interface.messages_queues.at(new_client) };
+    BOOST_REQUIRE_EQUAL(new_client_queue.size(), 2);
+    BOOST_CHECK_EQUAL(*new_client_queue.front(), "REGISTRATION 42 Alvis 7 Bob");
+}
+
+BOOST_AUTO_TEST_CASE(RegistrationAfterManyLogouts) {
+    SimpleNetworkBackend io_interface;
+
+    // Many actors leave at once, then new actors join, so registry is rebuilt then appended
+    io_interface.clientMessage(TEST_CLIENT, "LOGIN 42 Alvis");
+    io_interface.clientMessage(CONSOLE_CLIENT, "LOGOUT");
+    io_interface.clientMessage(REGISTERED_TEST_CLIENT, "LOGOUT");
+
+    constexpr std::uint64_t first_client { 3 };
+    io_interface.newClient(first_client);
+    io_interface.clientMessage(first_client, "LOGIN 7 Bob");
+    constexpr std::uint64_t second_client { 4 };
+    io_interface.newClient(second_client);
+    io_interface.clientMessage(second_client, "LOGIN 8 Carl");
+
+    // Actor entry was moved by previous rebuild
+    io_interface.clientMessage(TEST_CLIENT, "LOGOUT");
+    constexpr std::uint64_t third_client { 5 };
+    io_interface.newClient(third_client);
+    io_interface.clientMessage(third_client, "LOGIN 9 Dan");
+
+    io_interface.sync();
+
+    BOOST_CHECK_EQUAL(*io_interface.messages_queues.at(first_client).front(), "REGISTRATION 42 Alvis 7 Bob");
+    BOOST_CHECK_EQUAL(*io_interface.messages_queues.at(second_client).front(), "REGISTRATION 42 Alvis 7 Bob 8 Carl");
+    BOOST_CHECK_EQUAL(*io_interface.messages_queues.at(third_client).front(), "REGISTRATION 7 Bob 8 Carl 9 Dan");
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 /*
@@ -725,6 +1087,417 @@ BOOST_AUTO_TEST_CASE(EmptyMessage) {
 
 BOOST_AUTO_TEST_SUITE_END()
 
+/*
+ * Client connection mode: registered with binary encoding
+ */
+
+/// Logs in test client as actor 42 with binary encoding, then ignores registration messages and event
+class BinaryClientFixture {
+public:
+    SimpleNetworkBackend io_interface;
+
+    BinaryClientFixture() {
+        io_interface.clientMessage(TEST_CLIENT, "LOGIN 42 Alvis BINARY");
+        io_interface.waitForInput();
+
+        io_interface.sync();
+        io_interface.messages_queues.clear();
+    }
+};
+
+BOOST_FIXTURE_TEST_SUITE(HandleBinary, BinaryClientFixture)
+
+BOOST_AUTO_TEST_CASE(ServiceRequest) {
+    // RUID 150 is encoded as 2 bytes varint
+    io_interface.clientMessage(TEST_CLIENT, bytes({ 0x80, 0x96, 0x01 }) + binaryString("Chat") + binaryString("Hello"));
+
+    // Service Request event should have been decoded by NetworkBackend already
+    const auto event { requireEventType<RpT::Core::ServiceRequestEvent>(io_interface.waitForInput()) };
+    BOOST_CHECK_EQUAL(event.actor(), 42);
+    BOOST_REQUIRE(event.decoded());
+    BOOST_CHECK_EQUAL(event.ruid(), 150);
+    BOOST_CHECK_EQUAL(event.serviceName(), "Chat");
+    BOOST_CHECK_EQUAL(event.commandData(), "Hello");
+}
+
+BOOST_AUTO_TEST_CASE(ServiceRequestEmptyFields) {
+    io_interface.clientMessage(TEST_CLIENT, bytes({ 0x80, 0x00, 0x00, 0x00 }));
+
+    const auto event { requireEventType<RpT::Core::ServiceRequestEvent>(io_interface.waitForInput()) };
+    BOOST_REQUIRE(event.decoded());
+    BOOST_CHECK_EQUAL(event.ruid(), 0);
+    BOOST_CHECK_EQUAL(event.serviceName(), "");
+    BOOST_CHECK_EQUAL(event.commandData(), "");
+}
+
+BOOST_AUTO_TEST_CASE(TextServiceCommand) {
+    // Text commands are still available for a client using binary encoding
+    io_interface.clientMessage(TEST_CLIENT, "SERVICE REQUEST 1 Chat Hello");
+
+    const auto event { requireEventType<RpT::Core::ServiceRequestEvent>(io_interface.waitForInput()) };
+    BOOST_CHECK(!event.decoded());
+    BOOST_CHECK_EQUAL(event.serviceRequest(), "REQUEST 1 Chat Hello");
+}
+
+BOOST_AUTO_TEST_CASE(Logout) {
+    io_interface.clientMessage(TEST_CLIENT, bytes({ 0x81 }));
+
+    BOOST_CHECK(!io_interface.registered(42));
+    BOOST_CHECK(!io_interface.alive(TEST_CLIENT));
+
+    const auto event { requireEventType<RpT::Core::LeftEvent>(io_interface.waitForInput()) };
+    BOOST_CHECK_EQUAL(event.actor(), 42);
+    BOOST_CHECK(event.disconnectionReason());
+
+    io_interface.sync();
+
+    // Interrupt message isn't a SER command, so it is still a text message
+    const auto& test_client_queue { io_interface.messages_queues.at(TEST_CLIENT) };
+    BOOST_CHECK_EQUAL(test_client_queue.size(), 1);
+    BOOST_CHECK_EQUAL(*test_client_queue.front(), "INTERRUPT");
+}
+
+BOOST_AUTO_TEST_CASE(LogoutExtraBytes) {
+    BOOST_CHECK_THROW(io_interface.clientMessage(TEST_CLIENT, bytes({ 0x81, 0x00 })), BadClientMessage);
+    BOOST_CHECK(io_interface.registered(42));
+}
+
+BOOST_AUTO_TEST_CASE(TruncatedServiceRequest) {
+    // Missing command data
+    BOOST_CHECK_THROW(io_interface.clientMessage(TEST_CLIENT, bytes({ 0x80, 0x01 }) + binaryString("Chat")),
+                      BadClientMessage);
+    // RUID varint never ends
+    BOOST_CHECK_THROW(io_interface.clientMessage(TEST_CLIENT, bytes({ 0x80, 0x96 })), BadClientMessage);
+}
+
+BOOST_AUTO_TEST_CASE(StringOverflowsMessage) {
+    // Service name is said to be 5 bytes long, but only 4 bytes remain
+    BOOST_CHECK_THROW(io_interface.clientMessage(TEST_CLIENT, bytes({ 0x80, 0x01, 0x05 }) + "Chat"),
+                      BadClientMessage);
+}
+
+BOOST_AUTO_TEST_CASE(ServiceRequestExtraBytes) {
+    const std::string extra_byte { bytes({ 0x80, 0x01 }) + binaryString("Chat") + binaryString("") + "a" };
+    BOOST_CHECK_THROW(io_interface.clientMessage(TEST_CLIENT, extra_byte), BadClientMessage);
+}
+
+BOOST_AUTO_TEST_CASE(VarintOverflow) {
+    // 10th byte of a varint can only hold the 64th bit
+    const std::string ruid_overflow {
+        bytes({ 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x02, 0x00, 0x00 })
+    };
+    BOOST_CHECK_THROW(io_interface.clientMessage(TEST_CLIENT, ruid_overflow), BadClientMessage);
+
+    // Highest RUID is still valid
+    const std::string highest_ruid {
+        bytes({ 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00 })
+    };
+    io_interface.clientMessage(TEST_CLIENT, highest_ruid);
+
+    const auto event { requireEventType<RpT::Core::ServiceRequestEvent>(io_interface.waitForInput()) };
+    BOOST_CHECK_EQUAL(event.ruid(), std::numeric_limits<std::uint64_t>::max());
+}
+
+BOOST_AUTO_TEST_CASE(UnknownOpcode) {
+    BOOST_CHECK_THROW(io_interface.clientMessage(TEST_CLIENT, bytes({ 0xff })), BadClientMessage);
+}
+
+BOOST_AUTO_TEST_CASE(NotNegotiated) {
+    // Registered test client didn't opt into binary encoding, message is parsed as an unknown text command
+    BOOST_CHECK_THROW(io_interface.clientMessage(REGISTERED_TEST_CLIENT, bytes({ 0x81 })), BadClientMessage);
+    BOOST_CHECK(io_interface.registered(REGISTERED_TEST_ACTOR));
+}
+
+BOOST_AUTO_TEST_CASE(SuccessfulResponse) {
+    io_interface.replyTo(42, "RESPONSE 150 OK");
+    io_interface.sync();
+
+    const auto& test_client_queue { io_interface.messages_queues.at(TEST_CLIENT) };
+    BOOST_REQUIRE_EQUAL(test_client_queue.size(), 1);
+    BOOST_CHECK_EQUAL(*test_client_queue.front(), bytes({ 0x82, 0x96, 0x01, 0x00 }));
+}
+
+BOOST_AUTO_TEST_CASE(FailedResponse) {
+    io_interface.replyTo(42, "RESPONSE 3 KO Nope");
+    io_interface.sync();
+
+    const auto& test_client_queue { io_interface.messages_queues.at(TEST_CLIENT) };
+    BOOST_REQUIRE_EQUAL(test_client_queue.size(), 1);
+    BOOST_CHECK_EQUAL(*test_client_queue.front(), bytes({ 0x82, 0x03, 0x01 }) + binaryString("Nope"));
+}
+
+BOOST_AUTO_TEST_CASE(UnknownSerCommand) {
+    // Not a SER command binary encoding knows about, so it is sent as text
+    io_interface.replyTo(42, "Some SRR thing");
+    io_interface.sync();
+
+    const auto& test_client_queue { io_interface.messages_queues.at(TEST_CLIENT) };
+    BOOST_REQUIRE_EQUAL(test_client_queue.size(), 1);
+    BOOST_CHECK_EQUAL(*test_client_queue.front(), "SERVICE Some SRR thing");
+}
+
+BOOST_AUTO_TEST_CASE(TextClientResponse) {
+    io_interface.replyTo(REGISTERED_TEST_ACTOR, "RESPONSE 150 OK");
+    io_interface.sync();
+
+    const auto& test_client_queue { io_interface.messages_queues.at(REGISTERED_TEST_CLIENT) };
+    BOOST_REQUIRE_EQUAL(test_client_queue.size(), 1);
+    BOOST_CHECK_EQUAL(*test_client_queue.front(), "SERVICE RESPONSE 150 OK");
+}
+
+BOOST_AUTO_TEST_CASE(MixedEncodingsEvent) {
+    io_interface.outputEvent("EVENT Chat MESSAGE_FROM 42 Hello");
+    io_interface.sync();
+
+    // Binary client receives service name and event data as separate strings
+    const auto& binary_client_queue { io_interface.messages_queues.at(TEST_CLIENT) };
+    BOOST_REQUIRE_EQUAL(binary_client_queue.size(), 1);
+    BOOST_CHECK_EQUAL(*binary_client_queue.front(),
+                      bytes({ 0x83 }) + binaryString("Chat") + binaryString("MESSAGE_FROM 42 Hello"));
+
+    // Text clients share the same formatted message
+    const auto& console_client_queue { io_interface.messages_queues.at(CONSOLE_CLIENT) };
+    const auto& text_client_queue { io_interface.messages_queues.at(REGISTERED_TEST_CLIENT) };
+    BOOST_REQUIRE_EQUAL(console_client_queue.size(), 1);
+    BOOST_REQUIRE_EQUAL(text_client_queue.size(), 1);
+    BOOST_CHECK_EQUAL(*console_client_queue.front(), "SERVICE EVENT Chat MESSAGE_FROM 42 Hello");
+    BOOST_CHECK_EQUAL(console_client_queue.front(), text_client_queue.front());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE_END()
+
+/*
+ * In-process clients unit tests
+ */
+
+BOOST_AUTO_TEST_SUITE(InProcess)
+
+BOOST_AUTO_TEST_CASE(LoginRegistersActor) {
+    SimpleNetworkBackend io_interface;
+
+    const std::uint64_t bot_client { io_interface.connectInProcess() };
+    io_interface.loginInProcess(bot_client, 42, "Bot");
+
+    BOOST_CHECK(io_interface.registered(42));
+    BOOST_CHECK(io_interface.alive(bot_client));
+
+    // Joined event should have been pushed directly, as for a LOGIN command
+    const auto event { requireEventType<RpT::Core::JoinedEvent>(io_interface.waitForInput()) };
+    BOOST_CHECK_EQUAL(event.actor(), 42);
+    BOOST_CHECK_EQUAL(event.playerName(), "Bot");
+
+    io_interface.sync();
+
+    // Bot queue isn't synced by implementation...
+    BOOST_CHECK_EQUAL(io_interface.messages_queues.count(bot_client), 0);
+    // ...but other actors are aware about bot registration
+    BOOST_CHECK_EQUAL(*io_interface.messages_queues.at(CONSOLE_CLIENT).front(), "LOGGED_IN 42 Bot");
+
+    // Bot polls registration and its own logged in message, logged in message is shared with other clients
+    auto bot_messages { io_interface.pollInProcessMessages(bot_client) };
+    BOOST_REQUIRE_EQUAL(bot_messages.size(), 2);
+    BOOST_CHECK_EQUAL(
+            *bot_messages.front(),
+            "REGISTRATION 0 Console " + std::to_string(REGISTERED_TEST_ACTOR) + ' ' + std::string { REGISTERED_TEST_NAME }
+            + " 42 Bot");
+    bot_messages.pop();
+    BOOST_CHECK_EQUAL(bot_messages.front(), io_interface.messages_queues.at(CONSOLE_CLIENT).front());
+
+    // Queue has been flushed
+    BOOST_CHECK(io_interface.pollInProcessMessages(bot_client).empty());
+}
+
+BOOST_AUTO_TEST_CASE(LoginAlreadyRegistered) {
+    SimpleNetworkBackend io_interface;
+
+    const std::uint64_t bot_client { io_interface.connectInProcess() };
+    io_interface.loginInProcess(bot_client, 42, "Bot");
+
+    BOOST_CHECK_THROW(io_interface.loginInProcess(bot_client, 43, "OtherBot"), BadClientMessage);
+}
+
+BOOST_AUTO_TEST_CASE(LoginUnavailableUid) {
+    SimpleNetworkBackend io_interface;
+
+    const std::uint64_t bot_client { io_interface.connectInProcess() };
+
+    BOOST_CHECK_THROW(io_interface.loginInProcess(bot_client, CONSOLE_ACTOR, "Bot"), InternalError);
+    BOOST_CHECK(!io_interface.ready()); // No event pushed for failed registration
+}
+
+BOOST_AUTO_TEST_CASE(ServiceRequest) {
+    SimpleNetworkBackend io_interface;
+
+    const std::uint64_t bot_client { io_interface.connectInProcess() };
+    io_interface.loginInProcess(bot_client, 42, "Bot");
+    io_interface.waitForInput(); // Ignores joined event
+    io_interface.pollInProcessMessages(bot_client); // Ignores registration messages
+
+    io_interface.requestInProcess(bot_client, "Any SR command");
+
+    const auto event { requireEventType<RpT::Core::ServiceRequestEvent>(io_interface.waitForInput()) };
+    BOOST_CHECK_EQUAL(event.actor(), 42);
+    BOOST_CHECK_EQUAL(event.serviceRequest(), "Any SR command");
+
+    // Responses are queued for bot as for any other actor
+    io_interface.replyTo(42, "RESPONSE 0 OK");
+    io_interface.sync();
+
+    BOOST_CHECK_EQUAL(io_interface.messages_queues.count(bot_client), 0);
+
+    const auto bot_messages { io_interface.pollInProcessMessages(bot_client) };
+    BOOST_REQUIRE_EQUAL(bot_messages.size(), 1);
+    BOOST_CHECK_EQUAL(*bot_messages.front(), "SERVICE RESPONSE 0 OK");
+}
+
+BOOST_AUTO_TEST_CASE(ServiceRequestUnregistered) {
+    SimpleNetworkBackend io_interface;
+
+    const std::uint64_t bot_client { io_interface.connectInProcess() };
+
+    BOOST_CHECK_THROW(io_interface.requestInProcess(bot_client, "Any SR command"), BadClientMessage);
+}
+
+BOOST_AUTO_TEST_CASE(Logout) {
+    SimpleNetworkBackend io_interface;
+
+    const std::uint64_t bot_client { io_interface.connectInProcess() };
+    io_interface.loginInProcess(bot_client, 42, "Bot");
+    io_interface.waitForInput(); // Ignores joined event
+    io_interface.pollInProcessMessages(bot_client); // Ignores registration messages
+
+    io_interface.logoutInProcess(bot_client);
+
+    BOOST_CHECK(!io_interface.registered(42));
+    BOOST_CHECK(!io_interface.alive(bot_client));
+    // Implementation has no connection to close for bot
+    BOOST_CHECK(io_interface.deadClients().empty());
+
+    const auto event { requireEventType<RpT::Core::LeftEvent>(io_interface.waitForInput()) };
+    BOOST_CHECK_EQUAL(event.actor(), 42);
+    BOOST_CHECK(event.disconnectionReason());
+
+    const auto bot_messages { io_interface.pollInProcessMessages(bot_client) };
+    BOOST_REQUIRE_EQUAL(bot_messages.size(), 1);
+    BOOST_CHECK_EQUAL(*bot_messages.front(), "INTERRUPT");
+}
+
+BOOST_AUTO_TEST_CASE(ClosedPipeline) {
+    SimpleNetworkBackend io_interface;
+
+    const std::uint64_t bot_client { io_interface.connectInProcess() };
+    io_interface.loginInProcess(bot_client, 42, "Bot");
+    io_interface.waitForInput(); // Ignores joined event
+    io_interface.pollInProcessMessages(bot_client); // Ignores registration messages
+
+    // Server kicks bot as it would kick any other actor
+    io_interface.closePipelineWith(42, RpT::Utils::HandlingResult { "ERROR" });
+
+    BOOST_CHECK(!io_interface.alive(bot_client));
+    BOOST_CHECK(io_interface.deadClients().empty());
+
+    const auto bot_messages { io_interface.pollInProcessMessages(bot_client) };
+    BOOST_REQUIRE_EQUAL(bot_messages.size(), 1);
+    BOOST_CHECK_EQUAL(*bot_messages.front(), "INTERRUPT ERROR");
+}
+
+BOOST_AUTO_TEST_CASE(Disconnect) {
+    SimpleNetworkBackend io_interface;
+
+    const std::uint64_t bot_client { io_interface.connectInProcess() };
+    io_interface.loginInProcess(bot_client, 42, "Bot");
+    io_interface.waitForInput(); // Ignores joined event
+
+    io_interface.disconnectInProcess(bot_client);
+
+    // Actor is disconnected cleanly and token is now stale
+    BOOST_CHECK(!io_interface.registered(42));
+    BOOST_CHECK_THROW(io_interface.alive(bot_client), UnknownClientToken);
+    BOOST_CHECK(io_interface.deadClients().empty());
+
+    const auto event { requireEventType<RpT::Core::LeftEvent>(io_interface.waitForInput()) };
+    BOOST_CHECK_EQUAL(event.actor(), 42);
+    BOOST_CHECK(event.disconnectionReason());
+}
+
+BOOST_AUTO_TEST_CASE(NetworkClient) {
+    SimpleNetworkBackend io_interface;
+
+    // Clients connected by implementation cannot be driven in-process
+    BOOST_CHECK_THROW(io_interface.loginInProcess(TEST_CLIENT, 42, "Bot"), NotInProcessClient);
+    BOOST_CHECK_THROW(io_interface.requestInProcess(CONSOLE_CLIENT, "Any SR command"), NotInProcessClient);
+    BOOST_CHECK_THROW(io_interface.logoutInProcess(CONSOLE_CLIENT), NotInProcessClient);
+    BOOST_CHECK_THROW(io_interface.pollInProcessMessages(CONSOLE_CLIENT), NotInProcessClient);
+    BOOST_CHECK_THROW(io_interface.disconnectInProcess(CONSOLE_CLIENT), NotInProcessClient);
+    BOOST_CHECK(io_interface.registered(CONSOLE_ACTOR));
+}
+
+BOOST_AUTO_TEST_CASE(UnknownToken) {
+    SimpleNetworkBackend io_interface;
+
+    BOOST_CHECK_THROW(io_interface.pollInProcessMessages(io_interface.availableToken()), UnknownClientToken);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+
+
+/*
+ * Metrics unit tests
+ */
+
+BOOST_AUTO_TEST_SUITE(Metrics)
+
+BOOST_AUTO_TEST_CASE(InboundMessagesByCommand) {
+    SimpleNetworkBackend io_interface; // Console and testing clients registration are counted as LOGIN
+
+    io_interface.clientMessage(REGISTERED_TEST_CLIENT, "SERVICE REQUEST 0 Chat Hi");
+    io_interface.clientMessage(REGISTERED_TEST_CLIENT, "SERVICE REQUEST 1 Chat Hi");
+    BOOST_CHECK_THROW(io_interface.clientMessage(REGISTERED_TEST_CLIENT, "UNKNOWN"), BadClientMessage);
+    BOOST_CHECK_THROW(io_interface.clientMessage(TEST_CLIENT, "LOGIN"), BadClientMessage);
+    io_interface.clientMessage(REGISTERED_TEST_CLIENT, "LOGOUT");
+
+    const InboundMessagesCounters& counters { io_interface.inboundMessagesCounters() };
+    BOOST_CHECK_EQUAL(counters.login, 2);
+    BOOST_CHECK_EQUAL(counters.logout, 1);
+    BOOST_CHECK_EQUAL(counters.service, 2);
+    BOOST_CHECK_EQUAL(counters.rejected, 2);
+}
+
+BOOST_AUTO_TEST_CASE(FormatWithoutMainLoopMetrics) {
+    SimpleNetworkBackend io_interface;
+    io_interface.clientMessage(REGISTERED_TEST_CLIENT, "SERVICE REQUEST 0 Chat Hi");
+
+    const std::string metrics { io_interface.formatMetrics() };
+
+    BOOST_CHECK_NE(metrics.find("rpt_connected_clients 3\n"), std::string::npos);
+    BOOST_CHECK_NE(metrics.find("rpt_registered_actors 2\n"), std::string::npos);
+    BOOST_CHECK_NE(metrics.find("rpt_inbound_messages_total{command=\"LOGIN\"} 2\n"), std::string::npos);
+    BOOST_CHECK_NE(metrics.find("rpt_inbound_messages_total{command=\"SERVICE\"} 1\n"), std::string::npos);
+    BOOST_CHECK_EQUAL(metrics.find("rpt_service_requests_total"), std::string::npos);
+}
+
+BOOST_AUTO_TEST_CASE(FormatWithMainLoopMetrics) {
+    RpT::Core::MainLoopMetrics main_loop_metrics;
+    main_loop_metrics.serviceRequestHandled("Chat", true);
+
+    SimpleNetworkBackend io_interface;
+    io_interface.recordMetricsWith(main_loop_metrics);
+
+    const std::string metrics { io_interface.formatMetrics() };
+
+    BOOST_CHECK_NE(metrics.find("rpt_service_requests_total{service=\"Chat\",result=\"ok\"} 1\n"),
+                   std::string::npos);
+}
+
+BOOST_AUTO_TEST_CASE(NotExposable) {
+    SimpleNetworkBackend io_interface;
+
+    BOOST_CHECK_THROW(io_interface.exposeMetrics({ boost::asio::ip::address_v4::loopback(), 0 }), std::logic_error);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 
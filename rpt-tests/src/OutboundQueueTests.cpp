@@ -0,0 +1,157 @@
+#include <RpT-Testing/TestingUtils.hpp>
+
+#include <array>
+#include <string_view>
+#include <RpT-Network/OutboundQueue.hpp>
+
+
+using namespace RpT::Network;
+
+
+/// Makes shared message with given content
+std::shared_ptr<std::string> message(std::string content) {
+    return std::make_shared<std::string>(std::move(content));
+}
+
+
+BOOST_AUTO_TEST_SUITE(OutboundQueueTests)
+
+BOOST_AUTO_TEST_CASE(Unbounded) {
+    OutboundQueue queue;
+    SlowClientCounters counters;
+
+    BOOST_CHECK(queue.empty());
+
+    // Default limits are unbounded
+    for (int i { 0 }; i < 1000; i++)
+        BOOST_CHECK(!queue.push(message("abcd"), true, {}, counters));
+
+    BOOST_CHECK_EQUAL(queue.size(), 1000);
+    BOOST_CHECK_EQUAL(queue.bytes(), 4000);
+    BOOST_CHECK(!queue.paused());
+
+    // Messages are sent in the same order they were pushed
+    queue.pop();
+    BOOST_CHECK_EQUAL(queue.size(), 999);
+    BOOST_CHECK_EQUAL(queue.bytes(), 3996);
+
+    // No policy should have fired
+    BOOST_CHECK_EQUAL(counters.disconnections, 0);
+    BOOST_CHECK_EQUAL(counters.droppedMessages, 0);
+    BOOST_CHECK_EQUAL(counters.pauses, 0);
+}
+
+BOOST_AUTO_TEST_CASE(Disconnect) {
+    OutboundQueue queue;
+    SlowClientCounters counters;
+    const OutboundQueueLimits limits { 2, 0, SlowClientPolicy::Disconnect };
+
+    BOOST_CHECK(!queue.push(message("a"), true, limits, counters));
+    BOOST_CHECK(!queue.push(message("b"), true, limits, counters));
+    // 3rd message exceeds limit of 2 messages
+    BOOST_CHECK(queue.push(message("c"), true, limits, counters));
+    BOOST_CHECK_EQUAL(counters.disconnections, 1);
+
+    // Only message which might be currently sent should be kept
+    queue.discardPending();
+    BOOST_CHECK_EQUAL(queue.size(), 1);
+    BOOST_CHECK_EQUAL(queue.bytes(), 1);
+    BOOST_CHECK_EQUAL(*queue.front(), "a");
+}
+
+BOOST_AUTO_TEST_CASE(DisconnectSingleMessageLimit) {
+    OutboundQueue queue;
+    SlowClientCounters counters;
+    const OutboundQueueLimits limits { 1, 0, SlowClientPolicy::Disconnect };
+
+    BOOST_CHECK(!queue.push(message("a"), true, limits, counters));
+    BOOST_CHECK(queue.push(message("b"), true, limits, counters));
+    BOOST_CHECK_EQUAL(counters.disconnections, 1);
+
+    queue.discardPending();
+    // Killed client is notified about disconnection even if front message is still queued
+    queue.pushFinal(message("INTERRUPT Outbound queue limits exceeded"));
+
+    BOOST_CHECK_EQUAL(queue.size(), 2);
+    BOOST_CHECK_EQUAL(queue.bytes(), 41);
+    // Disconnection is counted once
+    BOOST_CHECK_EQUAL(counters.disconnections, 1);
+
+    queue.pop();
+    BOOST_CHECK_EQUAL(*queue.front(), "INTERRUPT Outbound queue limits exceeded");
+}
+
+BOOST_AUTO_TEST_CASE(DropOldest) {
+    OutboundQueue queue;
+    SlowClientCounters counters;
+    // Limited to 8 bytes
+    const OutboundQueueLimits limits { 0, 8, SlowClientPolicy::DropOldest };
+
+    BOOST_CHECK(!queue.push(message("aa"), true, limits, counters)); // Being sent, never dropped
+    BOOST_CHECK(!queue.push(message("bb"), false, limits, counters)); // Not droppable
+    BOOST_CHECK(!queue.push(message("cc"), true, limits, counters));
+    BOOST_CHECK(!queue.push(message("dd"), true, limits, counters));
+    // Exceeds 8 bytes, oldest droppable message "cc" should be dropped
+    BOOST_CHECK(!queue.push(message("ee"), true, limits, counters));
+
+    BOOST_CHECK_EQUAL(counters.droppedMessages, 1);
+    BOOST_CHECK_EQUAL(counters.disconnections, 0);
+    BOOST_CHECK_EQUAL(queue.size(), 4);
+    BOOST_CHECK_EQUAL(queue.bytes(), 8);
+
+    const std::array<std::string_view, 4> expected_messages { "aa", "bb", "dd", "ee" };
+    for (const std::string_view expected : expected_messages) {
+        BOOST_CHECK_EQUAL(*queue.front(), expected);
+        queue.pop();
+    }
+}
+
+BOOST_AUTO_TEST_CASE(DropOldestWithoutDroppable) {
+    OutboundQueue queue;
+    SlowClientCounters counters;
+    const OutboundQueueLimits limits { 2, 0, SlowClientPolicy::DropOldest };
+
+    BOOST_CHECK(!queue.push(message("a"), true, limits, counters));
+    BOOST_CHECK(!queue.push(message("b"), false, limits, counters));
+    // Front message and non-droppable message can't be dropped, so client must be disconnected
+    BOOST_CHECK(queue.push(message("c"), false, limits, counters));
+
+    BOOST_CHECK_EQUAL(counters.droppedMessages, 0);
+    BOOST_CHECK_EQUAL(counters.disconnections, 1);
+}
+
+BOOST_AUTO_TEST_CASE(Pause) {
+    OutboundQueue queue;
+    SlowClientCounters counters;
+    const OutboundQueueLimits limits { 2, 0, SlowClientPolicy::Pause };
+
+    BOOST_CHECK(!queue.push(message("a"), true, limits, counters));
+    BOOST_CHECK(!queue.push(message("b"), true, limits, counters));
+    // Exceeds limits, client should be paused
+    BOOST_CHECK(!queue.push(message("c"), true, limits, counters));
+    BOOST_CHECK(queue.paused());
+    BOOST_CHECK_EQUAL(counters.pauses, 1);
+
+    // Droppable messages no longer queued while paused, but others still are
+    BOOST_CHECK(!queue.push(message("d"), true, limits, counters));
+    BOOST_CHECK(!queue.push(message("e"), false, limits, counters));
+    BOOST_CHECK_EQUAL(counters.droppedMessages, 1);
+    BOOST_CHECK_EQUAL(counters.disconnections, 0);
+    BOOST_CHECK_EQUAL(queue.size(), 4);
+
+    // Client is still paused until it has been caught up with every queued message
+    for (int i { 0 }; i < 3; i++) {
+        queue.pop();
+        BOOST_CHECK(queue.paused());
+    }
+
+    queue.pop();
+    BOOST_CHECK(queue.empty());
+    BOOST_CHECK(!queue.paused());
+
+    // Droppable messages should now be queued again
+    BOOST_CHECK(!queue.push(message("f"), true, limits, counters));
+    BOOST_CHECK_EQUAL(queue.size(), 1);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,93 @@
+#include <RpT-Testing/TestingUtils.hpp>
+
+#include <RpT-Utils/PrometheusWriter.hpp>
+
+
+using namespace RpT::Utils;
+
+
+BOOST_AUTO_TEST_SUITE(PrometheusWriterTests)
+
+BOOST_AUTO_TEST_CASE(Empty) {
+    const PrometheusWriter writer;
+
+    BOOST_CHECK_EQUAL(writer.str(), "");
+}
+
+BOOST_AUTO_TEST_CASE(Family) {
+    PrometheusWriter writer;
+    writer.family("rpt_connected_clients", MetricType::Gauge, "Clients currently connected.");
+    writer.sample("rpt_connected_clients", std::uint64_t { 42 });
+
+    BOOST_CHECK_EQUAL(writer.str(),
+                      "# HELP rpt_connected_clients Clients currently connected.\n"
+                      "# TYPE rpt_connected_clients gauge\n"
+                      "rpt_connected_clients 42\n");
+}
+
+BOOST_AUTO_TEST_CASE(Labels) {
+    PrometheusWriter writer;
+    writer.sample("rpt_requests_total", std::uint64_t { 1 }, { { "service", "Chat" }, { "result", "ok" } });
+    writer.sample("rpt_requests_total", std::uint64_t { 2 }, { { "service", "Chat" } });
+
+    BOOST_CHECK_EQUAL(writer.str(),
+                      "rpt_requests_total{service=\"Chat\",result=\"ok\"} 1\n"
+                      "rpt_requests_total{service=\"Chat\"} 2\n");
+}
+
+BOOST_AUTO_TEST_CASE(EscapedLabelValue) {
+    PrometheusWriter writer;
+    writer.sample("rpt_requests_total", std::uint64_t { 1 }, { { "service", "A \"B\"\\C\nD" } });
+
+    BOOST_CHECK_EQUAL(writer.str(), "rpt_requests_total{service=\"A \\\"B\\\"\\\\C\\nD\"} 1\n");
+}
+
+BOOST_AUTO_TEST_CASE(LargeCounter) {
+    PrometheusWriter writer;
+    writer.sample("rpt_messages_total", std::uint64_t { 12345678901234 });
+
+    // Integer values mustn't be formatted using scientific notation
+    BOOST_CHECK_EQUAL(writer.str(), "rpt_messages_total 12345678901234\n");
+}
+
+BOOST_AUTO_TEST_CASE(FloatingPoint) {
+    PrometheusWriter writer;
+    writer.sample("rpt_latency_seconds", 0.000123456);
+
+    BOOST_CHECK_EQUAL(writer.str(), "rpt_latency_seconds 0.000123456\n");
+}
+
+BOOST_AUTO_TEST_CASE(EmptySummary) {
+    PrometheusWriter writer;
+    writer.summary("rpt_latency_seconds", "Latency.", LatencyHistogram {});
+
+    BOOST_CHECK_EQUAL(writer.str(),
+                      "# HELP rpt_latency_seconds Latency.\n"
+                      "# TYPE rpt_latency_seconds summary\n"
+                      "rpt_latency_seconds{quantile=\"0.5\"} 0\n"
+                      "rpt_latency_seconds{quantile=\"0.9\"} 0\n"
+                      "rpt_latency_seconds{quantile=\"0.99\"} 0\n"
+                      "rpt_latency_seconds_sum 0\n"
+                      "rpt_latency_seconds_count 0\n");
+}
+
+BOOST_AUTO_TEST_CASE(Summary) {
+    LatencyHistogram latencies;
+    // Exact values, so reported quantiles are exact
+    for (std::uint64_t nanoseconds { 1 }; nanoseconds <= 100; nanoseconds++)
+        latencies.record(nanoseconds);
+
+    PrometheusWriter writer;
+    writer.summary("rpt_latency_seconds", "Latency.", latencies);
+
+    BOOST_CHECK_EQUAL(writer.str(),
+                      "# HELP rpt_latency_seconds Latency.\n"
+                      "# TYPE rpt_latency_seconds summary\n"
+                      "rpt_latency_seconds{quantile=\"0.5\"} 5e-08\n"
+                      "rpt_latency_seconds{quantile=\"0.9\"} 9e-08\n"
+                      "rpt_latency_seconds{quantile=\"0.99\"} 9.9e-08\n"
+                      "rpt_latency_seconds_sum 5.05e-06\n"
+                      "rpt_latency_seconds_count 100\n");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
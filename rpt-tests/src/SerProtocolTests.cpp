@@ -157,6 +157,87 @@ BOOST_AUTO_TEST_CASE(SomeServiceAndTwiceSameInstance) {
                       ServiceNameAlreadyRegistered);
 }
 
+BOOST_AUTO_TEST_CASE(ServicesVector) {
+    const std::vector<std::reference_wrapper<Service>> services { svc_a, svc_b, svc_c };
+    const ServiceEventRequestProtocol ser_protocol { services, logging_context };
+
+    // Checks if service is registered
+    BOOST_CHECK(ser_protocol.isRegistered("ServiceA"));
+    BOOST_CHECK(ser_protocol.isRegistered("ServiceB"));
+    BOOST_CHECK(ser_protocol.isRegistered("ServiceC"));
+    // Check if unknown service is unregistered
+    BOOST_CHECK(!ser_protocol.isRegistered("NonexistentService"));
+}
+
+BOOST_AUTO_TEST_CASE(ServicesVectorAndTwiceSameName) {
+    ServiceA svc_a_bis { context };
+    const std::vector<std::reference_wrapper<Service>> services { svc_a, svc_b, svc_c, svc_a_bis };
+
+    // Checks if exception is thrown as svc_a_bis and svc_a both have name "ServiceA"
+    BOOST_CHECK_THROW((ServiceEventRequestProtocol { services, logging_context }), ServiceNameAlreadyRegistered);
+}
+
+BOOST_AUTO_TEST_CASE(SomeServicesAndAnotherContext) {
+    ServiceContext another_context;
+    ServiceC svc_c_bis { another_context };
+
+    // Checks if exception is thrown as svc_c_bis events would never be polled
+    BOOST_CHECK_THROW((ServiceEventRequestProtocol { { svc_a, svc_b, svc_c_bis }, logging_context }),
+                      ServicesContextMismatch);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+/*
+ * Shared services context
+ */
+
+BOOST_AUTO_TEST_SUITE(SharedContext)
+
+BOOST_AUTO_TEST_CASE(TwoProtocolsOnSameContext) {
+    {
+        ServiceEventRequestProtocol ser_protocol { { svc_a, svc_b }, logging_context };
+        svc_a.handleRequestCommand(1, {});
+
+        // ServiceC runs inside context already polled by first instance, which would miss events polled by second one
+        BOOST_CHECK_THROW((ServiceEventRequestProtocol { { svc_c }, logging_context }), ServicesContextAlreadyAttached);
+
+        // So first instance events aren't lost
+        RpT::Testing::boostCheckOptionalsEqual(ser_protocol.pollServiceEvent(),
+                                               std::optional<std::string> { "EVENT ServiceA 1" });
+    } // Context is detached
+
+    ServiceEventRequestProtocol other_ser_protocol { { svc_c }, logging_context };
+    svc_c.handleRequestCommand(2, {});
+
+    RpT::Testing::boostCheckOptionalsEqual(other_ser_protocol.pollServiceEvent(),
+                                           std::optional<std::string> { "EVENT ServiceC 2" });
+}
+
+BOOST_AUTO_TEST_CASE(FailedConstructionDoesNotAttach) {
+    BOOST_CHECK_THROW((ServiceEventRequestProtocol { { svc_a, svc_a }, logging_context }),
+                      ServiceNameAlreadyRegistered);
+
+    // Context can still be attached by a valid instance
+    BOOST_CHECK(!context.attached());
+    BOOST_CHECK_NO_THROW((ServiceEventRequestProtocol { { svc_a }, logging_context }));
+}
+
+BOOST_AUTO_TEST_CASE(EventsFromUnregisteredService) {
+    // ServiceC runs inside same context, but isn't registered by this SER Protocol
+    ServiceEventRequestProtocol ser_protocol { { svc_a, svc_b }, logging_context };
+
+    svc_c.handleRequestCommand(1, {});
+    svc_a.handleRequestCommand(2, {});
+    svc_c.handleRequestCommand(3, {});
+
+    // Events from ServiceC are discarded, as no other SER Protocol could poll them
+    RpT::Testing::boostCheckOptionalsEqual(ser_protocol.pollServiceEvent(),
+                                           std::optional<std::string> { "EVENT ServiceA 2" });
+    RpT::Testing::boostCheckOptionalsEqual(ser_protocol.pollServiceEvent(), std::optional<std::string> {});
+    BOOST_CHECK(context.empty());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 /*
@@ -200,6 +281,24 @@ BOOST_AUTO_TEST_CASE(RightPrefixServiceBNonemptyCommand) {
     BOOST_CHECK_EQUAL(svc_b.lastCommandActor(), 1);
 }
 
+BOOST_AUTO_TEST_CASE(DecodedUnknownServiceName) {
+    // Service must be registered, even if request hasn't been parsed
+    BOOST_CHECK_THROW(ser_protocol.handleServiceRequest(0, 2, "NonexistentService", "args"), ServiceNotFound);
+}
+
+BOOST_AUTO_TEST_CASE(DecodedServiceCEmptyCommand) {
+    // Decoded request is handled as a SR command would, with the same SRR
+    BOOST_CHECK_EQUAL(ser_protocol.handleServiceRequest(3, 18446744073709551615u, "ServiceC", ""),
+                      "RESPONSE 18446744073709551615 KO Empty");
+    BOOST_CHECK_EQUAL(svc_c.lastCommandActor(), 3);
+}
+
+BOOST_AUTO_TEST_CASE(DecodedServiceCNonemptyCommand) {
+    // Command data containing separators is passed as is to service
+    BOOST_CHECK_EQUAL(ser_protocol.handleServiceRequest(3, 7, "ServiceC", " Some  random arguments"), "RESPONSE 7 OK");
+    BOOST_CHECK_EQUAL(svc_c.lastCommandActor(), 3);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 /*
@@ -255,6 +354,23 @@ BOOST_AUTO_TEST_CASE(ManyEventsInEveryQueues) {
                                            std::optional<std::string> { "EVENT ServiceC 6" });
 }
 
+BOOST_AUTO_TEST_CASE(EventsEmittedWhilePolling) {
+    svc_a.handleRequestCommand(1, {});
+    svc_b.handleRequestCommand(2, {});
+
+    RpT::Testing::boostCheckOptionalsEqual(ser_protocol.pollServiceEvent(),
+                                           std::optional<std::string> { "EVENT ServiceA 1" });
+
+    // Emitted after remaining event, so polled after it
+    svc_a.handleRequestCommand(3, {});
+
+    RpT::Testing::boostCheckOptionalsEqual(ser_protocol.pollServiceEvent(),
+                                           std::optional<std::string> { "EVENT ServiceB 2" });
+    RpT::Testing::boostCheckOptionalsEqual(ser_protocol.pollServiceEvent(),
+                                           std::optional<std::string> { "EVENT ServiceA 3" });
+    RpT::Testing::boostCheckOptionalsEqual(ser_protocol.pollServiceEvent(), std::optional<std::string> {});
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 BOOST_AUTO_TEST_SUITE_END()
@@ -14,6 +14,19 @@ BOOST_AUTO_TEST_CASE(DefaultConstructed) {
     BOOST_CHECK_EQUAL(context.newEventPushed(), 0);
     BOOST_CHECK_EQUAL(context.newEventPushed(), 1);
     BOOST_CHECK_EQUAL(context.newEventPushed(), 2);
+    // IDs aren't pushed events
+    BOOST_CHECK(context.empty());
+    BOOST_CHECK_THROW(context.pollEvent(), EmptyEventsQueue);
+}
+
+BOOST_AUTO_TEST_CASE(AttachAndDetach) {
+    ServiceContext context;
+    BOOST_CHECK(!context.attached());
+
+    context.attach();
+    BOOST_CHECK(context.attached());
+    context.detach();
+    BOOST_CHECK(!context.attached());
 }
 
 BOOST_AUTO_TEST_SUITE_END()
@@ -22,15 +35,19 @@ BOOST_AUTO_TEST_SUITE_END()
 /**
  * @brief Basic implementation to build Service class and test its defined methods
  *
- * `name()` returns empty string and `handleRequestCommand()` fires event with actor as event command, then returns
- * successfully.
+ * `name()` returns name given at construction and `handleRequestCommand()` fires event with actor as event command,
+ * then returns successfully.
  */
 class TestingService : public Service {
+private:
+    std::string_view name_;
+
 public:
-    explicit TestingService(ServiceContext& run_context) : Service { run_context } {}
+    TestingService(ServiceContext& run_context, const std::string_view name)
+            : Service { run_context }, name_ { name } {}
 
     std::string_view name() const override {
-        return "";
+        return name_;
     }
 
     RpT::Utils::HandlingResult handleRequestCommand(uint64_t actor,
@@ -44,30 +61,35 @@ public:
 
 
 /**
- * @brief Provides `TestingService` instance with just initialized `ServiceContext` required for Service construction.
+ * @brief Provides `TestingService` instances with just initialized `ServiceContext` required for Service
+ * construction.
  */
 class ServiceTestFixture {
-private:
-    ServiceContext context_;
-
 public:
+    ServiceContext context;
     TestingService service;
+    TestingService other_service;
 
-    ServiceTestFixture() : context_ {}, service { context_ } {}
+    ServiceTestFixture() : context {}, service { context, "Service" }, other_service { context, "OtherService" } {}
 };
 
 
 BOOST_FIXTURE_TEST_SUITE(ServiceTests, ServiceTestFixture)
 
+BOOST_AUTO_TEST_CASE(RunContext) {
+    BOOST_CHECK_EQUAL(&service.runContext(), &context);
+}
+
 /*
- * Empty queue Service
+ * Empty events log
  */
 
 BOOST_AUTO_TEST_CASE(EmptyQueue) {
-    // At construction, queue must be empty
-    BOOST_CHECK(!service.checkEvent().has_value());
+    // At construction, log must be empty
+    BOOST_CHECK(context.empty());
+    BOOST_CHECK_EQUAL(context.pendingCount(), 0);
     // So polling event should throw error
-    BOOST_CHECK_THROW(service.pollEvent(), EmptyEventsQueue);
+    BOOST_CHECK_THROW(context.pollEvent(), EmptyEventsQueue);
 }
 
 /*
@@ -77,33 +99,92 @@ BOOST_AUTO_TEST_CASE(EmptyQueue) {
 BOOST_AUTO_TEST_CASE(OneQueuedEvent) {
     // Triggers one event (see TestingService doc)
     service.handleRequestCommand(42, {});
-    // Checks if event was triggered with correct ID
-    RpT::Testing::boostCheckOptionalsEqual(service.checkEvent(), std::optional<std::size_t> { 0 });
-    // Checks if event command is correctly retrieved
-    BOOST_CHECK_EQUAL(service.pollEvent(), "42");
-    // There should not be any event still in queue
-    BOOST_CHECK(!service.checkEvent().has_value());
+    BOOST_CHECK_EQUAL(context.pendingCount(), 1);
+
+    // Checks if event was triggered with correct ID, emitter and command
+    const ServiceContext::EmittedEvent event { context.pollEvent() };
+    BOOST_CHECK_EQUAL(event.id, 0);
+    BOOST_CHECK_EQUAL(event.service, service.id());
+    BOOST_CHECK_EQUAL(event.command, "42");
+    // There should not be any event still in log
+    BOOST_CHECK(context.empty());
 }
 
 /*
- * Many events triggered Service
+ * Many events triggered by Services
  */
 
 BOOST_AUTO_TEST_CASE(ManyQueuedEvents) {
-    // Push 3 events
+    // Push 3 events, alternating emitters
     for (int i { 0 }; i < 3; i++)
-        service.handleRequestCommand(i, {});
+        (i % 2 == 0 ? service : other_service).handleRequestCommand(i, {});
 
-    // Checks for each event in queue
+    // Checks for each event in log, polled in emission order whichever service emitted it
     for (int i { 0 }; i < 3; i++) {
-        // Checks for correct order with event ID
-        RpT::Testing::boostCheckOptionalsEqual(service.checkEvent(), std::optional<std::size_t> { i });
-        // Checks for correct event command
-        BOOST_CHECK_EQUAL(service.pollEvent(), std::to_string(i));
+        const ServiceContext::EmittedEvent event { context.pollEvent() };
+
+        BOOST_CHECK_EQUAL(event.id, i);
+        BOOST_CHECK_EQUAL(event.service, (i % 2 == 0 ? service : other_service).id());
+        BOOST_CHECK_EQUAL(event.command, std::to_string(i));
+    }
+
+    // Now, log should be empty
+    BOOST_CHECK(context.empty());
+}
+
+BOOST_AUTO_TEST_CASE(EventsPushedWhilePolling) {
+    // Log is never completely polled, so polled events are erased while events are pushed
+    for (int i { 0 }; i < 100; i++) {
+        service.handleRequestCommand(2 * i, {});
+        service.handleRequestCommand(2 * i + 1, {});
+
+        BOOST_CHECK_EQUAL(context.pollEvent().command, std::to_string(i));
     }
 
-    // Now, queue should be empty
-    BOOST_CHECK(!service.checkEvent().has_value());
+    BOOST_CHECK_EQUAL(context.pendingCount(), 100);
+    for (int i { 100 }; i < 200; i++)
+        BOOST_CHECK_EQUAL(context.pollEvent().command, std::to_string(i));
+
+    BOOST_CHECK(context.empty());
+}
+
+BOOST_AUTO_TEST_CASE(ServicesIds) {
+    // IDs are given in construction order
+    BOOST_CHECK_EQUAL(service.id(), 0);
+    BOOST_CHECK_EQUAL(other_service.id(), 1);
+    BOOST_CHECK_EQUAL(context.servicesCount(), 2);
+
+    {
+        TestingService destroyed_service { context, "DestroyedService" };
+        BOOST_CHECK_EQUAL(destroyed_service.id(), 2);
+
+        destroyed_service.handleRequestCommand(42, {});
+    } // Emitter no longer exists
+
+    // Event still refers to its emitter, and IDs aren't reused
+    BOOST_CHECK_EQUAL(context.pollEvent().service, 2);
+    BOOST_CHECK_EQUAL((TestingService { context, "NewService" }.id()), 3);
+}
+
+BOOST_AUTO_TEST_CASE(PendingEventsRange) {
+    BOOST_CHECK(context.pendingEvents().empty());
+
+    for (int i { 0 }; i < 3; i++)
+        (i % 2 == 0 ? service : other_service).handleRequestCommand(i, {});
+
+    context.pollEvent();
+
+    // Only events which haven't been polled yet, in emission order
+    const ServiceContext::EventsRange pending_events { context.pendingEvents() };
+    BOOST_CHECK_EQUAL(pending_events.size(), context.pendingCount());
+    BOOST_CHECK_EQUAL(pending_events.size(), 2);
+    BOOST_CHECK_EQUAL(pending_events[0].id, 1);
+    BOOST_CHECK_EQUAL(pending_events[0].service, other_service.id());
+    BOOST_CHECK_EQUAL(pending_events[1].id, 2);
+    BOOST_CHECK_EQUAL(pending_events[1].command, "2");
+
+    // Reading range doesn't poll events
+    BOOST_CHECK_EQUAL(context.pollEvent().id, 1);
 }
 
 BOOST_AUTO_TEST_SUITE_END()
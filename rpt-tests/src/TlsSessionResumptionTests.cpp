@@ -0,0 +1,192 @@
+#include <RpT-Testing/TestingUtils.hpp>
+
+#include <memory>
+#include <stdexcept>
+#include <openssl/x509.h>
+#include <RpT-Network/TlsSessionResumption.hpp>
+
+
+using namespace RpT::Network;
+
+
+/// Owns OpenSSL session, freed at destruction
+using SessionOwner = std::unique_ptr<SSL_SESSION, decltype(&SSL_SESSION_free)>;
+
+
+/// Makes server context using a newly generated EC key with a self-signed certificate
+std::unique_ptr<boost::asio::ssl::context> selfSignedServerContext() {
+    auto server_context { std::make_unique<boost::asio::ssl::context>(boost::asio::ssl::context::tls_server) };
+
+    std::unique_ptr<EVP_PKEY_CTX, decltype(&EVP_PKEY_CTX_free)> key_generation {
+        EVP_PKEY_CTX_new_id(EVP_PKEY_EC, nullptr), EVP_PKEY_CTX_free
+    };
+
+    EVP_PKEY* generated_key { nullptr };
+    EVP_PKEY_keygen_init(key_generation.get());
+    EVP_PKEY_CTX_set_ec_paramgen_curve_nid(key_generation.get(), NID_X9_62_prime256v1);
+    EVP_PKEY_keygen(key_generation.get(), &generated_key);
+    const std::unique_ptr<EVP_PKEY, decltype(&EVP_PKEY_free)> key { generated_key, EVP_PKEY_free };
+
+    const std::unique_ptr<X509, decltype(&X509_free)> certificate { X509_new(), X509_free };
+    ASN1_INTEGER_set(X509_get_serialNumber(certificate.get()), 1);
+    X509_gmtime_adj(X509_getm_notBefore(certificate.get()), 0);
+    X509_gmtime_adj(X509_getm_notAfter(certificate.get()), 3600);
+    X509_set_pubkey(certificate.get(), key.get());
+
+    X509_NAME* subject { X509_get_subject_name(certificate.get()) };
+    X509_NAME_add_entry_by_txt(subject, "CN", MBSTRING_ASC, reinterpret_cast<const unsigned char*>("localhost"),
+                               -1, -1, 0);
+    X509_set_issuer_name(certificate.get(), subject); // Self-signed
+    X509_sign(certificate.get(), key.get(), EVP_sha256());
+
+    SSL_CTX_use_certificate(server_context->native_handle(), certificate.get());
+    SSL_CTX_use_PrivateKey(server_context->native_handle(), key.get());
+
+    return server_context;
+}
+
+/// Makes client context which doesn't verify server certificate, restricted to given TLS version
+boost::asio::ssl::context clientContext(const int tls_version) {
+    boost::asio::ssl::context client_context { boost::asio::ssl::context::tls_client };
+
+    SSL_CTX_set_min_proto_version(client_context.native_handle(), tls_version);
+    SSL_CTX_set_max_proto_version(client_context.native_handle(), tls_version);
+
+    return client_context;
+}
+
+/**
+ * @brief Performs handshake between new client and server sessions over in-memory transport
+ *
+ * @param client_context Context for client session
+ * @param server_context Context for server session
+ * @param previous_session Session client tries to resume, if not null
+ *
+ * @returns Session client might resume for next handshake, and if server resumed previous session
+ */
+std::pair<SessionOwner, bool> handshake(boost::asio::ssl::context& client_context,
+                                        boost::asio::ssl::context& server_context,
+                                        SSL_SESSION* previous_session = nullptr) {
+
+    const std::unique_ptr<SSL, decltype(&SSL_free)> client { SSL_new(client_context.native_handle()), SSL_free };
+    const std::unique_ptr<SSL, decltype(&SSL_free)> server { SSL_new(server_context.native_handle()), SSL_free };
+
+    BIO* client_transport;
+    BIO* server_transport;
+    BIO_new_bio_pair(&client_transport, 0, &server_transport, 0);
+    // Sessions take ownership of their transport
+    SSL_set_bio(client.get(), client_transport, client_transport);
+    SSL_set_bio(server.get(), server_transport, server_transport);
+
+    SSL_set_connect_state(client.get());
+    SSL_set_accept_state(server.get());
+
+    if (previous_session != nullptr)
+        SSL_set_session(client.get(), previous_session);
+
+    bool client_done { false };
+    bool server_done { false };
+    // Each side writes then reads at most a few flights
+    for (int flight { 0 }; flight < 8 && !(client_done && server_done); flight++) {
+        if (!client_done)
+            client_done = SSL_do_handshake(client.get()) == 1;
+        if (!server_done)
+            server_done = SSL_do_handshake(server.get()) == 1;
+    }
+
+    if (!client_done || !server_done)
+        throw std::runtime_error { "TLS handshake failed" };
+
+    // With TLS 1.3, tickets are sent after handshake, so client must read them
+    char ignored_byte;
+    SSL_read(client.get(), &ignored_byte, 1);
+
+    // Sessions not properly shut down are considered bad and removed from cache
+    SSL_shutdown(client.get());
+    SSL_shutdown(server.get());
+
+    return { SessionOwner { SSL_get1_session(client.get()), SSL_SESSION_free }, SSL_session_reused(server.get()) == 1 };
+}
+
+
+BOOST_AUTO_TEST_SUITE(TlsSessionResumptionTests)
+
+BOOST_AUTO_TEST_CASE(InvalidOptions) {
+    boost::asio::ssl::context server_context { boost::asio::ssl::context::tls_server };
+
+    TlsSessionOptions no_lifetime;
+    no_lifetime.lifetime = std::chrono::seconds { 0 };
+    BOOST_CHECK_THROW((TlsSessionResumption { server_context, no_lifetime }), std::invalid_argument);
+
+    TlsSessionOptions no_rotation;
+    no_rotation.ticketKeysRotation = std::chrono::seconds { 0 };
+    BOOST_CHECK_THROW((TlsSessionResumption { server_context, no_rotation }), std::invalid_argument);
+
+    // Options are ignored if resumption is disabled
+    no_lifetime.enabled = false;
+    BOOST_CHECK_NO_THROW((TlsSessionResumption { server_context, no_lifetime }));
+}
+
+BOOST_AUTO_TEST_CASE(ResumedWithTicket) {
+    const auto server_context { selfSignedServerContext() };
+    const TlsSessionResumption resumption { *server_context, {} };
+    auto client_context { clientContext(TLS1_3_VERSION) };
+
+    // First connection requires a full handshake
+    const auto [first_session, first_resumed] { handshake(client_context, *server_context) };
+    BOOST_CHECK(!first_resumed);
+
+    // Reconnection should resume session using received ticket
+    const auto [second_session, second_resumed] { handshake(client_context, *server_context, first_session.get()) };
+    BOOST_CHECK(second_resumed);
+}
+
+BOOST_AUTO_TEST_CASE(ResumedFromCache) {
+    const auto server_context { selfSignedServerContext() };
+    const TlsSessionResumption resumption { *server_context, {} };
+    // TLS 1.2 client without tickets support, session ID must be looked up inside server-side cache
+    auto client_context { clientContext(TLS1_2_VERSION) };
+    SSL_CTX_set_options(client_context.native_handle(), SSL_OP_NO_TICKET);
+
+    const auto [first_session, first_resumed] { handshake(client_context, *server_context) };
+    BOOST_CHECK(!first_resumed);
+
+    const auto [second_session, second_resumed] { handshake(client_context, *server_context, first_session.get()) };
+    BOOST_CHECK(second_resumed);
+}
+
+BOOST_AUTO_TEST_CASE(UnknownTicketKey) {
+    const auto first_server_context { selfSignedServerContext() };
+    const TlsSessionResumption first_resumption { *first_server_context, {} };
+    const auto second_server_context { selfSignedServerContext() };
+    const TlsSessionResumption second_resumption { *second_server_context, {} };
+    auto client_context { clientContext(TLS1_3_VERSION) };
+
+    const auto [first_session, first_resumed] { handshake(client_context, *first_server_context) };
+
+    // Ticket encrypted by another server keys cannot be decrypted, so a full handshake is done
+    const auto [second_session, second_resumed] {
+        handshake(client_context, *second_server_context, first_session.get())
+    };
+    BOOST_CHECK(!second_resumed);
+}
+
+BOOST_AUTO_TEST_CASE(Disabled) {
+    const auto server_context { selfSignedServerContext() };
+    TlsSessionOptions disabled;
+    disabled.enabled = false;
+    const TlsSessionResumption resumption { *server_context, disabled };
+
+    for (const int tls_version : { TLS1_2_VERSION, TLS1_3_VERSION }) {
+        auto client_context { clientContext(tls_version) };
+
+        const auto [first_session, first_resumed] { handshake(client_context, *server_context) };
+        const auto [second_session, second_resumed] {
+            handshake(client_context, *server_context, first_session.get())
+        };
+
+        BOOST_CHECK(!second_resumed);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,175 @@
+#ifndef RPTOGETHER_SERVER_LATENCYHISTOGRAM_HPP
+#define RPTOGETHER_SERVER_LATENCYHISTOGRAM_HPP
+
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+/**
+ * @file LatencyHistogram.hpp
+ */
+
+
+namespace RpT::Utils {
+
+
+/**
+ * @brief Thrown by `LatencyHistogram::percentile()` if given percentile isn't inside 0..100
+ *
+ * @author ThisALV, https://github.com/ThisALV
+ */
+class InvalidPercentile : public std::invalid_argument {
+public:
+    /**
+     * @brief Constructs exception with basic error message
+     */
+    InvalidPercentile() : std::invalid_argument { "Percentile must be included inside 0..100" } {}
+};
+
+
+/**
+ * @brief Records unsigned integer values, typically latencies, with a fixed memory footprint and a bounded relative
+ * error, then computes percentiles from recorded values
+ *
+ * Values are counted inside log-linear buckets, as HDR histograms do: values below `2^PRECISION_BITS` have their own
+ * bucket, then each power of 2 range is divided into `2^(PRECISION_BITS - 1)` buckets of equal width. Any 64 bits
+ * value can be recorded in constant time without allocation, and reported values are at most `2^-(PRECISION_BITS - 1)`
+ * above actual values. Minimum, maximum and mean values are exact.
+ *
+ * Unit is up to the caller, it is the same for recorded and reported values.
+ *
+ * @author ThisALV, https://github.com/ThisALV
+ */
+class LatencyHistogram {
+public:
+    /// Bits of precision for each recorded value, which gives a relative error below 1%
+    static constexpr unsigned int PRECISION_BITS { 8 };
+
+private:
+    /// Values having their own bucket, also first value for buckets shared by several values
+    static constexpr std::uint64_t EXACT_VALUES { std::uint64_t { 1 } << PRECISION_BITS };
+    /// Buckets for each power of 2 range above exact values
+    static constexpr std::uint64_t HALF_EXACT_VALUES { EXACT_VALUES / 2 };
+    /// Exact values buckets, then buckets for each power of 2 range up to 64 bits values
+    static constexpr std::size_t BUCKETS_COUNT { EXACT_VALUES + (64 - PRECISION_BITS) * HALF_EXACT_VALUES };
+
+    /// Retrieves index for the highest bit set of given non-null value
+    static constexpr unsigned int highestBit(std::uint64_t value) {
+        unsigned int highest_bit { 0 };
+
+        // Binary search inside 64 bits, halving range at each step
+        for (unsigned int range { 32 }; range > 0; range /= 2) {
+            if (value >> range != 0) {
+                value >>= range;
+                highest_bit += range;
+            }
+        }
+
+        return highest_bit;
+    }
+
+    /// Retrieves bucket counting given value
+    static constexpr std::size_t bucketOf(const std::uint64_t value) {
+        if (value < EXACT_VALUES)
+            return value;
+
+        // Only highest PRECISION_BITS bits are kept, so significant bits are inside HALF_EXACT_VALUES..EXACT_VALUES
+        const unsigned int shift { highestBit(value) - PRECISION_BITS + 1 };
+        const std::uint64_t significant_bits { value >> shift };
+
+        return EXACT_VALUES + (shift - 1) * HALF_EXACT_VALUES + (significant_bits - HALF_EXACT_VALUES);
+    }
+
+    /// Retrieves highest value counted by given bucket
+    static constexpr std::uint64_t highestValueOf(const std::size_t bucket) {
+        if (bucket < EXACT_VALUES)
+            return bucket;
+
+        const std::size_t shared_bucket { bucket - EXACT_VALUES };
+        const unsigned int shift { static_cast<unsigned int>(shared_bucket / HALF_EXACT_VALUES) + 1 };
+        const std::uint64_t significant_bits { shared_bucket % HALF_EXACT_VALUES + HALF_EXACT_VALUES };
+
+        // Every value with these significant bits, whatever its lowest bits are
+        return (significant_bits << shift) | ((std::uint64_t { 1 } << shift) - 1);
+    }
+
+    std::vector<std::uint64_t> buckets_;
+    std::uint64_t count_;
+    std::uint64_t min_;
+    std::uint64_t max_;
+    // Sum might overflow for long recordings, so mean is computed with floating point
+    long double sum_;
+
+public:
+    /**
+     * @brief Constructs histogram without any recorded value
+     */
+    LatencyHistogram();
+
+    /**
+     * @brief Counts given value
+     *
+     * @param value Value to record
+     */
+    void record(std::uint64_t value);
+
+    /**
+     * @brief Counts every value recorded by given histogram, as if they had been recorded by this one
+     *
+     * @param other Histogram which recorded values are added to this one
+     */
+    void merge(const LatencyHistogram& other);
+
+    /**
+     * @brief Discards every recorded value
+     */
+    void reset();
+
+    /**
+     * @brief Retrieves how many values were recorded
+     *
+     * @returns Count of recorded values
+     */
+    std::uint64_t count() const;
+
+    /**
+     * @brief Retrieves lowest recorded value
+     *
+     * @returns Exact lowest value, or 0 if no value was recorded
+     */
+    std::uint64_t min() const;
+
+    /**
+     * @brief Retrieves highest recorded value
+     *
+     * @returns Exact highest value, or 0 if no value was recorded
+     */
+    std::uint64_t max() const;
+
+    /**
+     * @brief Retrieves mean of recorded values
+     *
+     * @returns Exact mean value, or 0 if no value was recorded
+     */
+    double mean() const;
+
+    /**
+     * @brief Retrieves value which given percentage of recorded values are lower than or equal to
+     *
+     * Reported value is the highest value inside bucket where percentile is, so it is never lower than actual value.
+     * It is never higher than `max()` neither.
+     *
+     * @param percentile Percentage of recorded values, `50` for median, `100` for maximum
+     *
+     * @returns Value at given percentile, or 0 if no value was recorded
+     *
+     * @throws InvalidPercentile If percentile isn't inside 0..100
+     */
+    std::uint64_t percentile(double percentile) const;
+};
+
+
+}
+
+
+#endif //RPTOGETHER_SERVER_LATENCYHISTOGRAM_HPP
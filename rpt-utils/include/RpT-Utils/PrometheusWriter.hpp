@@ -0,0 +1,112 @@
+#ifndef RPTOGETHER_SERVER_PROMETHEUSWRITER_HPP
+#define RPTOGETHER_SERVER_PROMETHEUSWRITER_HPP
+
+#include <cstdint>
+#include <initializer_list>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <RpT-Utils/LatencyHistogram.hpp>
+
+/**
+ * @file PrometheusWriter.hpp
+ */
+
+
+namespace RpT::Utils {
+
+
+/**
+ * @brief Kind of metric family, as declared by Prometheus `# TYPE` line
+ */
+enum class MetricType {
+    /// Value which only increases, until process restarts
+    Counter,
+    /// Value which can go up and down
+    Gauge,
+    /// Quantiles, sum and count for observed values
+    Summary
+};
+
+
+/**
+ * @brief Formats metrics families and their samples using Prometheus text exposition format
+ *
+ * Each family is declared with its `# HELP` and `# TYPE` lines, then its samples must be written before any other
+ * family is declared. Label values are escaped, but metric and label names must already be valid Prometheus names.
+ *
+ * @author ThisALV, https://github.com/ThisALV
+ */
+class PrometheusWriter {
+public:
+    /// Label names with their value for one sample
+    using Labels = std::initializer_list<std::pair<std::string_view, std::string_view>>;
+
+private:
+    std::ostringstream output_;
+
+    /// Writes given metric name followed by given labels, if any
+    void writeName(std::string_view name, Labels labels);
+
+public:
+    /**
+     * @brief Constructs writer without any formatted metric
+     */
+    PrometheusWriter();
+
+    // Entity class semantic :
+
+    PrometheusWriter(const PrometheusWriter&) = delete;
+    PrometheusWriter& operator=(const PrometheusWriter&) = delete;
+
+    /**
+     * @brief Declares metric family which samples will be written next
+     *
+     * @param name Metric family name
+     * @param type Metric family type
+     * @param help Description for metric family, on a single line
+     */
+    void family(std::string_view name, MetricType type, std::string_view help);
+
+    /**
+     * @brief Writes sample with given integer value
+     *
+     * @param name Metric name, family name or suffixed family name
+     * @param value Sample value
+     * @param labels Sample labels, if any
+     */
+    void sample(std::string_view name, std::uint64_t value, Labels labels = {});
+
+    /**
+     * @brief Writes sample with given floating point value
+     *
+     * @param name Metric name, family name or suffixed family name
+     * @param value Sample value
+     * @param labels Sample labels, if any
+     */
+    void sample(std::string_view name, double value, Labels labels = {});
+
+    /**
+     * @brief Declares summary family then writes 0.5, 0.9 and 0.99 quantiles, sum and count for given latencies, in
+     * seconds
+     *
+     * @param name Metric family name, which should end with `_seconds`
+     * @param help Description for metric family, on a single line
+     * @param latencies Recorded latencies, in nanoseconds
+     */
+    void summary(std::string_view name, std::string_view help, const LatencyHistogram& latencies);
+
+    /**
+     * @brief Retrieves every family formatted so far
+     *
+     * @returns Metrics using Prometheus text exposition format
+     */
+    std::string str() const;
+};
+
+
+}
+
+
+#endif //RPTOGETHER_SERVER_PROMETHEUSWRITER_HPP
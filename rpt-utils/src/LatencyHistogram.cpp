@@ -0,0 +1,81 @@
+#include <RpT-Utils/LatencyHistogram.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+
+namespace RpT::Utils {
+
+
+LatencyHistogram::LatencyHistogram()
+: buckets_(BUCKETS_COUNT, 0), count_ { 0 }, min_ { std::numeric_limits<std::uint64_t>::max() }, max_ { 0 },
+sum_ { 0 } {}
+
+void LatencyHistogram::record(const std::uint64_t value) {
+    buckets_[bucketOf(value)]++;
+    count_++;
+    min_ = std::min(min_, value);
+    max_ = std::max(max_, value);
+    sum_ += value;
+}
+
+void LatencyHistogram::merge(const LatencyHistogram& other) {
+    for (std::size_t bucket { 0 }; bucket < BUCKETS_COUNT; bucket++)
+        buckets_[bucket] += other.buckets_[bucket];
+
+    count_ += other.count_;
+    min_ = std::min(min_, other.min_);
+    max_ = std::max(max_, other.max_);
+    sum_ += other.sum_;
+}
+
+void LatencyHistogram::reset() {
+    std::fill(buckets_.begin(), buckets_.end(), 0);
+    count_ = 0;
+    min_ = std::numeric_limits<std::uint64_t>::max();
+    max_ = 0;
+    sum_ = 0;
+}
+
+std::uint64_t LatencyHistogram::count() const {
+    return count_;
+}
+
+std::uint64_t LatencyHistogram::min() const {
+    return count_ == 0 ? 0 : min_;
+}
+
+std::uint64_t LatencyHistogram::max() const {
+    return max_;
+}
+
+double LatencyHistogram::mean() const {
+    return count_ == 0 ? 0 : static_cast<double>(sum_ / count_);
+}
+
+std::uint64_t LatencyHistogram::percentile(const double percentile) const {
+    if (!(percentile >= 0 && percentile <= 100)) // Also rejects NaN
+        throw InvalidPercentile {};
+
+    if (count_ == 0)
+        return 0;
+
+    // Rank of value at given percentile, first value is at least required
+    const auto rank {
+        std::max<std::uint64_t>(static_cast<std::uint64_t>(std::ceil(percentile / 100 * count_)), 1)
+    };
+
+    std::uint64_t counted_values { 0 };
+    for (std::size_t bucket { 0 }; bucket < BUCKETS_COUNT; bucket++) {
+        counted_values += buckets_[bucket];
+
+        if (counted_values >= rank) // Bucket might count values higher than max, which is exact
+            return std::min(highestValueOf(bucket), max_);
+    }
+
+    return max_; // Not reached, rank is never higher than count
+}
+
+
+}
@@ -0,0 +1,99 @@
+#include <RpT-Utils/PrometheusWriter.hpp>
+
+#include <iomanip>
+
+
+namespace RpT::Utils {
+
+
+namespace {
+
+
+/// Nanoseconds inside one second, as Prometheus latencies are in seconds
+constexpr double NANOSECONDS_PER_SECOND { 1e9 };
+
+/// Retrieves name used by `# TYPE` line for given metric type
+constexpr std::string_view typeName(const MetricType type) {
+    switch (type) {
+    case MetricType::Counter:
+        return "counter";
+    case MetricType::Gauge:
+        return "gauge";
+    default:
+        return "summary";
+    }
+}
+
+
+}
+
+
+void PrometheusWriter::writeName(const std::string_view name, const Labels labels) {
+    output_ << name;
+
+    if (labels.size() == 0)
+        return;
+
+    char separator { '{' };
+    for (const auto& [label_name, label_value] : labels) {
+        output_ << separator << label_name << "=\"";
+
+        // Backslash, double-quote and line feed are the only characters which must be escaped
+        for (const char c : label_value) {
+            if (c == '\\')
+                output_ << "\\\\";
+            else if (c == '"')
+                output_ << "\\\"";
+            else if (c == '\n')
+                output_ << "\\n";
+            else
+                output_ << c;
+        }
+
+        output_ << '"';
+        separator = ',';
+    }
+
+    output_ << '}';
+}
+
+PrometheusWriter::PrometheusWriter() {
+    output_ << std::setprecision(10); // Enough for nanoseconds resolution of latencies up to a few seconds
+}
+
+void PrometheusWriter::family(const std::string_view name, const MetricType type, const std::string_view help) {
+    output_ << "# HELP " << name << ' ' << help << '\n';
+    output_ << "# TYPE " << name << ' ' << typeName(type) << '\n';
+}
+
+void PrometheusWriter::sample(const std::string_view name, const std::uint64_t value, const Labels labels) {
+    writeName(name, labels);
+    output_ << ' ' << value << '\n';
+}
+
+void PrometheusWriter::sample(const std::string_view name, const double value, const Labels labels) {
+    writeName(name, labels);
+    output_ << ' ' << value << '\n';
+}
+
+void PrometheusWriter::summary(const std::string_view name, const std::string_view help,
+                               const LatencyHistogram& latencies) {
+
+    family(name, MetricType::Summary, help);
+
+    sample(name, latencies.percentile(50) / NANOSECONDS_PER_SECOND, { { "quantile", "0.5" } });
+    sample(name, latencies.percentile(90) / NANOSECONDS_PER_SECOND, { { "quantile", "0.9" } });
+    sample(name, latencies.percentile(99) / NANOSECONDS_PER_SECOND, { { "quantile", "0.99" } });
+
+    const std::string name_copy { name }; // Required for concatenation
+    // Sum is retrieved from mean, as histogram doesn't provide it
+    sample(name_copy + "_sum", latencies.mean() * latencies.count() / NANOSECONDS_PER_SECOND);
+    sample(name_copy + "_count", latencies.count());
+}
+
+std::string PrometheusWriter::str() const {
+    return output_.str();
+}
+
+
+}